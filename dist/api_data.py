@@ -124,8 +124,30 @@ lsm_config = [
 	Config('lsm_merge_max', '15', r'''
 		the maximum number of chunks to include in a merge operation''',
 		min='2', max='100'),
+	Config('lsm_merge_partitions', '1', r'''
+		the number of key ranges a large merge is split into.  Each
+		range is written to a separate chunk in parallel by a helper
+		thread, reducing the time taken by large merges at the cost of
+		searching more chunks''',
+		min='1', max='16'),
+	Config('lsm_merge_policy', 'default', r'''
+		how chunks are chosen for merges.  The \c default policy
+		merges chunks of up to two adjacent generations; \c leveled
+		merges a chunk with all newer chunks once they are larger than
+		1/\c lsm_merge_ratio of its size, bounding the number of
+		chunks a read searches; \c tiered merges \c lsm_merge_ratio
+		chunks of the same generation, bounding the number of times a
+		record is rewritten''',
+		choices=['default', 'leveled', 'tiered']),
+	Config('lsm_merge_ratio', '10', r'''
+		the size ratio between adjacent chunks for the \c leveled
+		merge policy, and the number of chunks merged together for
+		the \c tiered merge policy''',
+		min='2', max='100'),
 	Config('lsm_merge_threads', '1', r'''
-		the number of thread to perform merge operations''',
+		the maximum number of LSM worker threads merging chunks of
+		the tree at the same time, see the \c lsm_workers
+		configuration to ::wiredtiger_open''',
 		min='1', max='10'), # !!! max must match WT_LSM_MAX_WORKERS
 ]
 
@@ -137,6 +159,14 @@ file_config = format_meta + [
 		items, and the default value of 512B is a good choice absent
 		requirements from the operating system or storage device''',
 		min='512B', max='128MB'),
+	Config('block_allocation', 'best', r'''
+		configure block allocation.  Permitted values are \c "best",
+		allocating the best-fit free extent from the file's free
+		space lists, or \c "segregated", additionally keeping freed
+		blocks of common sizes on per-size free lists, which makes
+		most allocations and frees constant-time in files with heavily
+		fragmented free space''',
+		choices=['best', 'segregated']),
 	Config('block_compressor', '', r'''
 		configure a compressor for file blocks.  Permitted values are
 		empty (off) or \c "bzip2", \c "snappy" or custom compression
@@ -164,6 +194,14 @@ file_config = format_meta + [
 		row-store leaf page value dictionary; see
 		@ref file_formats_compression for more information''',
 		min='0'),
+	Config('file_extend', '0', r'''
+		preallocate file space in chunks of this many bytes ahead of
+		writes extending the file, reducing file system metadata
+		updates and fragmentation when files grow quickly.  If zero,
+		no space is preallocated.  Ignored where the Linux \c fallocate
+		system call isn't supported; see @ref tuning_file_extend for
+		more information''',
+		min='0', max='1GB'),
 	Config('format', 'btree', r'''
 		the file format''',
 		choices=['btree']),
@@ -248,6 +286,8 @@ file_config = format_meta + [
 file_meta = file_config + [
 	Config('checkpoint', '', r'''
 		the file checkpoint entries'''),
+	Config('checkpoint_lsn', '0', r'''
+		the log sequence number from which the file is recovered'''),
 	Config('version', '(major=0,minor=0)', r'''
 		the file version'''),
 ]
@@ -263,9 +303,25 @@ table_only_meta = [
 		WT_SESSION::create''', type='list'),
 ]
 
+index_only_meta = [
+	Config('extractor', '', r'''
+		configure a custom extractor for an index.  Value must be an
+		extractor name created with WT_CONNECTION::add_extractor.  The
+		extractor sets the index key columns in the format given by
+		\c key_format, instead of the index using the \c columns of
+		the table'''),
+	Config('value_columns', '', r'''
+		list of table value columns to store in the index, in addition
+		to the \c columns in the index key.  Index cursors with a
+		projection of columns stored in the index are satisfied without
+		reading the table.  Not supported for indices with a custom
+		\c extractor''',
+		type='list'),
+]
+
 colgroup_meta = column_meta + source_meta
 
-index_meta = format_meta + source_meta
+index_meta = format_meta + index_only_meta + source_meta
 
 table_meta = format_meta + table_only_meta
 
@@ -326,6 +382,7 @@ connection_runtime_config = [
 		    'mutex',
 		    'read',
 		    'readserver',
+		    'recovery',
 		    'reconcile',
 		    'salvage',
 		    'verify',
@@ -359,7 +416,8 @@ methods = {
 		min='10', max='50'),
 ]),
 
-'session.create' : Method(table_only_meta + file_config + lsm_config + source_meta + [
+'session.create' : Method(table_only_meta + index_only_meta + file_config +
+    lsm_config + source_meta + [
 	Config('exclusive', 'false', r'''
 		fail if the object exists.  When false (the default), if the
 		object exists, check that its settings match the specified
@@ -475,12 +533,26 @@ methods = {
 		priority of the transaction for resolving conflicts.
 		Transactions with higher values are less likely to abort''',
 		min='-100', max='100'),
-	Config('sync', 'full', r'''
-		how to sync log records when the transaction commits''',
+	Config('sync', '', r'''
+		how to sync log records when the transaction commits: \c full
+		waits for the log records to be flushed to stable storage,
+		\c flush waits for the log records to be written to the
+		operating system, \c write copies the log records into a
+		memory buffer that is written by later commits or within a
+		tenth of a second, and \c none doesn't log the transaction.
+		Defaults to the \c transaction_sync setting of the
+		connection''',
+		choices=['full', 'flush', 'write', 'none']),
+]),
+
+'session.commit_transaction' : Method([
+	Config('sync', '', r'''
+		override the \c sync setting of the transaction.  A
+		transaction begun with \c sync=none that made updates cannot
+		commit with a different setting, its updates were not logged''',
 		choices=['full', 'flush', 'write', 'none']),
 ]),
 
-'session.commit_transaction' : Method([]),
 'session.rollback_transaction' : Method([]),
 
 'session.checkpoint' : Method([
@@ -546,13 +618,29 @@ methods = {
 		configures periodic checkpoints''',
 		min='1', max='100000'),
 		]),
+	Config('checkpoint_threads', '0', r'''
+		threads helping checkpoints write dirty leaf pages, each file's
+		dirty pages are reconciled in parallel by these threads and the
+		thread running the checkpoint.  Zero means pages are written by
+		the thread running the checkpoint''',
+		min=0, max=64),
 	Config('create', 'false', r'''
 		create the database if it does not exist''',
 		type='boolean'),
+	Config('cursor_cache', '0', r'''
+		maximum number of closed file cursors each session keeps for
+		reuse by a later WT_SESSION::open_cursor call with the same URI
+		and configuration, zero disables caching''',
+		min=0, max=1000),
 	Config('direct_io', '', r'''
 		Use \c O_DIRECT to access files.  Options are given as a
 		list, such as <code>"direct_io=[data]"</code>''',
 		type='list', choices=['data', 'log']),
+	Config('eviction_workers', '0', r'''
+		additional threads to help evict pages from cache.  The
+		eviction server chooses the pages to evict and, if workers are
+		configured, leaves the eviction to them''',
+		min=0, max=20),
 	Config('extensions', '', r'''
 		list of shared library extensions to load (using dlopen).
 		Optional values are passed as the \c config parameter to
@@ -565,11 +653,26 @@ methods = {
 		handle''',
 		min='15'),
 	Config('logging', 'false', r'''
-		enable logging''',
+		enable logging.  Transactions write their updates to the log
+		when they commit, see \c transaction_sync''',
 		type='boolean'),
+	Config('io_threads', '0', r'''
+		threads writing blocks in the background, so the threads
+		evicting or checkpointing pages queue writes rather than waiting
+		for each write to complete.  Zero means blocks are written by
+		the thread writing the page''',
+		min=0, max=64),
 	Config('lsm_merge', 'true', r'''
 		merge LSM chunks where possible''',
 		type='boolean'),
+	Config('lsm_workers', '4', r'''
+		threads shared by all LSM trees in the connection to switch,
+		flush and merge chunks and to create Bloom filters.  Each tree
+		runs at most its \c lsm_merge_threads merges at a time.  Up to
+		the same number of additional threads help build the
+		partitions of merges, see the \c lsm_merge_partitions
+		configuration to WT_SESSION::create''',
+		min='1', max='64'),
 	Config('mmap', 'true', r'''
 		Use memory mapping to access files when possible''',
 		type='boolean'),
@@ -578,6 +681,10 @@ methods = {
 		RPC server for primary processes and use RPC for secondary
 		processes). <b>Not yet supported in WiredTiger</b>''',
 		type='boolean'),
+	Config('read_ahead', '8', r'''
+		number of pages a cursor scan starts reading ahead when it has
+		to read a page from disk, zero disables read-ahead''',
+		min=0, max=1000),
 	Config('session_max', '50', r'''
 		maximum expected number of sessions (including server
 		threads)''',
@@ -616,6 +723,16 @@ methods = {
 		flush files to stable storage when closing or writing
 		checkpoints''',
 		type='boolean'),
+	Config('transaction_sync', 'full', r'''
+		how to sync log records when transactions commit, by default:
+		\c full waits for the log records to be flushed to stable
+		storage, \c flush waits for the log records to be written to
+		the operating system, \c write copies the log records into a
+		memory buffer that is written by later commits or within a
+		tenth of a second, and \c none doesn't log the transaction.
+		Transactions may override the default when they begin or
+		commit''',
+		choices=['full', 'flush', 'write', 'none']),
 	Config('transactional', 'true', r'''
 		support transactional semantics''',
 		type='boolean'),
@@ -19,6 +19,10 @@ flags = {
 		'DIRECTIO_DATA',
 		'DIRECTIO_LOG'
 	],
+	'log_write' : [
+		'LOG_FLUSH',
+		'LOG_FSYNC',
+	],
 	'rec_write' : [
 		'EVICTION_SERVER_LOCKED',
 		'SKIP_UPDATE_ERR',
@@ -47,6 +51,7 @@ flags = {
 		'VERB_lsm',
 		'VERB_mutex',
 		'VERB_read',
+		'VERB_recovery',
 		'VERB_reconcile',
 		'VERB_salvage',
 		'VERB_shared_cache',
@@ -60,6 +65,7 @@ flags = {
 	'conn' : [
 		'CONN_CACHE_POOL',
 		'CONN_EVICTION_RUN',
+		'CONN_LOGGING',
 		'CONN_LSM_MERGE',
 		'CONN_PANIC',
 		'CONN_SERVER_RUN',
@@ -9,14 +9,80 @@ tmp_file = '__tmp'
 
 # Map log record types to C
 c_types = {
+		'item' : 'WT_ITEM *',
+		'recno' : 'uint64_t',
 		'string' : 'const char *',
+		'uint32' : 'uint32_t',
 }
 
 # Map log record types to format strings
 fmt_types = {
+		'item' : 'u',
+		'recno' : 'r',
 		'string' : 'S',
+		'uint32' : 'I',
 }
 
+def record_fmt(fields):
+	return ''.join(fmt_types[t] for t, n in fields)
+
+# The C type of a field, ready to have a name appended
+def c_decl(t):
+	ctype = c_types.get(t, t)
+	return ctype if ctype.endswith('*') else ctype + ' '
+
+def param_decl(fields):
+	return ', '.join('%s%s' % (c_decl(t), n) for t, n in fields)
+
+def param_list(fields):
+	return ', '.join(n for t, n in fields)
+
+# Unpacked items are returned in a caller's WT_ITEM, other fields by reference
+def unpack_decl(fields):
+	return ', '.join(('%s%sp' if t == 'item' else '%s*%sp') % (c_decl(t), n)
+	    for t, n in fields)
+
+def unpack_list(fields):
+	return ', '.join('%sp' % n for t, n in fields)
+
+# Continuation lines of a function's parameter declarations, wrapped at 80
+# columns and ending with the closing parenthesis
+def wrap_decl(decl):
+	lines, line = [], '   '
+	for arg in decl.split(', '):
+		if len(line) + len(arg) + 2 > 80 and line != '   ':
+			lines.append(line + ',')
+			line = '   '
+		elif line != '   ':
+			line += ','
+		line += ' ' + arg
+	lines.append(line + ')')
+	return '\n'.join(lines)
+
+#####################################################################
+# Update log.h with the log record and operation type #defines.
+#####################################################################
+f='../src/include/log.h'
+tfile = open(tmp_file, 'w')
+skip = 0
+for line in open(f, 'r'):
+	if not skip:
+		tfile.write(line)
+	if line.count('Log record types: END'):
+		tfile.write(line)
+		skip = 0
+	elif line.count('Log record types: BEGIN'):
+		tfile.write('\n')
+		skip = 1
+		for v, t in enumerate(log_data.rectypes):
+			tfile.write('#define\t%s\t%d\n' % (t.macro_name(), v))
+		tfile.write('\n')
+		for v, t in enumerate(log_data.optypes):
+			tfile.write('#define\t%s\t%d\n' % (t.macro_name(), v))
+		tfile.write('\n')
+tfile.close()
+compare_srcfile(tmp_file, f)
+
 #####################################################################
 # Create log.i with inline functions for each log record type.
 #####################################################################
@@ -25,18 +91,109 @@ tfile = open(tmp_file, 'w')
 
 tfile.write('/* DO NOT EDIT: automatically built by dist/log.py. */\n')
 
-for t in log_data.types:
+for t in log_data.rectypes:
+	if not t.fields:
+		continue
+	tfile.write('''
+static inline int
+__wt_logput_%(name)s(WT_SESSION_IMPL *session,
+%(param_decl)s
+{
+	return (__wt_log_put(session,
+	    &__wt_logdesc_%(name)s, lsnp, flags, %(param_list)s));
+}
+''' % {
+	'name' : t.name,
+	'param_decl' : wrap_decl(
+	    'off_t *lsnp, uint32_t flags, ' + param_decl(t.fields)),
+	'param_list' : param_list(t.fields),
+})
+
+for t in log_data.optypes:
+	if not t.fields:
+		continue
 	tfile.write('''
 static inline int
-__wt_logput_%(name)s(WT_SESSION_IMPL *session, %(param_decl)s)
+__wt_logop_%(name)s_pack(WT_SESSION_IMPL *session, WT_ITEM *logrec,
+%(param_decl)s
 {
-	return (__wt_log_put(session, &__wt_logdesc_%(name)s, %(param_list)s));
+	const char *fmt = "II%(fmt)s";
+	size_t size;
+	uint32_t optype, recsize;
+
+	/*
+	 * The record size doesn't include the operation type or the size: a
+	 * size that included its own variable-length encoding might have no
+	 * consistent value.
+	 */
+	optype = %(macro)s;
+	WT_RET(__wt_struct_size(session, &size, "%(fmt)s", %(param_list)s));
+	recsize = (uint32_t)size;
+	size += __wt_vsize_uint(optype) + __wt_vsize_uint(recsize);
+
+	WT_RET(__wt_buf_grow(session, logrec, logrec->size + size));
+	WT_RET(__wt_struct_pack(session,
+	    (uint8_t *)logrec->mem + logrec->size, size, fmt,
+	    optype, recsize, %(param_list)s));
+
+	logrec->size += (uint32_t)size;
+	return (0);
+}
+''' % {
+	'name' : t.name,
+	'macro' : t.macro_name(),
+	'param_decl' : wrap_decl(param_decl(t.fields)),
+	'param_list' : param_list(t.fields),
+	'fmt' : record_fmt(t.fields),
+})
+
+for t in log_data.rectypes:
+	if not t.fields:
+		continue
+	tfile.write('''
+static inline int
+__wt_logrec_%(name)s_unpack(WT_SESSION_IMPL *session,
+%(unpack_decl)s
+{
+	return (__wt_struct_unpack(session,
+	    (uint8_t *)record->data + WT_LOG_RECORD_SIZE,
+	    record->size - WT_LOG_RECORD_SIZE,
+	    "%(fmt)s", %(unpack_list)s));
+}
+''' % {
+	'name' : t.name,
+	'unpack_decl' : wrap_decl(
+	    'WT_ITEM *record, ' + unpack_decl(t.fields)),
+	'unpack_list' : unpack_list(t.fields),
+	'fmt' : record_fmt(t.fields),
+})
+
+for t in log_data.optypes:
+	if not t.fields:
+		continue
+	tfile.write('''
+static inline int
+__wt_logop_%(name)s_unpack(WT_SESSION_IMPL *session,
+%(unpack_decl)s
+{
+	const char *fmt = "II%(fmt)s";
+	uint32_t optype, recsize, size;
+
+	WT_RET(__wt_logop_read(session, pp, end, &optype, &size));
+	WT_ASSERT(session, optype == %(macro)s);
+	WT_RET(__wt_struct_unpack(session, *pp, size, fmt,
+	    &optype, &recsize, %(unpack_list)s));
+
+	*pp += size;
+	return (0);
 }
 ''' % {
 	'name' : t.name,
-	'param_decl' : ', '.join(
-	    '%s %s' % (c_types.get(t, t), n) for t, n in t.fields),
-	'param_list' : ', '.join(n for t, n in t.fields),
+	'macro' : t.macro_name(),
+	'unpack_decl' : wrap_decl('const uint8_t **pp, const uint8_t *end, ' +
+	    unpack_decl(t.fields)),
+	'unpack_list' : unpack_list(t.fields),
+	'fmt' : record_fmt(t.fields),
 })
 
 tfile.close()
@@ -53,16 +210,19 @@ tfile.write('''/* DO NOT EDIT: automatically built by dist/log.py. */
 #include "wt_internal.h"
 ''')
 
-for t in log_data.types:
+for t in log_data.rectypes:
+	if not t.fields:
+		continue
 	tfile.write('''
 WT_LOGREC_DESC
 __wt_logdesc_%(name)s =
 {
-	"%(fmt)s", { %(field_list)s, NULL }
+	%(macro)s, "%(fmt)s", { %(field_list)s, NULL }
 };
 ''' % {
 	'name' : t.name,
-	'fmt' : ''.join(fmt_types[t] for t, n in t.fields),
+	'macro' : t.macro_name(),
+	'fmt' : record_fmt(t.fields),
 	'field_list' : ', '.join('"%s"' % n for t, n in t.fields),
 })
 
@@ -1,10 +1,40 @@
-# Data for config.py, describes all configuration key / value pairs
+# Data for log.py, describes all log record and log operation types
 
 class LogRecordType:
 	def __init__(self, name, fields):
 		self.name = name
 		self.fields = fields
 
-types = [
-	LogRecordType('debug', [('string', 'message')])
+	def macro_name(self):
+		return 'WT_LOGREC_%s' % self.name.upper()
+
+class LogOperationType:
+	def __init__(self, name, fields):
+		self.name = name
+		self.fields = fields
+
+	def macro_name(self):
+		return 'WT_LOGOP_%s' % self.name.upper()
+
+# Log records, written to the log file.  Record type numbers are written into
+# the log, new types must be appended to the list.
+rectypes = [
+	LogRecordType('invalid', []),
+	LogRecordType('commit', [('uint32', 'txnid'), ('item', 'ops')]),
+	LogRecordType('debug', [('string', 'message')]),
+]
+
+# Operations, packed into the "ops" field of commit log records.  Operation
+# type numbers are written into the log, new types must be appended to the
+# list.
+optypes = [
+	LogOperationType('invalid', []),
+	LogOperationType('col_put',
+	    [('string', 'uri'), ('recno', 'recno'), ('item', 'value')]),
+	LogOperationType('col_remove',
+	    [('string', 'uri'), ('recno', 'recno')]),
+	LogOperationType('row_put',
+	    [('string', 'uri'), ('item', 'key'), ('item', 'value')]),
+	LogOperationType('row_remove',
+	    [('string', 'uri'), ('item', 'key')]),
 ]
@@ -111,7 +111,7 @@ typedef struct {
 ''')
 		else:
 			f.write('\targs->' + l.name + ' = ' + l.name + ';\n\n')
-	f.write('\t__wt_spin_lock(session, &S2C(session)->serial_lock);\n')
+	f.write('\tWT_PAGE_LOCK(session, page);\n')
 	f.write('\tret = __wt_' + entry.name + '_serial_func(session, args);\n')
 
 	if sizes:
@@ -131,7 +131,7 @@ typedef struct {
 \t\t__wt_cache_page_inmem_incr(session, page, incr_mem);
 
 ''')
-	f.write('\t__wt_spin_unlock(session, &S2C(session)->serial_lock);\n')
+	f.write('\tWT_PAGE_UNLOCK(session, page);\n')
 
 	if sizes:
 		f.write('''
@@ -16,6 +16,34 @@ class Stat:
 	def __cmp__(self, other):
 		return cmp(self.name, other.name)
 
+# Latency histograms are a run of statistics for an operation, one for each
+# bucket of microseconds, split 1-2-5 within each power of ten so the tail of
+# the distribution can be read to within a factor of two or so.  The bucket
+# limits must match __wt_stat_latency.  The statistics sort in bucket order
+# (the bucket numbers are zero-filled), code updating the histogram indexes
+# from the first bucket's statistic.
+latency_limits = [ 1, 2, 5, 10, 20, 50, 100, 200, 500,
+    1000, 2000, 5000, 10000, 20000, 50000, 100000, 200000, 500000, 1000000 ]
+
+def latency_unit(usecs):
+	for div, unit in ((1000000, 's'), (1000, 'ms')):
+		if usecs >= div:
+			return (usecs / div, unit)
+	return (usecs, 'us')
+
+def latency_bucket(lo, hi):
+	(lov, lou) = latency_unit(lo)
+	(hiv, hiu) = latency_unit(hi)
+	return '%d%s-%d%s' % (lov, lou if lou != hiu else '', hiv, hiu)
+
+latency_buckets = [latency_bucket(lo, hi)
+    for lo, hi in zip([0] + latency_limits, latency_limits)] + [
+    'over %d%s' % latency_unit(latency_limits[-1])]
+
+def latency_stats(name, desc):
+	return [Stat('latency_%s_%02d' % (name, i), 'latency: %s %s' % (desc, b))
+	    for i, b in enumerate(latency_buckets)]
+
 ##########################################
 # CONNECTION statistics
 ##########################################
@@ -24,6 +52,8 @@ connection_stats = [
 	# System statistics
 	##########################################
 	Stat('cond_wait', 'pthread mutex condition wait calls'),
+	Stat('config_compiled_lookup',
+	    'compiled configuration string lookups'),
 	Stat('file_open', 'files currently open', perm=1),
 	Stat('memory_allocation', 'total heap memory allocations'),
 	Stat('memory_free', 'total heap memory frees'),
@@ -40,8 +70,11 @@ connection_stats = [
 	Stat('block_byte_read', 'bytes read by the block manager'),
 	Stat('block_byte_write', 'bytes written by the block manager'),
 	Stat('block_map_read', 'mapped blocks read by the block manager'),
+	Stat('block_preload', 'blocks pre-loaded by the block manager'),
 	Stat('block_read', 'blocks read by the block manager'),
 	Stat('block_write', 'blocks written by the block manager'),
+	Stat('block_write_background',
+	    'blocks written by the block I/O threads'),
 
 	##########################################
 	# Cache and eviction statistics
@@ -76,6 +109,14 @@ connection_stats = [
 	Stat('cache_read', 'cache: pages read into cache'),
 	Stat('cache_write', 'cache: pages written from cache'),
 
+	##########################################
+	# Logging statistics
+	##########################################
+	Stat('log_bytes_written', 'log: bytes written'),
+	Stat('log_records', 'log: records written'),
+	Stat('log_syncs', 'log: sync operations'),
+	Stat('log_writes', 'log: write operations'),
+
 	##########################################
 	# Reconciliation statistics
 	##########################################
@@ -97,12 +138,14 @@ connection_stats = [
 	##########################################
 	# LSM statistics
 	##########################################
+	Stat('lsm_partitions_built', 'key ranges built by split LSM merges'),
 	Stat('lsm_rows_merged', 'rows merged in an LSM tree'),
 
 	##########################################
 	# Total Btree cursor operations
 	##########################################
 	Stat('cursor_create', 'cursor creation'),
+	Stat('cursor_cache_reuse', 'cursors reused from a session cache'),
 	Stat('cursor_insert', 'Btree cursor insert calls'),
 	Stat('cursor_next', 'Btree cursor next calls'),
 	Stat('cursor_prev', 'Btree cursor prev calls'),
@@ -113,6 +156,18 @@ connection_stats = [
 	Stat('cursor_update', 'Btree cursor update calls'),
 ]
 
+##########################################
+# Latency histograms
+##########################################
+connection_stats += latency_stats('evict_wait', 'waiting for cache space')
+connection_stats += latency_stats('fsync', 'file syncs')
+connection_stats += latency_stats('insert', 'Btree cursor inserts')
+connection_stats += latency_stats('read', 'file reads')
+connection_stats += latency_stats('remove', 'Btree cursor removes')
+connection_stats += latency_stats('search', 'Btree cursor searches')
+connection_stats += latency_stats('update', 'Btree cursor updates')
+connection_stats += latency_stats('write', 'file writes')
+
 connection_stats = sorted(connection_stats, key=attrgetter('name'))
 
 ##########################################
@@ -183,6 +238,8 @@ dsrc_stats = [
 	# Block manager statistics
 	##########################################
 	Stat('block_alloc', 'blocks allocated'),
+	Stat('block_alloc_segregated',
+	    'blocks allocated from the per-size free lists'),
 	Stat('block_allocsize', 'block manager file allocation unit size'),
 	Stat('block_checkpoint_size', 'checkpoint size'),
 	Stat('block_extension', 'block allocations requiring file extension'),
@@ -190,6 +247,7 @@ dsrc_stats = [
 	Stat('block_magic', 'file magic number'),
 	Stat('block_major', 'file major version number'),
 	Stat('block_minor', 'minor version number'),
+	Stat('block_preallocate', 'file space preallocations'),
 	Stat('block_size', 'block manager file size in bytes'),
 
 	##########################################
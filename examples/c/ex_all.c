@@ -293,6 +293,42 @@ cursor_ops(WT_SESSION *session)
 	/*! [Remove a record] */
 	}
 
+	{
+	/*! [Insert a batch of records] */
+	/*
+	 * Keys and values are raw items: the packed form of a string includes
+	 * its trailing nul byte.
+	 */
+	WT_ITEM keys[2], values[2];
+	keys[0].data = "first key";
+	keys[0].size = strlen("first key") + 1;
+	values[0].data = "first value";
+	values[0].size = strlen("first value") + 1;
+	keys[1].data = "second key";
+	keys[1].size = strlen("second key") + 1;
+	values[1].data = "second value";
+	values[1].size = strlen("second value") + 1;
+	ret = cursor->insert_batch(cursor, keys, values, 2);
+	/*! [Insert a batch of records] */
+	}
+
+	{
+	/*! [Search for a batch of keys] */
+	WT_ITEM keys[2], values[2];
+	int i, results[2];
+	keys[0].data = "first key";
+	keys[0].size = strlen("first key") + 1;
+	keys[1].data = "no such key";
+	keys[1].size = strlen("no such key") + 1;
+	ret = cursor->search_batch(cursor, keys, values, results, 2);
+	for (i = 0; ret == 0 && i < 2; ++i)
+		if (results[i] == 0)
+			printf("%s: %s\n",
+			    (const char *)keys[i].data,
+			    (const char *)values[i].data);
+	/*! [Search for a batch of keys] */
+	}
+
 	{
 	/*! [Display an error] */
 	const char *key = "non-existent key";
@@ -797,15 +833,16 @@ add_compressor(WT_CONNECTION *conn)
 static int
 my_extract(WT_EXTRACTOR *extractor, WT_SESSION *session,
     const WT_ITEM *key, const WT_ITEM *value,
-    WT_ITEM *result)
+    WT_CURSOR *result_cursor)
 {
 	/* Unused parameters */
 	(void)extractor;
 	(void)session;
 	(void)key;
 
-	*result = *value;
-	return (0);
+	/* Index the record by its whole value. */
+	result_cursor->set_key(result_cursor, value);
+	return (result_cursor->insert(result_cursor));
 }
 /*! [WT_EXTRACTOR] */
 
@@ -879,6 +916,25 @@ connection_ops(WT_CONNECTION *conn)
 	    "session.open_cursor", "my_data:", "devices", "list", NULL);
 	/*! [Configure method configuration] */
 
+	{
+	/*! [Compile a configuration string] */
+	WT_SESSION *session;
+	const char *snapshot_config;
+
+	/*
+	 * Compile the configuration once, and pass the compiled string when
+	 * beginning each transaction.
+	 */
+	ret = conn->compile_configuration(conn, "session.begin_transaction",
+	    "isolation=snapshot", &snapshot_config);
+
+	ret = conn->open_session(conn, NULL, NULL, &session);
+	ret = session->begin_transaction(session, snapshot_config);
+	ret = session->commit_transaction(session, NULL);
+	/*! [Compile a configuration string] */
+	ret = session->close(session, NULL);
+	}
+
 	/*! [Close a connection] */
 	ret = conn->close(conn, NULL);
 	/*! [Close a connection] */
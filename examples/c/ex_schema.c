@@ -114,6 +114,15 @@ main(void)
 	    "index:poptable:country_plus_year", "columns=(country,year)");
 	/*! [Create an index with a composite key] */
 
+	/*! [Create an index that stores value columns] */
+	/*
+	 * Create an index on country that also stores the population column,
+	 * so population can be read using the index without a table lookup.
+	 */
+	ret = session->create(session, "index:poptable:country_population",
+	    "columns=(country),value_columns=(population)");
+	/*! [Create an index that stores value columns] */
+
 	/* Insert the records into the table. */
 	ret = session->open_cursor(
 	    session, "table:poptable", NULL, "append", &cursor);
@@ -231,6 +240,20 @@ main(void)
 	}
 	/*! [Access only the index] */
 	ret = cursor->close(cursor);
+
+	/*! [Return value columns stored in an index] */
+	/* Return the population column stored in the index. */
+	ret = session->open_cursor(session,
+	    "index:poptable:country_population(population)",
+	    NULL, NULL, &cursor);
+	while ((ret = cursor->next(cursor)) == 0) {
+		ret = cursor->get_key(cursor, &country);
+		ret = cursor->get_value(cursor, &population);
+		printf("country %s, population %" PRIu64 "\n",
+		    country, population);
+	}
+	/*! [Return value columns stored in an index] */
+	ret = cursor->close(cursor);
 	/*! [schema complete] */
 
 	ret = conn->close(conn, NULL);
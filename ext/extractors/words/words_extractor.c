@@ -0,0 +1,106 @@
+/*-
+ * Public Domain 2008-2013 WiredTiger, Inc.
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <ctype.h>
+#include <errno.h>
+#include <string.h>
+
+#include <wiredtiger.h>
+#include <wiredtiger_ext.h>
+
+static WT_EXTENSION_API *wt_api;
+
+/*
+ * words_extract --
+ *	Generate an index key for each whitespace-separated word in a table
+ * value with a value_format of "S": the key is a string, or an item for an
+ * index with a key_format of "u".
+ */
+static int
+words_extract(WT_EXTRACTOR *extractor, WT_SESSION *session,
+    const WT_ITEM *key, const WT_ITEM *value, WT_CURSOR *result_cursor)
+{
+	WT_ITEM item;
+	size_t len;
+	int is_item, ret;
+	const char *s;
+	char *buf, *p, *word;
+
+	(void)extractor;				/* Unused */
+	(void)key;
+
+	if ((ret = wt_api->struct_unpack(
+	    wt_api, session, value->data, value->size, "S", &s)) != 0)
+		return (ret);
+
+	/* Copy the value so each word can be nul-terminated in place. */
+	len = strlen(s);
+	if ((buf = wt_api->scr_alloc(wt_api, session, len + 1)) == NULL)
+		return (ENOMEM);
+	memcpy(buf, s, len + 1);
+
+	is_item = result_cursor->key_format[0] == 'u' ||
+	    result_cursor->key_format[0] == 'U';
+	memset(&item, 0, sizeof(item));
+
+	for (p = buf;;) {
+		while (isspace((unsigned char)*p))
+			++p;
+		if (*p == '\0')
+			break;
+		for (word = p; *p != '\0' && !isspace((unsigned char)*p); ++p)
+			;
+		if (*p != '\0')
+			*p++ = '\0';
+
+		if (is_item) {
+			item.data = word;
+			item.size = strlen(word);
+			result_cursor->set_key(result_cursor, &item);
+		} else
+			result_cursor->set_key(result_cursor, word);
+		if ((ret = result_cursor->insert(result_cursor)) != 0)
+			break;
+	}
+
+	wt_api->scr_free(wt_api, session, buf);
+	return (ret);
+}
+
+static WT_EXTRACTOR words_extractor = { words_extract };
+
+int
+wiredtiger_extension_init(WT_CONNECTION *connection, WT_CONFIG_ARG *config)
+{
+	(void)config;				/* Unused parameters */
+
+						/* Find the extension API */
+	wt_api = connection->get_extension_api(connection);
+
+	return (connection->add_extractor(
+	    connection, "words", &words_extractor, NULL));
+}
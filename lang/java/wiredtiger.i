@@ -150,6 +150,8 @@ WT_CLASS(struct __wt_cursor, WT_CURSOR, cursor)
 %ignore __wt_cursor::remove;
 %ignore __wt_cursor::search;
 %ignore __wt_cursor::search_near;
+%ignore __wt_cursor::search_batch;
+%ignore __wt_cursor::insert_batch;
 %ignore __wt_cursor::update;
 %javamethodmodifiers __wt_cursor::next "protected";
 %rename (next_wrap) __wt_cursor::next;
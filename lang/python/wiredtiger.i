@@ -216,6 +216,8 @@ COMPARE_OK(__wt_cursor::search_near)
 %ignore __wt_cursor::get_value;
 %ignore __wt_cursor::set_key;
 %ignore __wt_cursor::set_value;
+%ignore __wt_cursor::search_batch;
+%ignore __wt_cursor::insert_batch;
 
 /* Next, override methods that return integers via arguments. */
 %ignore __wt_cursor::compare(WT_CURSOR *, WT_CURSOR *, int *);
@@ -232,6 +234,15 @@ COMPARE_OK(__wt_cursor::search_near)
 		$result = SWIG_FromCharPtrAndSize(*$1, *$2);
 }
 
+/*
+ * Handle compiled configuration string returns from compile_configuration.
+ * Python copies the string, and passing the copy to a method doesn't use the
+ * compiled string: it's checked, but configuration isn't faster from Python.
+ */
+%typemap(in,numinputs=0) (const char **compiledp) (const char *compiled) { $1 = &compiled; }
+%typemap(frearg) (const char **compiledp) "";
+%typemap(argout) (const char **compiledp) { $result = SWIG_FromCharPtr(*$1); }
+
 /* Handle record number returns from get_recno */
 %typemap(in,numinputs=0) (uint64_t *recnop) (uint64_t recno) { $1 = &recno; }
 %typemap(frearg) (uint64_t *recnop) "";
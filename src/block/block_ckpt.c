@@ -158,8 +158,10 @@ __wt_block_checkpoint_unload(
 	if (block->verify)
 		WT_TRET(__wt_verify_ckpt_unload(session, block));
 
-	if (!checkpoint)
+	if (!checkpoint) {
+		__wt_block_size_class_discard(session, block);
 		__wt_block_ckpt_destroy(session, &block->live);
+	}
 
 	return (ret);
 }
@@ -356,6 +358,9 @@ __ckpt_process(
 	__wt_spin_lock(session, &block->live_lock);
 	locked = 1;
 
+	/* The checkpoint writes the avail list, it must be complete. */
+	WT_ERR(__wt_block_size_class_flush(session, block));
+
 	/* Skip the additional processing if we aren't deleting checkpoints. */
 	if (!deleting)
 		goto live_update;
@@ -611,8 +616,11 @@ __ckpt_update(
 	 * Currently, there's no API to roll-forward intermediate checkpoints,
 	 * if there ever is, this will need to be fixed.
 	 */
-	if (is_live)
+	if (is_live) {
+		/* Wait for queued writes, the file isn't its full size. */
+		WT_RET(__wt_block_io_wait(session, block, (off_t)0, 0));
 		WT_RET(__wt_filesize(session, block->fh, &ci->file_size));
+	}
 
 	/* Set the checkpoint size for the live system. */
 	if (is_live)
@@ -671,6 +679,8 @@ __wt_block_checkpoint_resolve(WT_SESSION_IMPL *session, WT_BLOCK *block)
 	__wt_spin_lock(session, &block->live_lock);
 	ret = __wt_block_extlist_merge(
 	    session, block, &ci->ckpt_avail, &ci->avail);
+	if (block->compact_ckpts > 0)
+		--block->compact_ckpts;
 	__wt_spin_unlock(session, &block->live_lock);
 
 	/* Discard the list. */
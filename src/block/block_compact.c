@@ -15,6 +15,7 @@ int
 __wt_block_compact_skip(
     WT_SESSION_IMPL *session, WT_BLOCK *block, int trigger, int *skipp)
 {
+	WT_DECL_RET;
 	WT_EXT *ext;
 	WT_EXTLIST *el;
 	WT_FH *fh;
@@ -42,16 +43,26 @@ __wt_block_compact_skip(
 	avail = 0;
 	half = fh->file_size / 2;
 
-	el = &block->live.avail;
-	WT_EXT_FOREACH(ext, el->off)
-		if (ext->off < half)
-			avail += ext->size;
+	/* Compaction allocates from the avail list, it must be complete. */
+	if ((ret = __wt_block_size_class_flush(session, block)) == 0) {
+		el = &block->live.avail;
+		WT_EXT_FOREACH(ext, el->off)
+			if (ext->off < half)
+				avail += ext->size;
+	}
 	pct = (int)((avail * 100) / fh->file_size);
 
-	__wt_spin_unlock(session, &block->live_lock);
-
-	if (pct >= trigger)
+	/*
+	 * Compacted pages are written by the two checkpoints following the
+	 * compaction pass: until they complete, allocate from the avail list.
+	 */
+	if (ret == 0 && pct >= trigger) {
+		block->compact_ckpts = 2;
 		*skipp = 0;
+	}
+
+	__wt_spin_unlock(session, &block->live_lock);
+	WT_RET(ret);
 
 	WT_VERBOSE_RET(session, block,
 	    "%s: compaction %s, %d%% of the free space in the available "
@@ -282,6 +282,24 @@ __block_off_match(WT_EXTLIST *el, off_t off, off_t size)
 	return (0);
 }
 
+/*
+ * __block_size_class_match --
+ *	Return if any part of a specified range appears on a per-size free list.
+ */
+static int
+__block_size_class_match(WT_BLOCK *block, off_t off, off_t size)
+{
+	WT_EXT *ext;
+	u_int i;
+
+	for (i = 0; i < WT_BLOCK_SIZE_CLASSES; ++i)
+		for (ext = block->size_class[i];
+		    ext != NULL; ext = ext->next[0])
+			if (ext->off < off + size && off < ext->off + ext->size)
+				return (1);
+	return (0);
+}
+
 /*
  * __wt_block_misplaced --
  *	Complain if a block appears on the available or discard lists.
@@ -302,7 +320,8 @@ __wt_block_misplaced(WT_SESSION_IMPL *session,
 	 * functions make this check.
 	 */
 	__wt_spin_lock(session, &block->live_lock);
-	if (__block_off_match(&block->live.avail, offset, size))
+	if (__block_off_match(&block->live.avail, offset, size) ||
+	    __block_size_class_match(block, offset, size))
 		name = "available";
 	else if (__block_off_match(&block->live.discard, offset, size))
 		name = "discard";
@@ -441,6 +460,61 @@ __wt_block_off_remove_overlap(WT_SESSION_IMPL *session,
 	return (0);
 }
 
+/*
+ * __wt_block_preallocate --
+ *	Preallocate file space.  Preallocation is advisory, failures are
+ * ignored, and it's turned off if the file system doesn't support it.
+ * Called without the live lock held.
+ */
+void
+__wt_block_preallocate(
+    WT_SESSION_IMPL *session, WT_BLOCK *block, off_t offset, off_t len)
+{
+	WT_DECL_RET;
+
+	if ((ret = __wt_fallocate(session, block->fh, offset, len)) == 0)
+		return;
+	if (ret == ENOTSUP) {
+		__wt_spin_lock(session, &block->live_lock);
+		block->extend_size = 0;
+		block->extend_pending = 0;
+		__wt_spin_unlock(session, &block->live_lock);
+		WT_VERBOSE_TRET(session, block,
+		    "%s: file_extend not supported by the file system, "
+		    "preallocation turned off", block->name);
+	}
+}
+
+/*
+ * __wt_block_preallocate_pending --
+ *	Start any preallocation scheduled by a file extension, called without
+ * the live lock held.
+ */
+int
+__wt_block_preallocate_pending(WT_SESSION_IMPL *session, WT_BLOCK *block)
+{
+	off_t len, off;
+	int queued;
+
+	if (block->extend_pending == 0)
+		return (0);
+
+	__wt_spin_lock(session, &block->live_lock);
+	off = block->extend_off;
+	len = block->extend_pending;
+	block->extend_pending = 0;
+	__wt_spin_unlock(session, &block->live_lock);
+	if (len == 0)
+		return (0);
+
+	/* Queue it for the block I/O threads if possible. */
+	WT_DSTAT_INCR(session, block_preallocate);
+	WT_RET(__wt_block_io_extend(session, block, off, len, &queued));
+	if (!queued)
+		__wt_block_preallocate(session, block, off, len);
+	return (0);
+}
+
 /*
  * __block_extend --
  *	Extend the file to allocate space.
@@ -450,6 +524,7 @@ __block_extend(
     WT_SESSION_IMPL *session, WT_BLOCK *block, off_t *offp, off_t size)
 {
 	WT_FH *fh;
+	off_t off;
 
 	fh = block->fh;
 
@@ -482,6 +557,21 @@ __block_extend(
 	    "file extend %" PRIdMAX "B @ %" PRIdMAX,
 	    (intmax_t)size, (intmax_t)*offp);
 
+	/*
+	 * Optionally preallocate file space ahead of the writes extending the
+	 * file: once the end of the file passes the middle of the last chunk
+	 * preallocated, schedule the next chunk.  We're holding the live lock,
+	 * the preallocation is started once the lock is released, see
+	 * __wt_block_preallocate_pending.
+	 */
+	if (block->extend_size != 0 && block->extend_pending == 0 &&
+	    fh->file_size + block->extend_size / 2 > block->extend_len) {
+		off = WT_MAX(block->extend_len, fh->file_size);
+		block->extend_len = off + block->extend_size;
+		block->extend_off = off;
+		block->extend_pending = block->extend_size;
+	}
+
 	return (0);
 }
 
@@ -495,6 +585,7 @@ __wt_block_alloc(
 {
 	WT_EXT *ext;
 	WT_SIZE *szp, **sstack[WT_SKIP_MAXDEPTH];
+	off_t cls;
 
 	WT_DSTAT_INCR(session, block_alloc);
 	if (size % block->allocsize != 0)
@@ -509,9 +600,36 @@ __wt_block_alloc(
 	 * the by-size offset list.  This means we prefer best-fit over lower
 	 * offset, but within a size we'll prefer an offset appearing earlier
 	 * in the file.  If we don't have anything big enough, extend the file.
+	 *
+	 * In segregated allocation mode, unless the file is being compacted,
+	 * first take the most recently freed extent of exactly the requested
+	 * size, and merge all of the per-size lists into the avail list before
+	 * extending the file.
 	 */
+	cls = size / block->allocsize - 1;
+	if (block->alloc_segregated && block->compact_ckpts == 0 &&
+	    cls < WT_BLOCK_SIZE_CLASSES &&
+	    (ext = block->size_class[cls]) != NULL) {
+		block->size_class[cls] = ext->next[0];
+		--block->size_class_cnt;
+		*offp = ext->off;
+		__block_ext_free(session, block, ext);
+
+		WT_DSTAT_INCR(session, block_alloc_segregated);
+		WT_VERBOSE_RET(session, block,
+		    "allocate range %" PRIdMAX "-%" PRIdMAX
+		    " from the per-size free list",
+		    (intmax_t)*offp, (intmax_t)(*offp + size));
+		goto done;
+	}
+
 	__block_size_srch(block->live.avail.sz, size, sstack);
 	szp = *sstack[0];
+	if (szp == NULL && block->size_class_cnt != 0) {
+		WT_RET(__wt_block_size_class_flush(session, block));
+		__block_size_srch(block->live.avail.sz, size, sstack);
+		szp = *sstack[0];
+	}
 	if (szp == NULL) {
 		WT_RET(__block_extend(session, block, offp, size));
 		goto done;
@@ -550,6 +668,82 @@ done:	/* Add the newly allocated extent to the list of allocations. */
 	return (0);
 }
 
+/*
+ * __block_avail_free --
+ *	Free a range allocated in the live checkpoint to the avail list, or in
+ * segregated allocation mode, to a per-size free list.  Extents on the per-size
+ * lists aren't coalesced with their neighbors, limit the number of extents on
+ * the lists.
+ */
+static int
+__block_avail_free(
+    WT_SESSION_IMPL *session, WT_BLOCK *block, off_t off, off_t size)
+{
+	WT_EXT *ext;
+	off_t cls;
+
+	cls = size / block->allocsize - 1;
+	if (block->alloc_segregated && block->compact_ckpts == 0 &&
+	    size % block->allocsize == 0 && cls < WT_BLOCK_SIZE_CLASSES) {
+		if (block->size_class_cnt >= WT_BLOCK_SIZE_CLASS_MAX)
+			WT_RET(__wt_block_size_class_flush(session, block));
+
+		WT_RET(__block_ext_alloc(session, block, &ext));
+		ext->off = off;
+		ext->size = size;
+		ext->next[0] = block->size_class[cls];
+		block->size_class[cls] = ext;
+		++block->size_class_cnt;
+		return (0);
+	}
+	return (__block_merge(session, block, &block->live.avail, off, size));
+}
+
+/*
+ * __wt_block_size_class_flush --
+ *	Merge the per-size free lists into the live avail list, coalescing each
+ * extent with any adjacent free extents.
+ */
+int
+__wt_block_size_class_flush(WT_SESSION_IMPL *session, WT_BLOCK *block)
+{
+	WT_EXT *ext;
+	u_int i;
+
+	/*
+	 * Callers of this function are expected to have already acquired any
+	 * locks required to manipulate the extent lists.
+	 */
+	for (i = 0;
+	    block->size_class_cnt != 0 && i < WT_BLOCK_SIZE_CLASSES; ++i)
+		while ((ext = block->size_class[i]) != NULL) {
+			WT_RET(__block_merge(session,
+			    block, &block->live.avail, ext->off, ext->size));
+			block->size_class[i] = ext->next[0];
+			--block->size_class_cnt;
+			__block_ext_free(session, block, ext);
+		}
+	return (0);
+}
+
+/*
+ * __wt_block_size_class_discard --
+ *	Discard the per-size free lists.
+ */
+void
+__wt_block_size_class_discard(WT_SESSION_IMPL *session, WT_BLOCK *block)
+{
+	WT_EXT *ext;
+	u_int i;
+
+	for (i = 0; i < WT_BLOCK_SIZE_CLASSES; ++i)
+		while ((ext = block->size_class[i]) != NULL) {
+			block->size_class[i] = ext->next[0];
+			__wt_free(session, ext);
+		}
+	block->size_class_cnt = 0;
+}
+
 /*
  * __wt_block_free --
  *	Free a cookie-referenced chunk of space to the underlying file.
@@ -603,8 +797,7 @@ __wt_block_off_free(
 	 */
 	if ((ret = __wt_block_off_remove_overlap(
 	    session, block, &block->live.alloc, offset, size)) == 0)
-		ret = __block_merge(
-		    session, block, &block->live.avail, offset, (off_t)size);
+		ret = __block_avail_free(session, block, offset, size);
 	else if (ret == WT_NOTFOUND)
 		ret = __block_merge(
 		    session, block, &block->live.discard, offset, (off_t)size);
@@ -1224,11 +1417,17 @@ __wt_block_extlist_truncate(
 	 * We're about to remove the extent list entry, save the value, we need
 	 * it to reset the cached file size, and that can't happen until after
 	 * truncate and extent list removal succeed.
+	 *
+	 * Queued writes to the freed space would extend the file again, wait
+	 * for them first.  Truncation discards any preallocated space.
 	 */
 	file_size = ext->off;
+	WT_RET(__wt_block_io_wait(session, block, (off_t)0, 0));
 	WT_RET(__wt_ftruncate(session, fh, file_size));
 	WT_RET(__block_off_remove(session, block, el, file_size, NULL));
 	fh->file_size = file_size;
+	block->extend_len = file_size;
+	block->extend_pending = 0;
 
 	return (0);
 }
@@ -0,0 +1,504 @@
+/*-
+ * Copyright (c) 2008-2013 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+/*
+ * __block_io_remove --
+ *	Remove a write from the queue, called with the I/O lock held.
+ */
+static void
+__block_io_remove(WT_SESSION_IMPL *session, WT_BLOCK_IO *io)
+{
+	WT_CONNECTION_IMPL *conn;
+
+	conn = S2C(session);
+
+	TAILQ_REMOVE(&conn->ioqh, io, q);
+	if (!io->extend)
+		conn->io_bytes -= io->size;
+	--io->block->io_pending;
+}
+
+/*
+ * __block_io_wake --
+ *	Wake the threads waiting for queued writes, called with the I/O lock
+ * held after a queued write completes or fails.
+ */
+static int
+__block_io_wake(WT_SESSION_IMPL *session)
+{
+	WT_BLOCK_IO_WAITER *waiter;
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+
+	conn = S2C(session);
+
+	TAILQ_FOREACH(waiter, &conn->iowaitqh, q)
+		WT_TRET(__wt_cond_signal(session, waiter->cond));
+	return (ret);
+}
+
+/*
+ * __block_io_sleep --
+ *	Wait for a queued write to complete or fail, called with the I/O lock
+ * held, returns with it released.
+ */
+static int
+__block_io_sleep(WT_SESSION_IMPL *session)
+{
+	WT_BLOCK_IO_WAITER waiter;
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+
+	conn = S2C(session);
+
+	/*
+	 * Signals are remembered by the condition variable, a write completing
+	 * after we release the lock and before we wait still wakes us.
+	 */
+	waiter.cond = session->cond;
+	TAILQ_INSERT_TAIL(&conn->iowaitqh, &waiter, q);
+	__wt_spin_unlock(session, &conn->io_lock);
+
+	ret = __wt_cond_wait(session, session->cond, 0);
+
+	__wt_spin_lock(session, &conn->io_lock);
+	TAILQ_REMOVE(&conn->iowaitqh, &waiter, q);
+	__wt_spin_unlock(session, &conn->io_lock);
+	return (ret);
+}
+
+/*
+ * __block_io_free --
+ *	Free a write removed from the queue.
+ */
+static void
+__block_io_free(WT_SESSION_IMPL *session, WT_BLOCK_IO *io)
+{
+	__wt_buf_free(session, &io->buf);
+	__wt_free(session, io);
+}
+
+/*
+ * __block_io_thread --
+ *	A block I/O thread: write queued blocks until the queue is shut down
+ * and empty.
+ */
+static void *
+__block_io_thread(void *arg)
+{
+	WT_BLOCK *block;
+	WT_BLOCK_IO *io;
+	WT_BLOCK_IO_THREAD *thread;
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+	WT_SESSION_IMPL *session;
+	int run, tret;
+
+	thread = arg;
+	session = thread->session;
+	conn = S2C(session);
+
+	for (;;) {
+		/* Claim the oldest write no other thread is doing. */
+		__wt_spin_lock(session, &conn->io_lock);
+		TAILQ_FOREACH(io, &conn->ioqh, q)
+			if (!io->active && io->error == 0)
+				break;
+		if (io != NULL)
+			io->active = 1;
+		run = conn->io_run;
+		__wt_spin_unlock(session, &conn->io_lock);
+
+		if (io == NULL) {
+			if (!run)
+				break;
+			WT_ERR(__wt_cond_wait(session, session->cond, 100000));
+			continue;
+		}
+
+		block = io->block;
+		if (io->extend)
+			__wt_block_preallocate(
+			    session, block, io->offset, (off_t)io->size);
+		else
+			ret = __wt_write(session,
+			    block->fh, io->offset, io->size, io->buf.mem);
+
+		/*
+		 * A failed write stays queued with its copy of the block:
+		 * reads of the block are satisfied from the copy, and the next
+		 * sync, checkpoint or close of the file retries the write and
+		 * returns any error.  Once unlocked, a failed write may be
+		 * removed from the queue by another thread.
+		 */
+		__wt_spin_lock(session, &conn->io_lock);
+		io->active = 0;
+		if (ret == 0)
+			__block_io_remove(session, io);
+		else
+			io->error = ret;
+		tret = __block_io_wake(session);
+		__wt_spin_unlock(session, &conn->io_lock);
+
+		if (ret == 0)
+			__block_io_free(session, io);
+		else
+			__wt_err(session, ret,
+			    "%s: background write", block->name);
+		ret = 0;
+		WT_ERR(tret);
+	}
+
+	if (0) {
+err:		WT_PANIC_ERR(session, ret, "block I/O thread error");
+	}
+	return (NULL);
+}
+
+/*
+ * __wt_block_io_create --
+ *	Start the block I/O threads.
+ */
+int
+__wt_block_io_create(WT_CONNECTION_IMPL *conn, const char *cfg[])
+{
+	WT_BLOCK_IO_THREAD *thread;
+	WT_CONFIG_ITEM cval;
+	WT_DECL_RET;
+	WT_SESSION_IMPL *s, *session;
+	u_int i;
+
+	session = conn->default_session;
+
+	WT_RET(__wt_config_gets(session, cfg, "io_threads", &cval));
+	if (cval.val == 0)
+		return (0);
+
+	WT_RET(__wt_calloc_def(session, (size_t)cval.val, &conn->io_thread));
+	conn->io_threads = (u_int)cval.val;
+	conn->io_run = 1;
+
+	/*
+	 * Threads with a session are running, clear the session if the thread
+	 * can't be started.
+	 */
+	for (i = 0; i < conn->io_threads; i++) {
+		thread = &conn->io_thread[i];
+		WT_RET(__wt_open_session(conn, 1, NULL, NULL, &s));
+		s->name = "block-io-thread";
+		thread->session = s;
+		if ((ret = __wt_thread_create(session,
+		    &thread->tid, __block_io_thread, thread)) != 0) {
+			thread->session = NULL;
+			WT_TRET(s->iface.close(&s->iface, NULL));
+			__wt_free(session, s->hazard);
+			return (ret);
+		}
+	}
+	return (0);
+}
+
+/*
+ * __wt_block_io_destroy --
+ *	Stop queueing block writes, and shut down the block I/O threads once
+ * the queue is empty.
+ */
+int
+__wt_block_io_destroy(WT_CONNECTION_IMPL *conn)
+{
+	WT_BLOCK_IO_THREAD *thread;
+	WT_DECL_RET;
+	WT_SESSION_IMPL *session;
+	u_int i;
+
+	session = conn->default_session;
+
+	if (conn->io_thread == NULL)
+		return (0);
+
+	__wt_spin_lock(session, &conn->io_lock);
+	conn->io_run = 0;
+	__wt_spin_unlock(session, &conn->io_lock);
+
+	for (i = 0; i < conn->io_threads; i++) {
+		thread = &conn->io_thread[i];
+		if (thread->session == NULL)
+			continue;
+		WT_TRET(__wt_cond_signal(session, thread->session->cond));
+		WT_TRET(__wt_thread_join(session, thread->tid));
+
+		/* Close the thread's session and free its hazard array. */
+		WT_TRET(thread->session->iface.close(
+		    &thread->session->iface, NULL));
+		__wt_free(session, thread->session->hazard);
+	}
+	__wt_free(session, conn->io_thread);
+	conn->io_threads = 0;
+
+	return (ret);
+}
+
+/*
+ * __wt_block_io_write --
+ *	Queue a block write for the I/O threads.  If there are no I/O threads
+ * or the queue is full, return without queueing the write, the caller writes
+ * the block itself.
+ */
+int
+__wt_block_io_write(WT_SESSION_IMPL *session, WT_BLOCK *block,
+    off_t offset, uint32_t size, const void *mem, int *queuedp)
+{
+	WT_BLOCK_IO *io;
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+	int queued;
+
+	conn = S2C(session);
+	*queuedp = queued = 0;
+
+	/* Check without the lock first, the test is repeated. */
+	if (!conn->io_run || conn->io_bytes + size > WT_BLOCK_IO_QUEUE_MAX)
+		return (0);
+
+	/* The caller's buffer is reused as soon as we return, copy it. */
+	WT_RET(__wt_calloc_def(session, 1, &io));
+	F_SET(&io->buf, WT_ITEM_ALIGNED);
+	WT_ERR(__wt_buf_initsize(session, &io->buf, size));
+	memcpy(io->buf.mem, mem, size);
+	io->block = block;
+	io->offset = offset;
+	io->size = size;
+
+	__wt_spin_lock(session, &conn->io_lock);
+	if (conn->io_run && conn->io_bytes + size <= WT_BLOCK_IO_QUEUE_MAX) {
+		TAILQ_INSERT_TAIL(&conn->ioqh, io, q);
+		conn->io_bytes += size;
+		++block->io_pending;
+		queued = 1;
+	}
+	__wt_spin_unlock(session, &conn->io_lock);
+	if (!queued)
+		goto err;
+
+	*queuedp = 1;
+	WT_CSTAT_INCR(session, block_write_background);
+	return (__wt_cond_signal(session, conn->io_thread[
+	    WT_ATOMIC_ADD(conn->io_next, 1) % conn->io_threads].session->cond));
+
+err:	__wt_buf_free(session, &io->buf);
+	__wt_free(session, io);
+	return (ret);
+}
+
+/*
+ * __wt_block_io_extend --
+ *	Queue a preallocation of file space for the I/O threads.  If there are
+ * no I/O threads, return without queueing it.
+ */
+int
+__wt_block_io_extend(WT_SESSION_IMPL *session,
+    WT_BLOCK *block, off_t offset, off_t len, int *queuedp)
+{
+	WT_BLOCK_IO *io;
+	WT_CONNECTION_IMPL *conn;
+	int queued;
+
+	conn = S2C(session);
+	*queuedp = queued = 0;
+
+	if (!conn->io_run)
+		return (0);
+
+	WT_RET(__wt_calloc_def(session, 1, &io));
+	io->block = block;
+	io->offset = offset;
+	io->size = (uint32_t)len;
+	io->extend = 1;
+
+	__wt_spin_lock(session, &conn->io_lock);
+	if (conn->io_run) {
+		TAILQ_INSERT_TAIL(&conn->ioqh, io, q);
+		++block->io_pending;
+		queued = 1;
+	}
+	__wt_spin_unlock(session, &conn->io_lock);
+	if (!queued) {
+		__wt_free(session, io);
+		return (0);
+	}
+
+	*queuedp = 1;
+	return (__wt_cond_signal(session, conn->io_thread[
+	    WT_ATOMIC_ADD(conn->io_next, 1) % conn->io_threads].session->cond));
+}
+
+/*
+ * __block_io_retry --
+ *	Retry a file's failed background writes, in file order.
+ */
+static int
+__block_io_retry(WT_SESSION_IMPL *session, WT_BLOCK *block)
+{
+	WT_BLOCK_IO *io, *next;
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+	off_t offset;
+	int tret;
+
+	conn = S2C(session);
+
+	for (offset = -1;;) {
+		next = NULL;
+		__wt_spin_lock(session, &conn->io_lock);
+		TAILQ_FOREACH(io, &conn->ioqh, q)
+			if (io->block == block && io->error != 0 &&
+			    !io->active && io->offset > offset &&
+			    (next == NULL || io->offset < next->offset))
+				next = io;
+		if (next != NULL)
+			next->active = 1;
+		__wt_spin_unlock(session, &conn->io_lock);
+		if (next == NULL)
+			break;
+		offset = next->offset;
+
+		tret = __wt_write(session,
+		    block->fh, next->offset, next->size, next->buf.mem);
+
+		__wt_spin_lock(session, &conn->io_lock);
+		next->active = 0;
+		if (tret == 0)
+			__block_io_remove(session, next);
+		else
+			next->error = tret;
+		WT_TRET(__block_io_wake(session));
+		__wt_spin_unlock(session, &conn->io_lock);
+
+		if (tret == 0)
+			__block_io_free(session, next);
+		else if (ret == 0)
+			ret = tret;
+	}
+
+	if (ret != 0)
+		WT_RET_MSG(session, ret, "%s: background write", block->name);
+	return (0);
+}
+
+/*
+ * __wt_block_io_wait --
+ *	Wait for queued writes of a file to complete.  If size is non-zero, the
+ * range is about to be rewritten: wait for writes overlapping the range, and
+ * discard failed writes overlapping it, the space they were written to has
+ * been freed.  Otherwise, wait for all of the file's writes and preallocations,
+ * retrying failed writes and returning any error.
+ */
+int
+__wt_block_io_wait(
+    WT_SESSION_IMPL *session, WT_BLOCK *block, off_t offset, uint32_t size)
+{
+	WT_BLOCK_IO *io;
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+
+	conn = S2C(session);
+
+	while (block->io_pending != 0) {
+		__wt_spin_lock(session, &conn->io_lock);
+		TAILQ_FOREACH(io, &conn->ioqh, q)
+			if (io->block == block && (size == 0 || (!io->extend &&
+			    io->offset < offset + (off_t)size &&
+			    offset < io->offset + (off_t)io->size)) &&
+			    (io->active || io->error == 0 || size != 0))
+				break;
+		if (io == NULL) {
+			__wt_spin_unlock(session, &conn->io_lock);
+			break;
+		}
+
+		/* Discard a failed write, or wait for the write to finish. */
+		if (io->active || io->error == 0) {
+			WT_RET(__block_io_sleep(session));
+			continue;
+		}
+		__block_io_remove(session, io);
+		ret = __block_io_wake(session);
+		__wt_spin_unlock(session, &conn->io_lock);
+		__block_io_free(session, io);
+		WT_RET(ret);
+	}
+
+	return (size == 0 ? __block_io_retry(session, block) : 0);
+}
+
+/*
+ * __wt_block_io_read --
+ *	Read a block from the queue of writes: if a write of the block is
+ * queued, copy the block from it, otherwise wait for any write overlapping the
+ * block to complete.
+ */
+int
+__wt_block_io_read(WT_SESSION_IMPL *session,
+    WT_BLOCK *block, off_t offset, uint32_t size, void *mem, int *foundp)
+{
+	WT_BLOCK_IO *io;
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+
+	conn = S2C(session);
+	*foundp = 0;
+
+	while (block->io_pending != 0) {
+		__wt_spin_lock(session, &conn->io_lock);
+		TAILQ_FOREACH(io, &conn->ioqh, q)
+			if (io->block == block && !io->extend &&
+			    io->offset < offset + (off_t)size &&
+			    offset < io->offset + (off_t)io->size)
+				break;
+		if (io != NULL && io->offset == offset && io->size == size) {
+			memcpy(mem, io->buf.mem, size);
+			*foundp = 1;
+		} else if (io != NULL && io->error != 0)
+			ret = io->error;
+		if (io == NULL || *foundp || ret != 0) {
+			__wt_spin_unlock(session, &conn->io_lock);
+			break;
+		}
+
+		/* Wait for the overlapping write to finish. */
+		WT_RET(__block_io_sleep(session));
+	}
+	if (ret != 0)
+		WT_RET_MSG(session, ret, "%s: background write", block->name);
+	return (0);
+}
+
+/*
+ * __wt_block_io_discard --
+ *	Discard a file's queued writes that couldn't be written when the file
+ * is closed.
+ */
+void
+__wt_block_io_discard(WT_SESSION_IMPL *session, WT_BLOCK *block)
+{
+	WT_BLOCK_IO *io, *next;
+	WT_CONNECTION_IMPL *conn;
+
+	conn = S2C(session);
+
+	__wt_spin_lock(session, &conn->io_lock);
+	for (io = TAILQ_FIRST(&conn->ioqh); io != NULL; io = next) {
+		next = TAILQ_NEXT(io, q);
+		if (io->block == block) {
+			__block_io_remove(session, io);
+			__block_io_free(session, io);
+		}
+	}
+	__wt_spin_unlock(session, &conn->io_lock);
+}
@@ -73,6 +73,13 @@ __block_destroy(WT_SESSION_IMPL *session, WT_BLOCK *block)
 	conn = S2C(session);
 	TAILQ_REMOVE(&conn->blockqh, block, q);
 
+	/*
+	 * Wait for any queued writes before closing the file, discarding writes
+	 * that failed again.
+	 */
+	ret = __wt_block_io_wait(session, block, (off_t)0, 0);
+	__wt_block_io_discard(session, block);
+
 	if (block->name != NULL)
 		__wt_free(session, block->name);
 
@@ -127,6 +134,11 @@ __wt_block_open(WT_SESSION_IMPL *session, const char *filename,
 	WT_ERR(__wt_config_gets(session, cfg, "allocation_size", &cval));
 	block->allocsize = (uint32_t)cval.val;
 
+	/* Configuration: block allocation. */
+	WT_ERR(__wt_config_gets(session, cfg, "block_allocation", &cval));
+	block->alloc_segregated =
+	    WT_STRING_MATCH("segregated", cval.str, cval.len) ? 1 : 0;
+
 	/* Configuration: optional OS buffer cache maximum size. */
 	WT_ERR(__wt_config_gets(session, cfg, "os_cache_max", &cval));
 	block->os_cache_max = cval.val;
@@ -156,6 +168,19 @@ __wt_block_open(WT_SESSION_IMPL *session, const char *filename,
 		    "available");
 #endif
 
+	/* Configuration: optional file space preallocation. */
+	WT_ERR(__wt_config_gets(session, cfg, "file_extend", &cval));
+	block->extend_size = (off_t)cval.val;
+#ifndef HAVE_FALLOCATE
+	/* Preallocation is advisory, ignore it if fallocate isn't available. */
+	if (block->extend_size) {
+		block->extend_size = 0;
+		WT_VERBOSE_ERR(session, block,
+		    "%s: file_extend ignored, fallocate not available",
+		    filename);
+	}
+#endif
+
 	/* Open the underlying file handle. */
 	WT_ERR(__wt_open(session, filename, 0, 0, 1, &block->fh));
 
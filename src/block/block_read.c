@@ -7,6 +7,53 @@
 
 #include "wt_internal.h"
 
+/*
+ * __wt_bm_preload --
+ *	Start reading an address cookie referenced block into the system's
+ * buffer cache, without waiting for it.
+ */
+int
+__wt_bm_preload(WT_BM *bm,
+    WT_SESSION_IMPL *session, const uint8_t *addr, uint32_t addr_size)
+{
+	WT_BLOCK *block;
+	off_t offset;
+	uint32_t cksum, size;
+
+	WT_UNUSED(addr_size);
+	block = bm->block;
+
+	/* Crack the cookie. */
+	WT_RET(__wt_block_buffer_to_addr(block, addr, &offset, &size, &cksum));
+
+	/*
+	 * Fault in mapped blocks, otherwise let the system read the file.  The
+	 * read-ahead is only advice: if the system won't take it, the block is
+	 * read when it's needed, don't fail the caller.
+	 */
+	if (bm->map != NULL && offset + size <= (off_t)bm->maplen)
+		WT_RET(__wt_mmap_preload(
+		    session, (uint8_t *)bm->map + offset, size));
+	else {
+#ifdef HAVE_POSIX_FADVISE
+		WT_DECL_RET;
+
+		if ((ret = posix_fadvise(block->fh->fd,
+		    offset, (off_t)size, POSIX_FADV_WILLNEED)) != 0) {
+			WT_VERBOSE_RET(session, read,
+			    "%s: posix_fadvise: %s",
+			    block->name, wiredtiger_strerror(ret));
+			return (0);
+		}
+#else
+		return (0);
+#endif
+	}
+
+	WT_CSTAT_INCR(session, block_preload);
+	return (0);
+}
+
 /*
  * __wt_bm_read --
  *	Map or read address cookie referenced block into a buffer.
@@ -65,11 +112,13 @@ __wt_bm_read(WT_BM *bm, WT_SESSION_IMPL *session,
 	    (block->os_cache += size) > block->os_cache_max) {
 		WT_DECL_RET;
 
+		/* The block has been read, the discard is only advice. */
 		block->os_cache = 0;
 		if ((ret = posix_fadvise(block->fh->fd,
 		    (off_t)0, (off_t)0, POSIX_FADV_DONTNEED)) != 0)
-			WT_RET_MSG(
-			    session, ret, "%s: posix_fadvise", block->name);
+			WT_VERBOSE_RET(session, read,
+			    "%s: posix_fadvise: %s",
+			    block->name, wiredtiger_strerror(ret));
 	}
 #endif
 	return (0);
@@ -85,6 +134,7 @@ __wt_block_read_off(WT_SESSION_IMPL *session,
 {
 	WT_BLOCK_HEADER *blk;
 	uint32_t alloc_size, page_cksum;
+	int queued;
 
 	WT_VERBOSE_RET(session, read,
 	    "off %" PRIuMAX ", size %" PRIu32 ", cksum %" PRIu32,
@@ -111,6 +161,9 @@ __wt_block_read_off(WT_SESSION_IMPL *session,
 	 * an easy fix: set the flag and guarantee we reallocate it.  (Most of
 	 * the time on reads, the buffer memory has not yet been allocated, so
 	 * we're not adding any additional processing time.)
+	 *
+	 * The block may be queued to be written by a block I/O thread, copy it
+	 * from the queue if so.
 	 */
 	if (F_ISSET(buf, WT_ITEM_ALIGNED))
 		alloc_size = size;
@@ -119,7 +172,10 @@ __wt_block_read_off(WT_SESSION_IMPL *session,
 		alloc_size = (uint32_t)WT_MAX(size, buf->memsize + 10);
 	}
 	WT_RET(__wt_buf_init(session, buf, alloc_size));
-	WT_RET(__wt_read(session, block->fh, offset, size, buf->mem));
+	WT_RET(__wt_block_io_read(
+	    session, block, offset, size, buf->mem, &queued));
+	if (!queued)
+		WT_RET(__wt_read(session, block->fh, offset, size, buf->mem));
 	buf->size = size;
 
 	blk = WT_BLOCK_HEADER_REF(buf->mem);
@@ -71,6 +71,7 @@ __wt_block_write_off(WT_SESSION_IMPL *session, WT_BLOCK *block,
 	WT_DECL_RET;
 	off_t offset;
 	uint32_t align_size;
+	int queued;
 
 	blk = WT_BLOCK_HEADER_REF(buf->mem);
 
@@ -131,8 +132,30 @@ __wt_block_write_off(WT_SESSION_IMPL *session, WT_BLOCK *block,
 		__wt_spin_unlock(session, &block->live_lock);
 	WT_RET(ret);
 
-	if ((ret = __wt_write(
-	    session, block->fh, offset, align_size, buf->mem)) != 0) {
+	/*
+	 * Start any file preallocation the allocation scheduled, it's done
+	 * after releasing the live lock.  If our caller holds the lock, the
+	 * next write not made under the lock starts it.
+	 */
+	if (!locked)
+		WT_RET(__wt_block_preallocate_pending(session, block));
+
+	/*
+	 * The space may have been freed and re-allocated while an earlier write
+	 * to it is queued: wait for that write, the writes must not be done out
+	 * of order.  Queue ordinary writes for the block I/O threads, writes
+	 * made while checkpointing the file (when the caller holds the lock),
+	 * are done immediately.
+	 */
+	queued = 0;
+	if ((ret = __wt_block_io_wait(
+	    session, block, offset, align_size)) == 0 && !locked)
+		ret = __wt_block_io_write(
+		    session, block, offset, align_size, buf->mem, &queued);
+	if (ret == 0 && !queued)
+		ret = __wt_write(
+		    session, block->fh, offset, align_size, buf->mem);
+	if (ret != 0) {
 		if (!locked)
 			__wt_spin_lock(session, &block->live_lock);
 		WT_TRET(
@@ -223,12 +223,87 @@ __wt_bloom_finalize(WT_BLOOM *bloom)
 	}
 
 err:	WT_TRET(c->close(c));
-	__wt_free(bloom->session, bloom->bitstring);
-	bloom->bitstring = NULL;
 
+	/* Lookups can use the bitstring we already have in memory. */
+	if (ret == 0)
+		bloom->bitmap = bloom->bitstring;
 	return (ret);
 }
 
+/*
+ * __bloom_read --
+ *	Read a finalized Bloom filter's bits from its table.
+ */
+static int
+__bloom_read(WT_BLOOM *bloom, uint8_t **bitsp)
+{
+	WT_CURSOR *c;
+	WT_DECL_RET;
+	uint64_t recno;
+	uint8_t bit, *bits;
+
+	c = bloom->c;
+	WT_RET(__bit_alloc(bloom->session, bloom->m, &bits));
+
+	/*
+	 * The table is a bitmap: set the bits, offset by one because
+	 * WiredTiger tables are 1 based.
+	 */
+	while ((ret = c->next(c)) == 0) {
+		WT_ERR(c->get_key(c, &recno));
+		WT_ERR(c->get_value(c, &bit));
+		if (bit != 0 && recno <= bloom->m)
+			__bit_set(bits, recno - 1);
+	}
+	WT_ERR_NOTFOUND_OK(ret);
+	WT_ERR(c->reset(c));
+
+	*bitsp = bits;
+	return (0);
+
+err:	__wt_free(bloom->session, bits);
+	return (ret);
+}
+
+/*
+ * __wt_bloom_load --
+ *	Load a finalized Bloom filter into memory, so lookups test bits rather
+ *	than searching the filter's table.  The filter's bits are shared through
+ *	the caller's slot: the first handle to load a filter publishes its copy,
+ *	and the caller owns (and eventually frees) the published copy.  Handles
+ *	using the shared copy keep a cursor open on the table, which stops the
+ *	filter from being dropped while it is in use.
+ */
+int
+__wt_bloom_load(WT_BLOOM *bloom, uint8_t **bitsp)
+{
+	uint8_t *bits;
+
+	/* The cursor pins the filter's table, open it first. */
+	WT_RET(__bloom_open_cursor(bloom, NULL));
+
+	if ((bits = *bitsp) != NULL) {
+		bloom->bitmap = bits;
+		return (0);
+	}
+
+	/*
+	 * Publish the bitstring from a filter we just finalized, otherwise
+	 * read the filter.  If we race with another thread loading the same
+	 * filter, use its copy.
+	 */
+	if (bloom->bitstring != NULL) {
+		if (WT_ATOMIC_CAS(*bitsp, NULL, bloom->bitstring))
+			bloom->bitstring = NULL;
+	} else {
+		WT_RET(__bloom_read(bloom, &bits));
+		if (!WT_ATOMIC_CAS(*bitsp, NULL, bits))
+			__wt_free(bloom->session, bits);
+	}
+	bloom->bitmap = *bitsp;
+	return (0);
+}
+
 /*
  * __wt_bloom_hash --
  *	Calculate the hash values for a given key.
@@ -259,6 +334,17 @@ __wt_bloom_hash_get(WT_BLOOM *bloom, WT_BLOOM_HASH *bhash)
 	uint64_t h1, h2;
 	uint8_t bit;
 
+	h1 = bhash->h1;
+	h2 = bhash->h2;
+
+	/* If the filter is in memory, test the bits directly. */
+	if (bloom->bitmap != NULL) {
+		for (i = 0; i < bloom->k; i++, h1 += h2)
+			if (!__bit_test(bloom->bitmap, h1 % bloom->m))
+				return (WT_NOTFOUND);
+		return (0);
+	}
+
 	/* Get operations are only supported by finalized bloom filters. */
 	WT_ASSERT(bloom->session, bloom->bitstring == NULL);
 
@@ -266,9 +352,6 @@ __wt_bloom_hash_get(WT_BLOOM *bloom, WT_BLOOM_HASH *bhash)
 	WT_ERR(__bloom_open_cursor(bloom, NULL));
 	c = bloom->c;
 
-	h1 = bhash->h1;
-	h2 = bhash->h2;
-
 	result = 0;
 	for (i = 0; i < bloom->k; i++, h1 += h2) {
 		/*
@@ -130,6 +130,7 @@ __wt_btcur_reset(WT_CURSOR_BTREE *cbt)
 int
 __wt_btcur_search(WT_CURSOR_BTREE *cbt)
 {
+	struct timespec start;
 	WT_BTREE *btree;
 	WT_CURSOR *cursor;
 	WT_DECL_RET;
@@ -141,6 +142,7 @@ __wt_btcur_search(WT_CURSOR_BTREE *cbt)
 
 	WT_CSTAT_INCR(session, cursor_search);
 	WT_DSTAT_INCR(session, cursor_search);
+	WT_CSTAT_LATENCY_START(session, start);
 
 	if (btree->type == BTREE_ROW)
 		WT_RET(__cursor_size_chk(session, &cursor->key));
@@ -168,6 +170,7 @@ retry:	WT_RET(__cursor_func_init(cbt, 1));
 err:	if (ret == WT_RESTART)
 		goto retry;
 	WT_TRET(__cursor_func_resolve(cbt, ret));
+	WT_CSTAT_LATENCY(session, latency_search, start);
 	return (ret);
 }
 
@@ -248,6 +251,7 @@ err:	if (ret == WT_RESTART)
 int
 __wt_btcur_insert(WT_CURSOR_BTREE *cbt)
 {
+	struct timespec start;
 	WT_BTREE *btree;
 	WT_CURSOR *cursor;
 	WT_DECL_RET;
@@ -261,6 +265,7 @@ __wt_btcur_insert(WT_CURSOR_BTREE *cbt)
 	WT_DSTAT_INCR(session, cursor_insert);
 	WT_DSTAT_INCRV(session,
 	    cursor_insert_bytes, cursor->key.size + cursor->value.size);
+	WT_CSTAT_LATENCY_START(session, start);
 
 	if (btree->type == BTREE_ROW)
 		WT_RET(__cursor_size_chk(session, &cursor->key));
@@ -332,6 +337,230 @@ retry:	WT_RET(__cursor_func_init(cbt, 1));
 err:	if (ret == WT_RESTART)
 		goto retry;
 	WT_TRET(__cursor_func_resolve(cbt, ret));
+	WT_CSTAT_LATENCY(session, latency_insert, start);
+	return (ret);
+}
+
+/*
+ * __cursor_batch_sort --
+ *	Sort the keys of a batch operation, returning the order of the keys.
+ */
+static int
+__cursor_batch_sort(WT_SESSION_IMPL *session,
+    WT_BTREE *btree, WT_ITEM *keys, size_t *order, size_t *tmp, size_t nitems)
+{
+	size_t i, j, k, lo, mid, hi, width;
+	int cmp;
+
+	for (i = 0; i < nitems; ++i)
+		order[i] = i;
+
+	/*
+	 * A bottom-up merge sort; it's stable, so an insert of the same key
+	 * more than once behaves as it would if the keys weren't sorted.
+	 * Batches are often sorted or nearly so, don't merge runs that are
+	 * already in order.
+	 */
+	for (width = 1; width < nitems; width *= 2) {
+		for (lo = 0; lo < nitems; lo += 2 * width) {
+			mid = WT_MIN(lo + width, nitems);
+			hi = WT_MIN(lo + 2 * width, nitems);
+			cmp = -1;
+			if (mid < hi)
+				WT_RET(WT_BTREE_CMP(session, btree,
+				    &keys[order[mid - 1]], &keys[order[mid]],
+				    cmp));
+			if (cmp <= 0) {
+				memcpy(tmp + lo,
+				    order + lo, (hi - lo) * sizeof(size_t));
+				continue;
+			}
+			for (i = lo, j = mid, k = lo; i < mid && j < hi;) {
+				WT_RET(WT_BTREE_CMP(session, btree,
+				    &keys[order[i]], &keys[order[j]], cmp));
+				tmp[k++] = cmp <= 0 ? order[i++] : order[j++];
+			}
+			while (i < mid)
+				tmp[k++] = order[i++];
+			while (j < hi)
+				tmp[k++] = order[j++];
+		}
+		memcpy(order, tmp, nitems * sizeof(size_t));
+	}
+	return (0);
+}
+
+/*
+ * __wt_btcur_search_batch --
+ *	Search a row-store tree for a batch of keys.
+ */
+int
+__wt_btcur_search_batch(WT_CURSOR_BTREE *cbt,
+    WT_ITEM *keys, WT_ITEM *values, int *results, size_t nitems)
+{
+	WT_BTREE *btree;
+	WT_CURSOR *cursor;
+	WT_DECL_ITEM(buf);
+	WT_DECL_ITEM(tmp);
+	WT_DECL_RET;
+	WT_SESSION_IMPL *session;
+	size_t i, j, *order;
+
+	btree = cbt->btree;
+	cursor = &cbt->iface;
+	session = (WT_SESSION_IMPL *)cursor->session;
+
+	WT_CSTAT_INCRV(session, cursor_search, nitems);
+	WT_DSTAT_INCRV(session, cursor_search, nitems);
+
+	for (i = 0; i < nitems; ++i)
+		WT_RET(__cursor_size_chk(session, &keys[i]));
+
+	/*
+	 * Search for the keys in sorted order: keys on the same leaf page as
+	 * the previous key are found without descending the tree again.
+	 */
+	WT_RET(__wt_scr_alloc(session, 2 * nitems * sizeof(size_t), &tmp));
+	order = tmp->mem;
+	WT_ERR(__cursor_batch_sort(
+	    session, btree, keys, order, order + nitems, nitems));
+	WT_ERR(__wt_scr_alloc(session, 0, &buf));
+
+	WT_ERR(__cursor_func_init(cbt, 1));
+	for (j = 0; j < nitems; ++j) {
+		i = order[j];
+		cursor->key.data = keys[i].data;
+		cursor->key.size = keys[i].size;
+
+		/* On error, the search has released the page. */
+		while ((ret = __wt_row_search_page(session, cbt, 0)) != 0) {
+			cbt->page = NULL;
+			if (ret != WT_RESTART)
+				goto err;
+		}
+		if (cbt->compare != 0 || __cursor_invalid(cbt))
+			results[i] = WT_NOTFOUND;
+		else {
+			WT_ERR(__wt_kv_return(session, cbt));
+			values[i].size = cursor->value.size;
+			WT_ERR(__wt_cursor_batch_append(
+			    session, buf, &cursor->value));
+			results[i] = 0;
+		}
+	}
+	WT_ERR(__wt_cursor_batch_return(
+	    session, cursor, buf, values, results, order, nitems));
+
+err:	WT_TRET(__cursor_leave(cbt));
+	__cursor_search_clear(cbt);
+	__cursor_position_clear(cbt);
+
+	__wt_scr_free(&buf);
+	__wt_scr_free(&tmp);
+	return (ret);
+}
+
+/*
+ * Batch inserts release the leaf page they're inserting into at least this
+ * often, see __wt_btcur_insert_batch.
+ */
+#define	WT_BATCH_PAGE_ITEMS	100
+
+/*
+ * __wt_btcur_insert_batch --
+ *	Insert a batch of records into a row-store tree.
+ */
+int
+__wt_btcur_insert_batch(
+    WT_CURSOR_BTREE *cbt, WT_ITEM *keys, WT_ITEM *values, size_t nitems)
+{
+	WT_BTREE *btree;
+	WT_CURSOR *cursor;
+	WT_DECL_ITEM(tmp);
+	WT_DECL_RET;
+	WT_SESSION_IMPL *session;
+	size_t i, j, *order;
+
+	btree = cbt->btree;
+	cursor = &cbt->iface;
+	session = (WT_SESSION_IMPL *)cursor->session;
+
+	WT_CSTAT_INCRV(session, cursor_insert, nitems);
+	WT_DSTAT_INCRV(session, cursor_insert, nitems);
+
+	for (i = 0; i < nitems; ++i) {
+		WT_RET(__cursor_size_chk(session, &keys[i]));
+		WT_RET(__cursor_size_chk(session, &values[i]));
+		WT_DSTAT_INCRV(session,
+		    cursor_insert_bytes, keys[i].size + values[i].size);
+	}
+
+	/*
+	 * The tree is no longer empty: eviction should pay attention to it,
+	 * and it's no longer possible to bulk-load into it.
+	 */
+	btree->bulk_load_ok = 0;
+
+	/*
+	 * Insert the records in sorted order: keys on the same leaf page as
+	 * the previous key are inserted without descending the tree again.
+	 */
+	WT_RET(__wt_scr_alloc(session, 2 * nitems * sizeof(size_t), &tmp));
+	order = tmp->mem;
+	WT_ERR(__cursor_batch_sort(
+	    session, btree, keys, order, order + nitems, nitems));
+
+	WT_ERR(__cursor_func_init(cbt, 1));
+	for (j = 0; j < nitems; ++j) {
+		i = order[j];
+		cursor->key.data = keys[i].data;
+		cursor->key.size = keys[i].size;
+		cursor->value.data = values[i].data;
+		cursor->value.size = values[i].size;
+
+		/*
+		 * Don't hold one page pinned for the whole batch: regularly,
+		 * and as soon as the page grows too large, release it, wait
+		 * for space in the cache and search the tree again.  Acquiring
+		 * the page again queues it for forced eviction if it has grown
+		 * too large.
+		 */
+		if (cbt->page != NULL && (j % WT_BATCH_PAGE_ITEMS == 0 ||
+		    cbt->page->memory_footprint > btree->maxmempage)) {
+			ret = __wt_page_release(session, cbt->page);
+			cbt->page = NULL;
+			WT_ERR(ret);
+			WT_ERR(__wt_cache_full_check(session, 1));
+		}
+
+		/*
+		 * On error, the search has released the page; if the insert
+		 * has to be restarted, release the page and search the tree.
+		 */
+retry:		if ((ret = __wt_row_search_page(session, cbt, 1)) != 0) {
+			cbt->page = NULL;
+			if (ret == WT_RESTART)
+				goto retry;
+			goto err;
+		}
+		if (cbt->compare == 0 &&
+		    !__cursor_invalid(cbt) &&
+		    !F_ISSET(cursor, WT_CURSTD_OVERWRITE))
+			WT_ERR(WT_DUPLICATE_KEY);
+		if ((ret = __wt_row_modify(session, cbt, 0)) == WT_RESTART) {
+			ret = __wt_page_release(session, cbt->page);
+			cbt->page = NULL;
+			WT_ERR(ret);
+			goto retry;
+		}
+		WT_ERR(ret);
+	}
+
+err:	WT_TRET(__cursor_leave(cbt));
+	__cursor_search_clear(cbt);
+	__cursor_position_clear(cbt);
+
+	__wt_scr_free(&tmp);
 	return (ret);
 }
 
@@ -342,6 +571,7 @@ err:	if (ret == WT_RESTART)
 int
 __wt_btcur_remove(WT_CURSOR_BTREE *cbt)
 {
+	struct timespec start;
 	WT_BTREE *btree;
 	WT_CURSOR *cursor;
 	WT_DECL_RET;
@@ -354,6 +584,7 @@ __wt_btcur_remove(WT_CURSOR_BTREE *cbt)
 	WT_CSTAT_INCR(session, cursor_remove);
 	WT_DSTAT_INCR(session, cursor_remove);
 	WT_DSTAT_INCRV(session, cursor_remove_bytes, cursor->key.size);
+	WT_CSTAT_LATENCY_START(session, start);
 
 	if (btree->type == BTREE_ROW)
 		WT_RET(__cursor_size_chk(session, &cursor->key));
@@ -397,6 +628,7 @@ retry:	WT_RET(__cursor_func_init(cbt, 1));
 err:	if (ret == WT_RESTART)
 		goto retry;
 	WT_TRET(__cursor_func_resolve(cbt, ret));
+	WT_CSTAT_LATENCY(session, latency_remove, start);
 	return (ret);
 }
 
@@ -407,6 +639,7 @@ err:	if (ret == WT_RESTART)
 int
 __wt_btcur_update(WT_CURSOR_BTREE *cbt)
 {
+	struct timespec start;
 	WT_BTREE *btree;
 	WT_CURSOR *cursor;
 	WT_DECL_RET;
@@ -419,6 +652,7 @@ __wt_btcur_update(WT_CURSOR_BTREE *cbt)
 	WT_CSTAT_INCR(session, cursor_update);
 	WT_DSTAT_INCR(session, cursor_update);
 	WT_DSTAT_INCRV(session, cursor_update_bytes, cursor->value.size);
+	WT_CSTAT_LATENCY_START(session, start);
 
 	if (btree->type == BTREE_ROW)
 		WT_RET(__cursor_size_chk(session, &cursor->key));
@@ -461,6 +695,7 @@ retry:	WT_RET(__cursor_func_init(cbt, 1));
 err:	if (ret == WT_RESTART)
 		goto retry;
 	WT_TRET(__cursor_func_resolve(cbt, ret));
+	WT_CSTAT_LATENCY(session, latency_update, start);
 	return (ret);
 }
 
@@ -16,6 +16,9 @@ static void __free_skip_array(WT_SESSION_IMPL *, WT_INSERT_HEAD **, uint32_t);
 static void __free_skip_list(WT_SESSION_IMPL *, WT_INSERT *);
 static void __free_update(WT_SESSION_IMPL *, WT_UPDATE **, uint32_t);
 static void __free_update_list(WT_SESSION_IMPL *, WT_UPDATE *);
+#ifdef HAVE_DIAGNOSTIC
+static WT_HAZARD *__free_page_hazard(WT_SESSION_IMPL *, WT_PAGE *);
+#endif
 
 /*
  * __wt_page_out --
@@ -42,7 +45,7 @@ __wt_page_out(WT_SESSION_IMPL *session, WT_PAGE **pagep)
 #ifdef HAVE_DIAGNOSTIC
 	{
 	WT_HAZARD *hp;
-	if ((hp = __wt_page_hazard_check(session, page)) != NULL)
+	if ((hp = __free_page_hazard(session, page)) != NULL)
 		__wt_errx(session,
 		    "discarded page has hazard pointer: (%p: %s, line %d)",
 		    hp->page, hp->file, hp->line);
@@ -83,6 +86,40 @@ __wt_page_out(WT_SESSION_IMPL *session, WT_PAGE **pagep)
 	__wt_overwrite_and_free(session, page);
 }
 
+#ifdef HAVE_DIAGNOSTIC
+/*
+ * __free_page_hazard --
+ *	Return a hazard pointer to the page, if there is one in the system.
+ */
+static WT_HAZARD *
+__free_page_hazard(WT_SESSION_IMPL *session, WT_PAGE *page)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_HAZARD *hp;
+	WT_SESSION_IMPL *s;
+	uint32_t i, hazard_size, session_cnt;
+
+	conn = S2C(session);
+
+	/*
+	 * Review every session's hazard pointers: the page has been unlinked
+	 * from its reference, there's no pin count to check.  No lock is
+	 * required because the session array is fixed size, but it may
+	 * contain inactive entries.
+	 */
+	WT_ORDERED_READ(session_cnt, conn->session_cnt);
+	for (s = conn->sessions, i = 0; i < session_cnt; ++s, ++i) {
+		if (!s->active)
+			continue;
+		WT_ORDERED_READ(hazard_size, s->hazard_size);
+		for (hp = s->hazard; hp < s->hazard + hazard_size; ++hp)
+			if (hp->page == page)
+				return (hp);
+	}
+	return (NULL);
+}
+#endif
+
 /*
  * __free_page_modify --
  *	Discard the page's associated modification structures.
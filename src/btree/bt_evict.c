@@ -15,6 +15,8 @@ static int  __evict_lru_cmp(const void *, const void *);
 static int  __evict_walk(WT_SESSION_IMPL *, uint32_t *, int);
 static int  __evict_walk_file(WT_SESSION_IMPL *, u_int *, int);
 static int  __evict_worker(WT_SESSION_IMPL *);
+static int  __evict_workers_start(WT_SESSION_IMPL *);
+static int  __evict_workers_stop(WT_SESSION_IMPL *);
 
 /*
  * __evict_read_gen --
@@ -278,6 +280,9 @@ __wt_cache_evict_server(void *arg)
 	conn = S2C(session);
 	cache = conn->cache;
 
+	/* Start the eviction worker threads, if any are configured. */
+	WT_ERR(__evict_workers_start(session));
+
 	while (F_ISSET(conn, WT_CONN_EVICTION_RUN)) {
 		/* Evict pages from the cache as needed. */
 		WT_ERR(__evict_worker(session));
@@ -312,6 +317,9 @@ __wt_cache_evict_server(void *arg)
 	} else
 err:		WT_PANIC_ERR(session, ret, "eviction server error");
 
+	if ((ret = __evict_workers_stop(session)) != 0)
+		WT_PANIC_ERR(session, ret, "eviction worker error");
+
 	/* Close the eviction session and free its hazard array. */
 	(void)session->iface.close(&session->iface, NULL);
 	__wt_free(conn->default_session, session->hazard);
@@ -319,6 +327,153 @@ err:		WT_PANIC_ERR(session, ret, "eviction server error");
 	return (NULL);
 }
 
+/*
+ * __evict_worker_thread --
+ *	An eviction worker thread: evict pages from the LRU queue filled by the
+ * eviction server.
+ */
+static void *
+__evict_worker_thread(void *arg)
+{
+	WT_CACHE *cache;
+	WT_DECL_RET;
+	WT_EVICT_WORKER *worker;
+	WT_SESSION_IMPL *session;
+
+	worker = arg;
+	session = worker->session;
+	cache = S2C(session)->cache;
+
+	while (F_ISSET(cache, WT_EVICT_WORKER_RUN)) {
+		/*
+		 * Evict pages until the queue is empty: EBUSY is returned if a
+		 * page fails eviction because it's unavailable, continue in
+		 * that case.
+		 */
+		while ((ret = __wt_evict_lru_page(session, 0)) == 0 ||
+		    ret == EBUSY)
+			;
+		if (ret != WT_NOTFOUND)
+			WT_ERR(ret);
+
+		/* Tell the server the queue is empty, wait for more pages. */
+		WT_ERR(__wt_cond_signal(session, cache->evict_cond));
+		WT_ERR(__wt_cond_wait(session, session->cond, 100000));
+	}
+
+	if (0) {
+err:		WT_PANIC_ERR(session, ret, "eviction worker error");
+	}
+	return (NULL);
+}
+
+/*
+ * __evict_workers_start --
+ *	Start the eviction worker threads.
+ */
+static int
+__evict_workers_start(WT_SESSION_IMPL *session)
+{
+	WT_CACHE *cache;
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+	WT_EVICT_WORKER *worker;
+	WT_SESSION_IMPL *s;
+	u_int i;
+
+	conn = S2C(session);
+	cache = conn->cache;
+
+	if (cache->eviction_workers == 0)
+		return (0);
+
+	WT_RET(__wt_calloc_def(session, cache->eviction_workers,
+	    &cache->workers));
+	F_SET(cache, WT_EVICT_WORKER_RUN);
+
+	/*
+	 * Each worker gets its own session, so it never needs to acquire the
+	 * connection spinlock.  Workers with a session are running, clear the
+	 * session if the thread can't be started.
+	 */
+	for (i = 0; i < cache->eviction_workers; i++) {
+		worker = &cache->workers[i];
+		worker->id = i;
+		WT_RET(__wt_open_session(conn, 1, NULL, NULL, &s));
+		s->name = "eviction-worker";
+		worker->session = s;
+		if ((ret = __wt_thread_create(session,
+		    &worker->tid, __evict_worker_thread, worker)) != 0) {
+			worker->session = NULL;
+			WT_TRET(s->iface.close(&s->iface, NULL));
+			__wt_free(conn->default_session, s->hazard);
+			return (ret);
+		}
+	}
+	return (0);
+}
+
+/*
+ * __evict_workers_wake --
+ *	Wake the eviction worker threads.
+ */
+static int
+__evict_workers_wake(WT_SESSION_IMPL *session)
+{
+	WT_CACHE *cache;
+	WT_DECL_RET;
+	u_int i;
+
+	cache = S2C(session)->cache;
+
+	for (i = 0; i < cache->eviction_workers; i++)
+		if (cache->workers[i].session != NULL)
+			WT_TRET(__wt_cond_signal(
+			    session, cache->workers[i].session->cond));
+	return (ret);
+}
+
+/*
+ * __evict_workers_stop --
+ *	Shut down the eviction worker threads.
+ */
+static int
+__evict_workers_stop(WT_SESSION_IMPL *session)
+{
+	WT_CACHE *cache;
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+	WT_EVICT_WORKER *worker;
+	u_int i;
+
+	conn = S2C(session);
+	cache = conn->cache;
+
+	if (cache->workers == NULL)
+		return (0);
+
+	F_CLR(cache, WT_EVICT_WORKER_RUN);
+	WT_TRET(__evict_workers_wake(session));
+
+	/*
+	 * A worker has been started if it has a session (thread creation is
+	 * the last step).
+	 */
+	for (i = 0; i < cache->eviction_workers; i++) {
+		worker = &cache->workers[i];
+		if (worker->session == NULL)
+			continue;
+		WT_TRET(__wt_thread_join(session, worker->tid));
+
+		/* Close the worker's session and free its hazard array. */
+		WT_TRET(worker->session->iface.close(
+		    &worker->session->iface, NULL));
+		__wt_free(conn->default_session, worker->session->hazard);
+	}
+	__wt_free(session, cache->workers);
+	return (ret);
+}
+
 /*
  * __evict_worker --
  *	Evict pages from memory.
@@ -662,12 +817,15 @@ __wt_sync_file(WT_SESSION_IMPL *session, int syncop)
 	WT_CACHE *cache;
 	WT_DECL_RET;
 	WT_PAGE *page;
+	WT_SYNC_BATCH *batch;
 	WT_TXN *txn;
 	uint32_t flags;
+	int added;
 
 	btree = S2BT(session);
 	cache = S2C(session)->cache;
 	page = NULL;
+	batch = NULL;
 	txn = &session->txn;
 
 	switch (syncop) {
@@ -681,10 +839,24 @@ __wt_sync_file(WT_SESSION_IMPL *session, int syncop)
 		flags = WT_TREE_CACHE | WT_TREE_SKIP_INTL;
 		if (syncop == WT_SYNC_CHECKPOINT)
 			flags |= WT_TREE_WAIT;
+
+		/*
+		 * Leaf pages written before the checkpoint starts are written
+		 * in batches shared with the sync threads, if configured.
+		 * Pages written by the checkpoint itself must be written in
+		 * the checkpoint's snapshot, by this thread.
+		 */
+		if (syncop == WT_SYNC_WRITE_LEAVES)
+			WT_ERR(__wt_sync_batch_alloc(session, &batch));
+
 		WT_ERR(__wt_tree_walk(session, &page, flags));
 		while (page != NULL) {
 			/* Write dirty pages if nobody beat us to it. */
-			if (__wt_page_is_modified(page)) {
+			added = 0;
+			if (batch != NULL && __wt_page_is_modified(page))
+				WT_ERR(__wt_sync_batch_add(
+				    session, batch, page, &added));
+			if (!added && __wt_page_is_modified(page)) {
 				if (txn->isolation == TXN_ISO_READ_COMMITTED)
 					__wt_txn_get_snapshot(session,
 					    WT_TXN_NONE, WT_TXN_NONE, 0);
@@ -696,6 +868,8 @@ __wt_sync_file(WT_SESSION_IMPL *session, int syncop)
 
 			WT_ERR(__wt_tree_walk(session, &page, flags));
 		}
+		if (batch != NULL)
+			WT_ERR(__wt_sync_batch_run(session, batch));
 
 		if (syncop == WT_SYNC_WRITE_LEAVES)
 			break;
@@ -758,6 +932,7 @@ __wt_sync_file(WT_SESSION_IMPL *session, int syncop)
 err:	/* On error, clear any left-over tree walk. */
 	if (page != NULL)
 		__wt_evict_clear_tree_walk(session, page);
+	WT_TRET(__wt_sync_batch_free(session, &batch));
 
 	if (btree->checkpointing) {
 		btree->checkpointing = 0;
@@ -831,6 +1006,16 @@ __evict_lru(WT_SESSION_IMPL *session, int clean)
 	 */
 	WT_RET(__wt_cond_signal(session, cache->evict_waiter_cond));
 
+	/*
+	 * If there are eviction workers, wake them to evict the pages and wait
+	 * for them to empty the queue: the first worker to find the queue
+	 * empty wakes us to refill it.
+	 */
+	if (cache->workers != NULL) {
+		WT_RET(__evict_workers_wake(session));
+		return (__wt_cond_wait(session, cache->evict_cond, 100000));
+	}
+
 	/*
 	 * Reconcile and discard some pages: EBUSY is returned if a page fails
 	 * eviction because it's unavailable, continue in that case.
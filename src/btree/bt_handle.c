@@ -299,7 +299,12 @@ __btree_conf(WT_SESSION_IMPL *session, WT_CKPT *ckpt)
 	WT_RET(__wt_rwlock_alloc(
 	    session, "btree overflow lock", &btree->val_ovfl_lock));
 
+	/*
+	 * Statistics start over when the handle is opened, the sharded counters
+	 * are allocated when a statistics cursor is opened on the handle.
+	 */
 	__wt_stat_init_dsrc_stats(&btree->dhandle->stats);
+	__wt_stat_shard_discard(session, &btree->dhandle->stats_shards);
 
 	btree->write_gen = ckpt->write_gen;		/* Write generation */
 	btree->modified = 0;				/* Clean */
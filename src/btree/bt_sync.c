@@ -73,3 +73,346 @@ __wt_bt_cache_op(WT_SESSION_IMPL *session, WT_CKPT *ckptbase, int op)
 err:	btree->ckpt = NULL;
 	return (ret);
 }
+
+/*
+ * __sync_batch_claim --
+ *	Claim the next page of a batch, taking the batch off the queue once
+ *	all of its pages are claimed.  Must be called with the sync lock held.
+ */
+static WT_PAGE *
+__sync_batch_claim(WT_CONNECTION_IMPL *conn, WT_SYNC_BATCH *batch)
+{
+	WT_PAGE *page;
+
+	if (batch->next == batch->npages)
+		return (NULL);
+	page = batch->pages[batch->next++];
+	if (batch->next == batch->npages && batch->queued) {
+		TAILQ_REMOVE(&conn->syncqh, batch, q);
+		batch->queued = 0;
+	}
+	return (page);
+}
+
+/*
+ * __sync_batch_page --
+ *	Reconcile a page of a batch, if nobody beat us to it.  The thread
+ * finishing the batch wakes the thread flushing the file.
+ */
+static void
+__sync_batch_page(
+    WT_SESSION_IMPL *session, WT_SYNC_BATCH *batch, WT_PAGE *page)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_DATA_HANDLE *saved_dhandle;
+	WT_DECL_RET;
+	WT_TXN *txn;
+	int saved_isolation;
+
+	conn = S2C(session);
+	txn = &session->txn;
+
+	saved_dhandle = session->dhandle;
+	saved_isolation = txn->isolation;
+	session->dhandle = batch->dhandle;
+	txn->isolation = batch->isolation;
+
+	if (__wt_page_is_modified(page)) {
+		if (txn->isolation == TXN_ISO_READ_COMMITTED)
+			__wt_txn_get_snapshot(
+			    session, WT_TXN_NONE, WT_TXN_NONE, 0);
+		ret = __wt_rec_write(session, page, NULL, 0);
+		if (txn->isolation == TXN_ISO_READ_COMMITTED)
+			__wt_txn_release_snapshot(session);
+	}
+
+	session->dhandle = saved_dhandle;
+	txn->isolation = saved_isolation;
+
+	/*
+	 * Signal while holding the lock: once the batch is done, the flushing
+	 * thread can return and free it.
+	 */
+	__wt_spin_lock(session, &conn->sync_lock);
+	if (ret != 0 && batch->ret == 0)
+		batch->ret = ret;
+	ret = 0;
+	if (++batch->done == batch->npages && batch->cond != session->cond)
+		ret = __wt_cond_signal(session, batch->cond);
+	__wt_spin_unlock(session, &conn->sync_lock);
+	if (ret != 0)
+		__wt_err(session, ret, "sync batch signal");
+}
+
+/*
+ * __sync_thread --
+ *	A sync thread: reconcile pages of queued batches until the threads are
+ * shut down.
+ */
+static void *
+__sync_thread(void *arg)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+	WT_PAGE *page;
+	WT_SESSION_IMPL *session;
+	WT_SYNC_BATCH *batch;
+	WT_SYNC_THREAD *thread;
+	int run;
+
+	thread = arg;
+	session = thread->session;
+	conn = S2C(session);
+
+	for (;;) {
+		/* Claim a page from the oldest batch with pages left. */
+		page = NULL;
+		__wt_spin_lock(session, &conn->sync_lock);
+		if ((batch = TAILQ_FIRST(&conn->syncqh)) != NULL)
+			page = __sync_batch_claim(conn, batch);
+		run = conn->sync_run;
+		__wt_spin_unlock(session, &conn->sync_lock);
+
+		if (page == NULL) {
+			if (!run)
+				break;
+			WT_ERR(__wt_cond_wait(session, session->cond, 100000));
+			continue;
+		}
+
+		/* Errors are returned to the thread flushing the file. */
+		__sync_batch_page(session, batch, page);
+	}
+
+	if (0) {
+err:		WT_PANIC_ERR(session, ret, "sync thread error");
+	}
+	return (NULL);
+}
+
+/*
+ * __wt_sync_threads_create --
+ *	Start the sync threads.
+ */
+int
+__wt_sync_threads_create(WT_CONNECTION_IMPL *conn, const char *cfg[])
+{
+	WT_CONFIG_ITEM cval;
+	WT_DECL_RET;
+	WT_SESSION_IMPL *s, *session;
+	WT_SYNC_THREAD *thread;
+	u_int i;
+
+	session = conn->default_session;
+
+	WT_RET(__wt_config_gets(session, cfg, "checkpoint_threads", &cval));
+	if (cval.val == 0)
+		return (0);
+
+	WT_RET(__wt_calloc_def(session, (size_t)cval.val, &conn->sync_thread));
+	conn->sync_threads = (u_int)cval.val;
+	conn->sync_run = 1;
+
+	/*
+	 * Threads with a session are running, clear the session if the thread
+	 * can't be started.
+	 */
+	for (i = 0; i < conn->sync_threads; i++) {
+		thread = &conn->sync_thread[i];
+		WT_RET(__wt_open_session(conn, 1, NULL, NULL, &s));
+		s->name = "sync-thread";
+		thread->session = s;
+		if ((ret = __wt_thread_create(session,
+		    &thread->tid, __sync_thread, thread)) != 0) {
+			thread->session = NULL;
+			WT_TRET(s->iface.close(&s->iface, NULL));
+			__wt_free(session, s->hazard);
+			return (ret);
+		}
+	}
+	return (0);
+}
+
+/*
+ * __wt_sync_threads_destroy --
+ *	Shut down the sync threads.
+ */
+int
+__wt_sync_threads_destroy(WT_CONNECTION_IMPL *conn)
+{
+	WT_DECL_RET;
+	WT_SESSION_IMPL *session;
+	WT_SYNC_THREAD *thread;
+	u_int i;
+
+	session = conn->default_session;
+
+	if (conn->sync_thread == NULL)
+		return (0);
+
+	__wt_spin_lock(session, &conn->sync_lock);
+	conn->sync_run = 0;
+	__wt_spin_unlock(session, &conn->sync_lock);
+
+	for (i = 0; i < conn->sync_threads; i++) {
+		thread = &conn->sync_thread[i];
+		if (thread->session == NULL)
+			continue;
+		WT_TRET(__wt_cond_signal(session, thread->session->cond));
+		WT_TRET(__wt_thread_join(session, thread->tid));
+
+		/* Close the thread's session and free its hazard array. */
+		WT_TRET(thread->session->iface.close(
+		    &thread->session->iface, NULL));
+		__wt_free(session, thread->session->hazard);
+	}
+	__wt_free(session, conn->sync_thread);
+	conn->sync_threads = 0;
+
+	return (ret);
+}
+
+/*
+ * __wt_sync_batch_alloc --
+ *	Allocate a batch for flushing a file, if there are sync threads to
+ * share the work.
+ */
+int
+__wt_sync_batch_alloc(WT_SESSION_IMPL *session, WT_SYNC_BATCH **batchp)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+	WT_SYNC_BATCH *batch;
+
+	conn = S2C(session);
+	*batchp = NULL;
+
+	if (conn->sync_threads == 0)
+		return (0);
+
+	WT_RET(__wt_calloc_def(session, 1, &batch));
+	/* The flushing thread holds a hazard reference to each page. */
+	batch->max = WT_MIN(WT_SYNC_BATCH_MAX, conn->hazard_max / 2);
+	WT_ERR(__wt_calloc_def(session, batch->max, &batch->pages));
+	*batchp = batch;
+	return (0);
+
+err:	__wt_free(session, batch);
+	return (ret);
+}
+
+/*
+ * __wt_sync_batch_add --
+ *	Add a dirty page to a batch, reconciling the batch when it's full.  If
+ * the page can't be pinned, return without adding it, the caller reconciles
+ * the page itself.
+ */
+int
+__wt_sync_batch_add(WT_SESSION_IMPL *session,
+    WT_SYNC_BATCH *batch, WT_PAGE *page, int *addedp)
+{
+	int busy;
+
+	*addedp = 0;
+
+	/*
+	 * The root page can't be evicted, and the tree walk holds a hazard
+	 * reference to the page that is released when the walk moves on, so
+	 * take a hazard reference of our own.
+	 */
+	if (WT_PAGE_IS_ROOT(page))
+		return (0);
+#ifdef HAVE_DIAGNOSTIC
+	WT_RET(__wt_hazard_set(session, page->ref, &busy, __FILE__, __LINE__));
+#else
+	WT_RET(__wt_hazard_set(session, page->ref, &busy));
+#endif
+	if (busy)
+		return (0);
+
+	batch->pages[batch->npages++] = page;
+	*addedp = 1;
+
+	if (batch->npages == batch->max)
+		return (__wt_sync_batch_run(session, batch));
+	return (0);
+}
+
+/*
+ * __wt_sync_batch_run --
+ *	Reconcile the pages of a batch with the help of the sync threads, and
+ * release the batch's hazard references.
+ */
+int
+__wt_sync_batch_run(WT_SESSION_IMPL *session, WT_SYNC_BATCH *batch)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+	WT_PAGE *page;
+	u_int i;
+	int done;
+
+	conn = S2C(session);
+
+	if (batch->npages == 0)
+		return (0);
+
+	batch->dhandle = session->dhandle;
+	batch->isolation = session->txn.isolation;
+	batch->cond = session->cond;
+	batch->next = batch->done = 0;
+	batch->ret = 0;
+
+	__wt_spin_lock(session, &conn->sync_lock);
+	TAILQ_INSERT_TAIL(&conn->syncqh, batch, q);
+	batch->queued = 1;
+	__wt_spin_unlock(session, &conn->sync_lock);
+
+	for (i = 0; i < conn->sync_threads; i++)
+		if (conn->sync_thread[i].session != NULL)
+			WT_TRET(__wt_cond_signal(
+			    session, conn->sync_thread[i].session->cond));
+
+	/* Reconcile pages in this thread too, then wait for the rest. */
+	for (;;) {
+		__wt_spin_lock(session, &conn->sync_lock);
+		page = __sync_batch_claim(conn, batch);
+		done = batch->done == batch->npages;
+		__wt_spin_unlock(session, &conn->sync_lock);
+		if (page != NULL)
+			__sync_batch_page(session, batch, page);
+		else if (done)
+			break;
+		else	/* Wait for the sync threads to finish the batch. */
+			WT_TRET(__wt_cond_wait(session, session->cond, 0));
+	}
+
+	for (i = 0; i < batch->npages; i++)
+		WT_TRET(__wt_hazard_clear(session, batch->pages[i]));
+	batch->npages = 0;
+	WT_TRET(batch->ret);
+	return (ret);
+}
+
+/*
+ * __wt_sync_batch_free --
+ *	Discard a batch, releasing the hazard references of any pages that
+ * weren't reconciled.
+ */
+int
+__wt_sync_batch_free(WT_SESSION_IMPL *session, WT_SYNC_BATCH **batchp)
+{
+	WT_DECL_RET;
+	WT_SYNC_BATCH *batch;
+	u_int i;
+
+	if ((batch = *batchp) == NULL)
+		return (0);
+	*batchp = NULL;
+
+	for (i = 0; i < batch->npages; i++)
+		WT_TRET(__wt_hazard_clear(session, batch->pages[i]));
+	__wt_free(session, batch->pages);
+	__wt_free(session, batch);
+	return (ret);
+}
@@ -154,6 +154,62 @@ __tree_walk_read(WT_SESSION_IMPL *session, WT_REF *ref, int *skipp)
 	return (0);
 }
 
+/*
+ * __tree_walk_read_ahead --
+ *	A walk is about to read a page from disk: start reading the following
+ * pages referenced by the parent page, in the walk's direction, without
+ * waiting for them.
+ */
+static inline int
+__tree_walk_read_ahead(
+    WT_SESSION_IMPL *session, WT_PAGE *page, uint32_t slot, int prev)
+{
+	WT_BM *bm;
+	WT_REF *ref;
+	uint32_t i, n, size;
+	const uint8_t *addr;
+
+	if ((n = S2C(session)->read_ahead) == 0)
+		return (0);
+	bm = S2BT(session)->bm;
+
+	/*
+	 * Each read from disk extends the window: skip pages this session has
+	 * already read ahead.  The page pointer is only compared, if the page
+	 * has been discarded in the meantime, we skip some read-ahead.
+	 */
+	for (i = 1; i <= n; ++i) {
+		if (prev) {
+			if (i > slot)
+				break;
+			ref = &page->u.intl.t[slot - i];
+		} else {
+			if (slot + i >= page->entries)
+				break;
+			ref = &page->u.intl.t[slot + i];
+		}
+		if (page == session->read_ahead_page && (prev ?
+		    slot - i >= session->read_ahead_slot :
+		    slot + i <= session->read_ahead_slot))
+			continue;
+
+		session->read_ahead_page = page;
+		session->read_ahead_slot = prev ? slot - i : slot + i;
+
+		/*
+		 * Only read pages that aren't already in memory (or deleted).
+		 * The parent page is pinned, but there's no lock on the child
+		 * page, the worst case is we read a block we don't need.
+		 */
+		if (ref->state != WT_REF_DISK)
+			continue;
+		__wt_get_addr(page, ref, &addr, &size);
+		if (addr != NULL)
+			WT_RET(bm->preload(bm, session, addr, size));
+	}
+	return (0);
+}
+
 /*
  * __wt_tree_walk --
  *	Move to the next/previous page in the tree.
@@ -378,7 +434,9 @@ retry:				if (ref->state != WT_REF_MEM ||
 						break;
 					set_read_gen =
 					    ref->state == WT_REF_DISK ? 1 : 0;
-				}
+				} else if (ref->state == WT_REF_DISK)
+					WT_RET(__tree_walk_read_ahead(
+					    session, page, slot, prev));
 				WT_RET(
 				    __wt_page_swap(session, couple, page, ref));
 				if (set_read_gen)
@@ -184,6 +184,14 @@ __wt_col_modify(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt, int op)
 			    &ins, ins_size, skipdepth));
 	}
 
+	/*
+	 * Add the update to the transaction's log record.  The update is part
+	 * of the transaction from here on, an error rolls back the transaction
+	 * rather than the update.
+	 */
+	ret = __wt_txn_log_op(session, btree,
+	    NULL, op == 1 ? cbt->recno : recno, op == 2 ? NULL : value);
+
 	if (0) {
 err:		/*
 		 * Remove the update from the current transaction, so we don't
@@ -525,7 +525,7 @@ __hazard_exclusive(WT_SESSION_IMPL *session, WT_REF *ref, int top)
 	session->excl[session->excl_next++] = ref;
 
 	/* Check for a matching hazard pointer. */
-	if (__wt_page_hazard_check(session, ref->page) == NULL)
+	if (!__wt_page_hazard_check(ref))
 		return (0);
 
 	WT_DSTAT_INCR(session, cache_eviction_hazard);
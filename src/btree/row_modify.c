@@ -152,6 +152,13 @@ __wt_row_modify(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt, int is_remove)
 		    &ins, ins_size, skipdepth));
 	}
 
+	/*
+	 * Add the update to the transaction's log record.  The update is part
+	 * of the transaction from here on, an error rolls back the transaction
+	 * rather than the update.
+	 */
+	ret = __wt_txn_log_op(session, cbt->btree, key, 0, value);
+
 	if (0) {
 err:		/*
 		 * Remove the update from the current transaction, so we don't
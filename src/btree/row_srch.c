@@ -100,6 +100,114 @@ __wt_search_insert(WT_SESSION_IMPL *session,
 	return (0);
 }
 
+/*
+ * __row_search_leaf --
+ *	Search a row-store leaf page for a specific key.
+ */
+static int
+__row_search_leaf(WT_SESSION_IMPL *session,
+    WT_CURSOR_BTREE *cbt, WT_PAGE *page, int is_modify)
+{
+	WT_BTREE *btree;
+	WT_ITEM *item, _item, *srch_key;
+	WT_ROW *rip;
+	uint32_t base, indx, limit;
+	int cmp;
+
+	srch_key = &cbt->iface.key;
+
+	btree = S2BT(session);
+	item = &_item;
+	rip = NULL;
+
+	/*
+	 * Copy the leaf page's write generation value before reading the page.
+	 * Use a read memory barrier to ensure we read the value before we read
+	 * any of the page's contents.
+	 */
+	if (is_modify) {
+		/* Initialize the page's modification information */
+		WT_RET(__wt_page_modify_init(session, page));
+
+		WT_ORDERED_READ(cbt->write_gen, page->modify->write_gen);
+	}
+
+	/*
+	 * Do a binary search of the leaf page; the page might be empty, reset
+	 * the comparison value.
+	 */
+	cmp = -1;
+	for (base = 0, limit = page->entries; limit != 0; limit >>= 1) {
+		indx = base + (limit >> 1);
+		rip = page->u.row.d + indx;
+
+		WT_RET(__wt_row_key(session, page, rip, item, 1));
+		WT_RET(WT_BTREE_CMP(session, btree, srch_key, item, cmp));
+		if (cmp == 0)
+			break;
+		if (cmp < 0)
+			continue;
+
+		base = indx + 1;
+		--limit;
+	}
+
+	/*
+	 * The best case is finding an exact match in the page's WT_ROW slot
+	 * array, which is probable for any read-mostly workload.  In that
+	 * case, we're not doing any kind of insert, all we can do is update
+	 * an existing entry.  Check that case and get out fast.
+	 */
+	if (cmp == 0) {
+		WT_ASSERT(session, rip != NULL);
+		cbt->compare = 0;
+		cbt->page = page;
+		cbt->slot = WT_ROW_SLOT(page, rip);
+		return (0);
+	}
+
+	/*
+	 * We didn't find an exact match in the WT_ROW array.
+	 *
+	 * Base is the smallest index greater than key and may be the 0th index
+	 * or the (last + 1) index.  Set the WT_ROW reference to be the largest
+	 * index less than the key if that's possible (if base is the 0th index
+	 * it means the application is inserting a key before any key found on
+	 * the page).
+	 */
+	rip = page->u.row.d;
+	if (base == 0)
+		cbt->compare = 1;
+	else {
+		rip += base - 1;
+		cbt->compare = -1;
+	}
+
+	/*
+	 * It's still possible there is an exact match, but it's on an insert
+	 * list.  Figure out which insert chain to search, and do the initial
+	 * setup of the return information for the insert chain (we'll correct
+	 * it as needed depending on what we find.)
+	 *
+	 * If inserting a key smaller than any key found in the WT_ROW array,
+	 * use the extra slot of the insert array, otherwise insert lists map
+	 * one-to-one to the WT_ROW array.
+	 */
+	cbt->slot = WT_ROW_SLOT(page, rip);
+	if (base == 0) {
+		F_SET(cbt, WT_CBT_SEARCH_SMALLEST);
+		cbt->ins_head = WT_ROW_INSERT_SMALLEST(page);
+	} else
+		cbt->ins_head = WT_ROW_INSERT_SLOT(page, cbt->slot);
+
+	/*
+	 * Search the insert list for a match; __wt_search_insert sets the
+	 * return insert information appropriately.
+	 */
+	cbt->page = page;
+	return (__wt_search_insert(session, cbt, cbt->ins_head, srch_key));
+}
+
 /*
  * __wt_row_search --
  *	Search a row-store tree for a specific key.
@@ -113,7 +221,6 @@ __wt_row_search(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt, int is_modify)
 	WT_ITEM *item, _item, *srch_key;
 	WT_PAGE *page;
 	WT_REF *ref;
-	WT_ROW *rip;
 	uint32_t base, indx, limit;
 	int cmp, depth;
 
@@ -122,7 +229,6 @@ __wt_row_search(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt, int is_modify)
 	srch_key = &cbt->iface.key;
 
 	btree = S2BT(session);
-	rip = NULL;
 
 	/* Search the internal pages of the tree. */
 	cmp = -1;
@@ -210,95 +316,68 @@ descend:	WT_ASSERT(session, ref != NULL);
 	if (depth > btree->maximum_depth)
 		btree->maximum_depth = depth;
 
-	/*
-	 * Copy the leaf page's write generation value before reading the page.
-	 * Use a read memory barrier to ensure we read the value before we read
-	 * any of the page's contents.
-	 */
-	if (is_modify) {
-		/* Initialize the page's modification information */
-		WT_ERR(__wt_page_modify_init(session, page));
+	WT_ERR(__row_search_leaf(session, cbt, page, is_modify));
+	return (0);
 
-		WT_ORDERED_READ(cbt->write_gen, page->modify->write_gen);
-	}
+err:	WT_TRET(__wt_page_release(session, page));
+	return (ret);
+}
 
-	/*
-	 * Do a binary search of the leaf page; the page might be empty, reset
-	 * the comparison value.
-	 */
-	cmp = -1;
-	for (base = 0, limit = page->entries; limit != 0; limit >>= 1) {
-		indx = base + (limit >> 1);
-		rip = page->u.row.d + indx;
+/*
+ * __wt_row_search_page --
+ *	Search a row-store tree for a specific key, starting with the leaf page
+ * the cursor references: if the key sorts between the page's first and last
+ * keys, it can only be on that page and the tree isn't descended again.
+ */
+int
+__wt_row_search_page(
+    WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt, int is_modify)
+{
+	WT_BTREE *btree;
+	WT_DECL_RET;
+	WT_ITEM *item, _item, *srch_key;
+	WT_PAGE *page;
+	int cmp;
 
-		WT_ERR(__wt_row_key(session, page, rip, item, 1));
-		WT_ERR(WT_BTREE_CMP(session, btree, srch_key, item, cmp));
-		if (cmp == 0)
-			break;
-		if (cmp < 0)
-			continue;
+	if ((page = cbt->page) == NULL)
+		return (__wt_row_search(session, cbt, is_modify));
 
-		base = indx + 1;
-		--limit;
-	}
+	srch_key = &cbt->iface.key;
 
-	/*
-	 * The best case is finding an exact match in the page's WT_ROW slot
-	 * array, which is probable for any read-mostly workload.  In that
-	 * case, we're not doing any kind of insert, all we can do is update
-	 * an existing entry.  Check that case and get out fast.
-	 */
-	if (cmp == 0) {
-		WT_ASSERT(session, rip != NULL);
-		cbt->compare = 0;
-		cbt->page = page;
-		cbt->slot = WT_ROW_SLOT(page, rip);
-		return (0);
-	}
+	btree = S2BT(session);
+	item = &_item;
 
 	/*
-	 * We didn't find an exact match in the WT_ROW array.
-	 *
-	 * Base is the smallest index greater than key and may be the 0th index
-	 * or the (last + 1) index.  Set the WT_ROW reference to be the largest
-	 * index less than the key if that's possible (if base is the 0th index
-	 * it means the application is inserting a key before any key found on
-	 * the page).
+	 * Batches search for keys in sorted order, check the last key first,
+	 * it's the one most likely to fail.
 	 */
-	rip = page->u.row.d;
-	if (base == 0)
-		cbt->compare = 1;
-	else {
-		rip += base - 1;
-		cbt->compare = -1;
+	if (page->entries != 0) {
+		WT_ERR(__wt_row_key(session,
+		    page, page->u.row.d + (page->entries - 1), item, 1));
+		WT_ERR(WT_BTREE_CMP(session, btree, srch_key, item, cmp));
+		if (cmp <= 0) {
+			WT_ERR(__wt_row_key(
+			    session, page, page->u.row.d, item, 1));
+			WT_ERR(WT_BTREE_CMP(
+			    session, btree, srch_key, item, cmp));
+			cmp = -cmp;
+		}
+		if (cmp <= 0) {
+			__cursor_search_clear(cbt);
+			WT_ERR(__row_search_leaf(
+			    session, cbt, page, is_modify));
+			return (0);
+		}
 	}
 
-	/*
-	 * It's still possible there is an exact match, but it's on an insert
-	 * list.  Figure out which insert chain to search, and do the initial
-	 * setup of the return information for the insert chain (we'll correct
-	 * it as needed depending on what we find.)
-	 *
-	 * If inserting a key smaller than any key found in the WT_ROW array,
-	 * use the extra slot of the insert array, otherwise insert lists map
-	 * one-to-one to the WT_ROW array.
-	 */
-	cbt->slot = WT_ROW_SLOT(page, rip);
-	if (base == 0) {
-		F_SET(cbt, WT_CBT_SEARCH_SMALLEST);
-		cbt->ins_head = WT_ROW_INSERT_SMALLEST(page);
-	} else
-		cbt->ins_head = WT_ROW_INSERT_SLOT(page, cbt->slot);
-
-	/*
-	 * Search the insert list for a match; __wt_search_insert sets the
-	 * return insert information appropriately.
-	 */
-	cbt->page = page;
-	WT_ERR(__wt_search_insert(session, cbt, cbt->ins_head, srch_key));
-	return (0);
+	/* The key may be on another page, search the tree. */
+	cbt->page = NULL;
+	if ((ret = __wt_page_release(session, page)) != 0)
+		return (ret);
+	return (__wt_row_search(session, cbt, is_modify));
 
-err:	WT_TRET(__wt_page_release(session, page));
+err:	cbt->page = NULL;
+	WT_TRET(__wt_page_release(session, page));
 	return (ret);
 }
 
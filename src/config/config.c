@@ -614,6 +614,65 @@ __config_getraw(
 	return (top ? __config_process_value(cparser, value) : 0);
 }
 
+/*
+ * __wt_config_compiled --
+ *	Return the compiled form of a configuration string, or NULL if it wasn't
+ * compiled.
+ */
+const WT_CONFIG_COMPILED *
+__wt_config_compiled(WT_SESSION_IMPL *session, const char *str)
+{
+	const WT_CONFIG_ARENA *arena;
+	const WT_CONFIG_COMPILED *cc;
+	u_int base, indx, limit;
+
+	/* Compiled strings are copies in one of the connection's arenas. */
+	for (arena = S2C(session)->config_arena;; arena = arena->next) {
+		if (arena == NULL)
+			return (NULL);
+		if (str >= arena->mem && str < arena->mem + arena->mem_size)
+			break;
+	}
+
+	/* The compiled strings are sorted by address, binary search them. */
+	limit = arena->compiled_cnt;
+	WT_READ_BARRIER();
+	for (base = 0; limit != 0; limit >>= 1) {
+		indx = base + (limit >> 1);
+		cc = &arena->compiled[indx];
+		if (cc->str == str) {
+			WT_CSTAT_INCR(session, config_compiled_lookup);
+			return (cc);
+		}
+		if (cc->str < str) {
+			base = indx + 1;
+			--limit;
+		}
+	}
+	return (NULL);
+}
+
+/*
+ * __config_compiled_get --
+ *	Find the final value for a given key in a compiled configuration
+ * string's parsed items.
+ */
+static int
+__config_compiled_get(const WT_CONFIG_ITEM *keys,
+    const WT_CONFIG_ITEM *values, u_int nitems,
+    WT_CONFIG_ITEM *key, WT_CONFIG_ITEM *value)
+{
+	while (nitems > 0) {
+		--nitems;
+		if (keys[nitems].len == key->len &&
+		    strncasecmp(key->str, keys[nitems].str, key->len) == 0) {
+			*value = values[nitems];
+			return (0);
+		}
+	}
+	return (WT_NOTFOUND);
+}
+
 /*
  * __wt_config_get --
  *	Given a NULL-terminated list of configuration strings, find
@@ -623,11 +682,32 @@ int
 __wt_config_get(WT_SESSION_IMPL *session,
     const char **cfg, WT_CONFIG_ITEM *key, WT_CONFIG_ITEM *value)
 {
+	const WT_CONFIG_COMPILED *cc;
 	WT_CONFIG cparser;
 	WT_DECL_RET;
+	const char **end;
 	int found;
 
-	for (found = 0; *cfg != NULL; cfg++) {
+	/*
+	 * If the last string was compiled, look the key up in its parsed items;
+	 * if the key isn't there and the only other string is the default
+	 * configuration of the method the string was compiled for, look it up
+	 * in the default's parsed items.  Keys naming a nested value (such as
+	 * "lsm.chunk_size") are looked up by parsing the strings.
+	 */
+	for (end = cfg; *end != NULL; ++end)
+		;
+	if (end > cfg && memchr(key->str, '.', key->len) == NULL &&
+	    (cc = __wt_config_compiled(session, end[-1])) != NULL) {
+		if (__config_compiled_get(
+		    cc->keys, cc->values, cc->nitems, key, value) == 0)
+			return (0);
+		if (--end == cfg + 1 && cfg[0] == cc->entry->base)
+			return (__config_compiled_get(cc->base_keys,
+			    cc->base_values, cc->nbase, key, value));
+	}
+
+	for (found = 0; cfg < end; cfg++) {
 		WT_RET(__wt_config_init(session, &cparser, *cfg));
 		if ((ret = __config_getraw(&cparser, key, value, 1)) == 0)
 			found = 1;
@@ -661,8 +741,14 @@ __wt_config_gets(WT_SESSION_IMPL *session,
 __wt_config_getone(WT_SESSION_IMPL *session,
     const char *config, WT_CONFIG_ITEM *key, WT_CONFIG_ITEM *value)
 {
+	const WT_CONFIG_COMPILED *cc;
 	WT_CONFIG cparser;
 
+	if ((cc = __wt_config_compiled(session, config)) != NULL &&
+	    memchr(key->str, '.', key->len) == NULL)
+		return (__config_compiled_get(
+		    cc->keys, cc->values, cc->nitems, key, value));
+
 	WT_RET(__wt_config_init(session, &cparser, config));
 	return (__config_getraw(&cparser, key, value, 1));
 }
@@ -675,12 +761,10 @@ __wt_config_getone(WT_SESSION_IMPL *session,
 __wt_config_getones(WT_SESSION_IMPL *session,
     const char *config, const char *key, WT_CONFIG_ITEM *value)
 {
-	WT_CONFIG cparser;
 	WT_CONFIG_ITEM key_item =
 	    { key, strlen(key), 0, WT_CONFIG_ITEM_STRING };
 
-	WT_RET(__wt_config_init(session, &cparser, config));
-	return (__config_getraw(&cparser, &key_item, value, 1));
+	return (__wt_config_getone(session, config, &key_item, value));
 }
 
 /*
@@ -19,7 +19,7 @@ __wt_conn_foc_add(WT_SESSION_IMPL *session, ...)
 {
 	WT_CONNECTION_IMPL *conn;
 	va_list ap;
-	size_t cnt;
+	size_t bytes_allocated, cnt;
 	void *p;
 
 	conn = S2C(session);
@@ -45,7 +45,8 @@ __wt_conn_foc_add(WT_SESSION_IMPL *session, ...)
 	va_end(ap);
 
 	if (conn->foc_cnt + cnt >= conn->foc_size) {
-		WT_RET(__wt_realloc(session, NULL,
+		bytes_allocated = conn->foc_size * sizeof(void *);
+		WT_RET(__wt_realloc(session, &bytes_allocated,
 		    (conn->foc_size + cnt + 20) * sizeof(void *), &conn->foc));
 		conn->foc_size += cnt + 20;
 	}
@@ -126,10 +127,10 @@ __wt_configure_method(WT_SESSION_IMPL *session,
 		    "\"string\"");
 
 	/* Find a match for the method name. */
-	for (epp = conn->config_entries; (*epp)->method != NULL; ++epp)
+	for (epp = conn->config_entries; *epp != NULL; ++epp)
 		if (strcmp((*epp)->method, method) == 0)
 			break;
-	if ((*epp)->method == NULL)
+	if (*epp == NULL)
 		WT_RET_MSG(session,
 		    WT_NOTFOUND, "no method matching %s found", method);
 
@@ -216,6 +217,174 @@ err:		if (entry != NULL) {
 	return (ret);
 }
 
+/*
+ * __config_compile_items --
+ *	Parse the keys and values of a configuration string into arrays.
+ */
+static int
+__config_compile_items(WT_SESSION_IMPL *session, const char *config,
+    WT_CONFIG_ITEM **keysp, WT_CONFIG_ITEM **valuesp, u_int *nitemsp)
+{
+	WT_CONFIG parser;
+	WT_CONFIG_ITEM k, v, *keys, *values;
+	WT_DECL_RET;
+	u_int cnt;
+
+	keys = values = NULL;
+
+	/* Count the items, then parse them into the arrays. */
+	WT_RET(__wt_config_init(session, &parser, config));
+	for (cnt = 0; (ret = __wt_config_next(&parser, &k, &v)) == 0;)
+		++cnt;
+	WT_RET_NOTFOUND_OK(ret);
+
+	WT_ERR(__wt_calloc_def(session, cnt + 1, &keys));
+	WT_ERR(__wt_calloc_def(session, cnt + 1, &values));
+	WT_ERR(__wt_config_init(session, &parser, config));
+	for (cnt = 0; (ret = __wt_config_next(&parser, &k, &v)) == 0;) {
+		/* Lookups only match string keys, skip anything else. */
+		if (k.type != WT_CONFIG_ITEM_STRING &&
+		    k.type != WT_CONFIG_ITEM_ID)
+			continue;
+		keys[cnt] = k;
+		values[cnt++] = v;
+	}
+	WT_ERR_NOTFOUND_OK(ret);
+	WT_ERR(__wt_conn_foc_add(session, keys, values, NULL));
+
+	*keysp = keys;
+	*valuesp = values;
+	*nitemsp = cnt;
+	return (0);
+
+err:	__wt_free(session, keys);
+	__wt_free(session, values);
+	return (ret);
+}
+
+/*
+ * __config_arena_add --
+ *	Add an arena with room for a string of at least the given length.
+ */
+static int
+__config_arena_add(WT_SESSION_IMPL *session, size_t len)
+{
+	WT_CONFIG_ARENA *arena, *prev;
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+
+	conn = S2C(session);
+	prev = conn->config_arena;
+
+	WT_RET(__wt_calloc_def(session, 1, &arena));
+	arena->mem_size = prev == NULL ?
+	    WT_CONFIG_ARENA_SIZE : 2 * prev->mem_size;
+	while (arena->mem_size < len)
+		arena->mem_size *= 2;
+	arena->compiled_max = prev == NULL ?
+	    WT_CONFIG_ARENA_COMPILED : 2 * prev->compiled_max;
+	WT_ERR(__wt_calloc_def(session, arena->mem_size, &arena->mem));
+	WT_ERR(__wt_calloc_def(
+	    session, arena->compiled_max, &arena->compiled));
+	WT_ERR(__wt_conn_foc_add(
+	    session, arena->mem, arena->compiled, arena, NULL));
+	arena->next = prev;
+
+	/* Fill in the arena before readers can see it. */
+	WT_WRITE_BARRIER();
+	conn->config_arena = arena;
+	return (0);
+
+err:	__wt_free(session, arena->mem);
+	__wt_free(session, arena->compiled);
+	__wt_free(session, arena);
+	return (ret);
+}
+
+/*
+ * __wt_config_compile --
+ *	Compile a configuration string for a method: check it, copy it into an
+ * arena and parse its keys and values, returning the copy.
+ */
+int
+__wt_config_compile(WT_SESSION_IMPL *session,
+    const char *method, const char *config, const char **compiledp)
+{
+	const WT_CONFIG_ENTRY **epp;
+	WT_CONFIG_ARENA *arena;
+	WT_CONFIG_COMPILED *cc;
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+	size_t len;
+	u_int i;
+	char *p;
+
+	conn = S2C(session);
+	*compiledp = NULL;
+
+	if (config == NULL)
+		WT_RET_MSG(session, EINVAL, "no configuration specified");
+
+	/* Find a match for the method name. */
+	for (epp = conn->config_entries; *epp != NULL; ++epp)
+		if (strcmp((*epp)->method, method) == 0)
+			break;
+	if (*epp == NULL)
+		WT_RET_MSG(session,
+		    WT_NOTFOUND, "no method matching %s found", method);
+
+	/* Check the string before it's compiled, compiled strings skip it. */
+	WT_RET(__wt_config_check(session, *epp, config, 0));
+
+	/*
+	 * Readers search the compiled strings without a lock: arenas never
+	 * move, and a new compiled string is filled in before the count
+	 * including it is published.
+	 */
+	__wt_spin_lock(session, &conn->api_lock);
+
+	/* Compiling the same string for the same method again is a no-op. */
+	for (arena = conn->config_arena; arena != NULL; arena = arena->next)
+		for (i = 0; i < arena->compiled_cnt; ++i) {
+			cc = &arena->compiled[i];
+			if (cc->entry == *epp && strcmp(cc->str, config) == 0) {
+				*compiledp = cc->str;
+				goto err;
+			}
+		}
+
+	/* Strings are only added to the newest arena, add one if it's full. */
+	len = strlen(config) + 1;
+	if ((arena = conn->config_arena) == NULL ||
+	    arena->compiled_cnt == arena->compiled_max ||
+	    arena->mem_len + len > arena->mem_size) {
+		WT_ERR(__config_arena_add(session, len));
+		arena = conn->config_arena;
+	}
+
+	/*
+	 * Strings are allocated from the arena in order, the array of compiled
+	 * strings stays sorted by address.
+	 */
+	p = arena->mem + arena->mem_len;
+	memcpy(p, config, len);
+	cc = &arena->compiled[arena->compiled_cnt];
+	cc->entry = *epp;
+	cc->str = p;
+	WT_ERR(__config_compile_items(
+	    session, p, &cc->keys, &cc->values, &cc->nitems));
+	WT_ERR(__config_compile_items(session,
+	    (*epp)->base, &cc->base_keys, &cc->base_values, &cc->nbase));
+
+	arena->mem_len += len;
+	WT_WRITE_BARRIER();
+	++arena->compiled_cnt;
+	*compiledp = p;
+
+err:	__wt_spin_unlock(session, &conn->api_lock);
+	return (ret);
+}
+
 /*
  * __wt_config_check--
  *	Check the keys in an application-supplied config string match what is
@@ -225,12 +394,20 @@ int
 __wt_config_check(WT_SESSION_IMPL *session,
     const WT_CONFIG_ENTRY *entry, const char *config, size_t config_len)
 {
+	const WT_CONFIG_COMPILED *cc;
+
 	/*
 	 * Callers don't check, it's a fast call without a configuration or
-	 * check array.
+	 * check array, or with a string compiled for this method, which was
+	 * checked when it was compiled.
 	 */
-	return (config == NULL || entry->checks == NULL ?
-	    0 : config_check(session, entry->checks, config, config_len));
+	if (config == NULL || entry->checks == NULL)
+		return (0);
+	if (config_len == 0 &&
+	    (cc = __wt_config_compiled(session, config)) != NULL &&
+	    cc->entry == entry)
+		return (0);
+	return (config_check(session, entry->checks, config, config_len));
 }
 
 /*
@@ -43,22 +43,28 @@ static const WT_CONFIG_CHECK confchk_connection_reconfigure[] = {
 	{ "verbose", "list",
 	    "choices=[\"block\",\"shared_cache\",\"ckpt\",\"evict\","
 	    "\"evictserver\",\"fileops\",\"hazard\",\"lsm\",\"mutex\",\"read\","
-	    "\"readserver\",\"reconcile\",\"salvage\",\"verify\",\"write\"]",
+	    "\"readserver\",\"recovery\",\"reconcile\",\"salvage\",\"verify\","
+	    "\"write\"]",
 	    NULL},
 	{ NULL, NULL, NULL, NULL }
 };
 
 static const WT_CONFIG_CHECK confchk_file_meta[] = {
 	{ "allocation_size", "int", "min=512B,max=128MB", NULL},
+	{ "block_allocation", "string",
+	    "choices=[\"best\",\"segregated\"]",
+	    NULL},
 	{ "block_compressor", "string", NULL, NULL},
 	{ "cache_resident", "boolean", NULL, NULL},
 	{ "checkpoint", "string", NULL, NULL},
+	{ "checkpoint_lsn", "string", NULL, NULL},
 	{ "checksum", "string",
 	    "choices=[\"on\",\"off\",\"uncompressed\"]",
 	    NULL},
 	{ "collator", "string", NULL, NULL},
 	{ "columns", "list", NULL, NULL},
 	{ "dictionary", "int", "min=0", NULL},
+	{ "file_extend", "int", "min=0,max=1GB", NULL},
 	{ "format", "string", "choices=[\"btree\"]", NULL},
 	{ "huffman_key", "string", NULL, NULL},
 	{ "huffman_value", "string", NULL, NULL},
@@ -81,9 +87,11 @@ static const WT_CONFIG_CHECK confchk_file_meta[] = {
 
 static const WT_CONFIG_CHECK confchk_index_meta[] = {
 	{ "columns", "list", NULL, NULL},
+	{ "extractor", "string", NULL, NULL},
 	{ "key_format", "format", NULL, NULL},
 	{ "source", "string", NULL, NULL},
 	{ "type", "string", "choices=[\"file\",\"lsm\"]", NULL},
+	{ "value_columns", "list", NULL, NULL},
 	{ "value_format", "format", NULL, NULL},
 	{ NULL, NULL, NULL, NULL }
 };
@@ -108,6 +116,13 @@ static const WT_CONFIG_CHECK confchk_session_checkpoint[] = {
 	{ NULL, NULL, NULL, NULL }
 };
 
+static const WT_CONFIG_CHECK confchk_session_commit_transaction[] = {
+	{ "sync", "string",
+	    "choices=[\"full\",\"flush\",\"write\",\"none\"]",
+	    NULL},
+	{ NULL, NULL, NULL, NULL }
+};
+
 static const WT_CONFIG_CHECK confchk_session_compact[] = {
 	{ "trigger", "int", "min=10,max=50", NULL},
 	{ NULL, NULL, NULL, NULL }
@@ -115,6 +130,9 @@ static const WT_CONFIG_CHECK confchk_session_compact[] = {
 
 static const WT_CONFIG_CHECK confchk_session_create[] = {
 	{ "allocation_size", "int", "min=512B,max=128MB", NULL},
+	{ "block_allocation", "string",
+	    "choices=[\"best\",\"segregated\"]",
+	    NULL},
 	{ "block_compressor", "string", NULL, NULL},
 	{ "cache_resident", "boolean", NULL, NULL},
 	{ "checksum", "string",
@@ -125,6 +143,8 @@ static const WT_CONFIG_CHECK confchk_session_create[] = {
 	{ "columns", "list", NULL, NULL},
 	{ "dictionary", "int", "min=0", NULL},
 	{ "exclusive", "boolean", NULL, NULL},
+	{ "extractor", "string", NULL, NULL},
+	{ "file_extend", "int", "min=0,max=1GB", NULL},
 	{ "format", "string", "choices=[\"btree\"]", NULL},
 	{ "huffman_key", "string", NULL, NULL},
 	{ "huffman_value", "string", NULL, NULL},
@@ -144,6 +164,11 @@ static const WT_CONFIG_CHECK confchk_session_create[] = {
 	{ "lsm_bloom_oldest", "boolean", NULL, NULL},
 	{ "lsm_chunk_size", "int", "min=512K,max=500MB", NULL},
 	{ "lsm_merge_max", "int", "min=2,max=100", NULL},
+	{ "lsm_merge_partitions", "int", "min=1,max=16", NULL},
+	{ "lsm_merge_policy", "string",
+	    "choices=[\"default\",\"leveled\",\"tiered\"]",
+	    NULL},
+	{ "lsm_merge_ratio", "int", "min=2,max=100", NULL},
 	{ "lsm_merge_threads", "int", "min=1,max=10", NULL},
 	{ "memory_page_max", "int", "min=512B,max=10TB", NULL},
 	{ "os_cache_dirty_max", "int", "min=0", NULL},
@@ -152,6 +177,7 @@ static const WT_CONFIG_CHECK confchk_session_create[] = {
 	{ "source", "string", NULL, NULL},
 	{ "split_pct", "int", "min=25,max=100", NULL},
 	{ "type", "string", "choices=[\"file\",\"lsm\"]", NULL},
+	{ "value_columns", "list", NULL, NULL},
 	{ "value_format", "format", NULL, NULL},
 	{ NULL, NULL, NULL, NULL }
 };
@@ -222,18 +248,24 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open[] = {
 	{ "buffer_alignment", "int", "min=-1,max=1MB", NULL},
 	{ "cache_size", "int", "min=1MB,max=10TB", NULL},
 	{ "checkpoint", "category", NULL, confchk_checkpoint_subconfigs},
+	{ "checkpoint_threads", "int", "min=0,max=64", NULL},
 	{ "create", "boolean", NULL, NULL},
+	{ "cursor_cache", "int", "min=0,max=1000", NULL},
 	{ "direct_io", "list", "choices=[\"data\",\"log\"]", NULL},
 	{ "error_prefix", "string", NULL, NULL},
 	{ "eviction_dirty_target", "int", "min=10,max=99", NULL},
 	{ "eviction_target", "int", "min=10,max=99", NULL},
 	{ "eviction_trigger", "int", "min=10,max=99", NULL},
+	{ "eviction_workers", "int", "min=0,max=20", NULL},
 	{ "extensions", "list", NULL, NULL},
 	{ "hazard_max", "int", "min=15", NULL},
+	{ "io_threads", "int", "min=0,max=64", NULL},
 	{ "logging", "boolean", NULL, NULL},
 	{ "lsm_merge", "boolean", NULL, NULL},
+	{ "lsm_workers", "int", "min=1,max=64", NULL},
 	{ "mmap", "boolean", NULL, NULL},
 	{ "multiprocess", "boolean", NULL, NULL},
+	{ "read_ahead", "int", "min=0,max=1000", NULL},
 	{ "session_max", "int", "min=1", NULL},
 	{ "shared_cache", "category", NULL, confchk_shared_cache_subconfigs}
 	    ,
@@ -241,12 +273,16 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open[] = {
 	{ "statistics_log", "category", NULL,
 	     confchk_statistics_log_subconfigs},
 	{ "sync", "boolean", NULL, NULL},
+	{ "transaction_sync", "string",
+	    "choices=[\"full\",\"flush\",\"write\",\"none\"]",
+	    NULL},
 	{ "transactional", "boolean", NULL, NULL},
 	{ "use_environment_priv", "boolean", NULL, NULL},
 	{ "verbose", "list",
 	    "choices=[\"block\",\"shared_cache\",\"ckpt\",\"evict\","
 	    "\"evictserver\",\"fileops\",\"hazard\",\"lsm\",\"mutex\",\"read\","
-	    "\"readserver\",\"reconcile\",\"salvage\",\"verify\",\"write\"]",
+	    "\"readserver\",\"recovery\",\"reconcile\",\"salvage\",\"verify\","
+	    "\"write\"]",
 	    NULL},
 	{ NULL, NULL, NULL, NULL }
 };
@@ -296,21 +332,23 @@ static const WT_CONFIG_ENTRY config_entries[] = {
 	  NULL
 	},
 	{ "file.meta",
-	  "allocation_size=512B,block_compressor=,cache_resident=0,checkpoint=,"
-	  "checksum=on,collator=,columns=,dictionary=0,format=btree,"
-	  "huffman_key=,huffman_value=,internal_item_max=0,"
-	  "internal_key_truncate=,internal_page_max=2KB,key_format=u,key_gap=10"
-	  ",leaf_item_max=0,leaf_page_max=1MB,memory_page_max=5MB,"
-	  "os_cache_dirty_max=0,os_cache_max=0,prefix_compression=,split_pct=75"
-	  ",value_format=u,version=(major=0,minor=0)",
+	  "allocation_size=512B,block_allocation=best,block_compressor=,"
+	  "cache_resident=0,checkpoint=,checkpoint_lsn=0,checksum=on,collator=,"
+	  "columns=,dictionary=0,file_extend=0,format=btree,huffman_key=,"
+	  "huffman_value=,internal_item_max=0,internal_key_truncate=,"
+	  "internal_page_max=2KB,key_format=u,key_gap=10,leaf_item_max=0,"
+	  "leaf_page_max=1MB,memory_page_max=5MB,os_cache_dirty_max=0,"
+	  "os_cache_max=0,prefix_compression=,split_pct=75,value_format=u,"
+	  "version=(major=0,minor=0)",
 	  confchk_file_meta
 	},
 	{ "index.meta",
-	  "columns=,key_format=u,source=,type=file,value_format=u",
+	  "columns=,extractor=,key_format=u,source=,type=file,value_columns=,"
+	  "value_format=u",
 	  confchk_index_meta
 	},
 	{ "session.begin_transaction",
-	  "isolation=,name=,priority=0,sync=full",
+	  "isolation=,name=,priority=0,sync=",
 	  confchk_session_begin_transaction
 	},
 	{ "session.checkpoint",
@@ -322,24 +360,26 @@ static const WT_CONFIG_ENTRY config_entries[] = {
 	  NULL
 	},
 	{ "session.commit_transaction",
-	  "",
-	  NULL
+	  "sync=",
+	  confchk_session_commit_transaction
 	},
 	{ "session.compact",
 	  "trigger=30",
 	  confchk_session_compact
 	},
 	{ "session.create",
-	  "allocation_size=512B,block_compressor=,cache_resident=0,checksum=on,"
-	  "colgroups=,collator=,columns=,dictionary=0,exclusive=0,format=btree,"
+	  "allocation_size=512B,block_allocation=best,block_compressor=,"
+	  "cache_resident=0,checksum=on,colgroups=,collator=,columns=,"
+	  "dictionary=0,exclusive=0,extractor=,file_extend=0,format=btree,"
 	  "huffman_key=,huffman_value=,internal_item_max=0,"
 	  "internal_key_truncate=,internal_page_max=2KB,key_format=u,key_gap=10"
 	  ",leaf_item_max=0,leaf_page_max=1MB,lsm_auto_throttle=,lsm_bloom=,"
 	  "lsm_bloom_bit_count=8,lsm_bloom_config=,lsm_bloom_hash_count=4,"
 	  "lsm_bloom_newest=0,lsm_bloom_oldest=0,lsm_chunk_size=2MB,"
-	  "lsm_merge_max=15,lsm_merge_threads=1,memory_page_max=5MB,"
+	  "lsm_merge_max=15,lsm_merge_partitions=1,lsm_merge_policy=default,"
+	  "lsm_merge_ratio=10,lsm_merge_threads=1,memory_page_max=5MB,"
 	  "os_cache_dirty_max=0,os_cache_max=0,prefix_compression=,source=,"
-	  "split_pct=75,type=file,value_format=u",
+	  "split_pct=75,type=file,value_columns=,value_format=u",
 	  confchk_session_create
 	},
 	{ "session.drop",
@@ -389,13 +429,15 @@ static const WT_CONFIG_ENTRY config_entries[] = {
 	},
 	{ "wiredtiger_open",
 	  "buffer_alignment=-1,cache_size=100MB,"
-	  "checkpoint=(name=\"WiredTigerCheckpoint\",wait=0),create=0,"
-	  "direct_io=,error_prefix=,eviction_dirty_target=80,eviction_target=80"
-	  ",eviction_trigger=95,extensions=,hazard_max=1000,logging=0,"
-	  "lsm_merge=,mmap=,multiprocess=0,session_max=50,"
-	  "shared_cache=(chunk=10MB,name=pool,reserve=0,size=500MB),"
-	  "statistics=0,statistics_log=(clear=,path=\"WiredTigerStat.%H\","
-	  "sources=,timestamp=\"%b %d %H:%M:%S\",wait=0),sync=,transactional=,"
+	  "checkpoint=(name=\"WiredTigerCheckpoint\",wait=0),"
+	  "checkpoint_threads=0,create=0,cursor_cache=0,direct_io=,"
+	  "error_prefix=,eviction_dirty_target=80,eviction_target=80,"
+	  "eviction_trigger=95,eviction_workers=0,extensions=,hazard_max=1000,"
+	  "io_threads=0,logging=0,lsm_merge=,lsm_workers=4,mmap=,multiprocess=0"
+	  ",read_ahead=8,session_max=50,shared_cache=(chunk=10MB,name=pool,"
+	  "reserve=0,size=500MB),statistics=0,statistics_log=(clear=,"
+	  "path=\"WiredTigerStat.%H\",sources=,timestamp=\"%b %d %H:%M:%S\","
+	  "wait=0),sync=,transaction_sync=full,transactional=,"
 	  "use_environment_priv=0,verbose=",
 	  confchk_wiredtiger_open
 	},
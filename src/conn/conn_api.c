@@ -274,17 +274,49 @@ __conn_add_extractor(WT_CONNECTION *wt_conn,
 {
 	WT_CONNECTION_IMPL *conn;
 	WT_DECL_RET;
+	WT_NAMED_EXTRACTOR *nextractor;
 	WT_SESSION_IMPL *session;
 
-	WT_UNUSED(name);
-	WT_UNUSED(extractor);
-	ret = ENOTSUP;
+	nextractor = NULL;
 
 	conn = (WT_CONNECTION_IMPL *)wt_conn;
 	CONNECTION_API_CALL(conn, session, add_extractor, config, cfg);
 	WT_UNUSED(cfg);
 
-err:	API_END_NOTFOUND_MAP(session, ret);
+	WT_ERR(__wt_calloc_def(session, 1, &nextractor));
+	WT_ERR(__wt_strdup(session, name, &nextractor->name));
+	nextractor->extractor = extractor;
+
+	__wt_spin_lock(session, &conn->api_lock);
+	TAILQ_INSERT_TAIL(&conn->extractorqh, nextractor, q);
+	nextractor = NULL;
+	__wt_spin_unlock(session, &conn->api_lock);
+
+err:	if (nextractor != NULL) {
+		__wt_free(session, nextractor->name);
+		__wt_free(session, nextractor);
+	}
+
+	API_END_NOTFOUND_MAP(session, ret);
+}
+
+/*
+ * __conn_remove_extractor --
+ *	remove extractor added by WT_CONNECTION->add_extractor,
+ *	only used internally.
+ */
+static void
+__conn_remove_extractor(
+    WT_CONNECTION_IMPL *conn, WT_NAMED_EXTRACTOR *nextractor)
+{
+	WT_SESSION_IMPL *session;
+
+	session = conn->default_session;
+
+	/* Remove from the connection's list. */
+	TAILQ_REMOVE(&conn->extractorqh, nextractor, q);
+	__wt_free(session, nextractor->name);
+	__wt_free(session, nextractor);
 }
 
 /*
@@ -317,6 +349,26 @@ __conn_configure_method(WT_CONNECTION *wt_conn, const char *method,
 err:	API_END_NOTFOUND_MAP(session, ret);
 }
 
+/*
+ * __conn_compile_configuration --
+ *	WT_CONNECTION.compile_configuration method.
+ */
+static int
+__conn_compile_configuration(WT_CONNECTION *wt_conn,
+    const char *method, const char *config, const char **compiledp)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+	WT_SESSION_IMPL *session;
+
+	conn = (WT_CONNECTION_IMPL *)wt_conn;
+	CONNECTION_API_CALL_NOCONF(conn, session, compile_configuration);
+
+	ret = __wt_config_compile(session, method, config, compiledp);
+
+err:	API_END_NOTFOUND_MAP(session, ret);
+}
+
 /*
  * __conn_is_new --
  *	WT_CONNECTION->is_new method.
@@ -339,6 +391,7 @@ __conn_close(WT_CONNECTION *wt_conn, const char *config)
 	WT_NAMED_COLLATOR *ncoll;
 	WT_NAMED_COMPRESSOR *ncomp;
 	WT_NAMED_DATA_SOURCE *ndsrc;
+	WT_NAMED_EXTRACTOR *nextractor;
 	WT_SESSION *wt_session;
 	WT_SESSION_IMPL *s, *session;
 	uint32_t i;
@@ -374,6 +427,9 @@ __conn_close(WT_CONNECTION *wt_conn, const char *config)
 	F_CLR(conn, WT_CONN_SERVER_RUN);
 	WT_TRET(__wt_checkpoint_destroy(conn));
 	WT_TRET(__wt_statlog_destroy(conn));
+	WT_TRET(__wt_log_server_destroy(conn));
+	WT_TRET(__wt_sync_threads_destroy(conn));
+	WT_TRET(__wt_block_io_destroy(conn));
 
 	/* Clean up open LSM handles. */
 	WT_ERR(__wt_lsm_tree_close_all(session));
@@ -393,6 +449,10 @@ __conn_close(WT_CONNECTION *wt_conn, const char *config)
 	while ((ndsrc = TAILQ_FIRST(&conn->dsrcqh)) != NULL)
 		__conn_remove_data_source(conn, ndsrc);
 
+	/* Free memory for extractors */
+	while ((nextractor = TAILQ_FIRST(&conn->extractorqh)) != NULL)
+		__conn_remove_extractor(conn, nextractor);
+
 	WT_TRET(__wt_connection_close(conn));
 
 	/* We no longer have a session, don't try to update it. */
@@ -429,8 +489,16 @@ __conn_reconfigure(WT_CONNECTION *wt_conn, const char *config)
 	if ((ret =
 	    __wt_config_gets(session, raw_cfg, "statistics", &cval)) == 0) {
 		conn->statistics = cval.val == 0 ? 0 : 1;
-		if (conn->statistics)
+		if (conn->statistics) {
+			__wt_stat_shard_fold((WT_STATS *)&conn->stats,
+			    conn->stats_shards, conn->stat_shards,
+			    WT_STAT_COUNT(WT_CONNECTION_STATS),
+			    WT_STAT_SHARD_STRIDE(WT_CONNECTION_STATS));
 			__wt_stat_clear_connection_stats(&conn->stats);
+			WT_ERR(__wt_stat_shard_init(session,
+			    &conn->stats_shards, conn->stat_shards,
+			    WT_STAT_SHARD_STRIDE(WT_CONNECTION_STATS)));
+		}
 	}
 	WT_ERR_NOTFOUND_OK(ret);
 
@@ -811,6 +879,7 @@ __conn_verbose_config(WT_SESSION_IMPL *session, const char *cfg[])
 		{ "lsm",	WT_VERB_lsm },
 		{ "mutex",	WT_VERB_mutex },
 		{ "read",	WT_VERB_read },
+		{ "recovery",	WT_VERB_recovery },
 		{ "reconcile",	WT_VERB_reconcile },
 		{ "salvage",	WT_VERB_salvage },
 		{ "verify",	WT_VERB_verify },
@@ -855,7 +924,8 @@ wiredtiger_open(const char *home, WT_EVENT_HANDLER *event_handler,
 		__conn_add_collator,
 		__conn_add_compressor,
 		__conn_add_extractor,
-		__conn_get_extension_api
+		__conn_get_extension_api,
+		__conn_compile_configuration
 	};
 	static const struct {
 		const char *name;
@@ -926,6 +996,20 @@ wiredtiger_open(const char *home, WT_EVENT_HANDLER *event_handler,
 	conn->hazard_max = (uint32_t)cval.val;
 	WT_ERR(__wt_config_gets(session, cfg, "session_max", &cval));
 	conn->session_size = (uint32_t)cval.val + WT_NUM_INTERNAL_SESSIONS;
+	/*
+	 * Eviction workers, block I/O threads, sync threads, LSM workers and as
+	 * many LSM merge helper threads don't count against the application's
+	 * sessions.
+	 */
+	WT_ERR(__wt_config_gets(session, cfg, "eviction_workers", &cval));
+	conn->session_size += (uint32_t)cval.val;
+	WT_ERR(__wt_config_gets(session, cfg, "io_threads", &cval));
+	conn->session_size += (uint32_t)cval.val;
+	WT_ERR(__wt_config_gets(session, cfg, "checkpoint_threads", &cval));
+	conn->session_size += (uint32_t)cval.val;
+	WT_ERR(__wt_config_gets(session, cfg, "lsm_workers", &cval));
+	conn->lsm_workers = (u_int)cval.val;
+	conn->session_size += 2 * conn->lsm_workers;
 	WT_ERR(__wt_config_gets(session, cfg, "lsm_merge", &cval));
 	if (cval.val)
 		F_SET(conn, WT_CONN_LSM_MERGE);
@@ -941,10 +1025,18 @@ wiredtiger_open(const char *home, WT_EVENT_HANDLER *event_handler,
 
 	WT_ERR(__wt_conn_cache_pool_config(session, cfg));
 
+	/*
+	 * Open the log if logging is configured, or if there's an existing log
+	 * to recover: checkpoints must know the end of the log even when new
+	 * records aren't being written, otherwise recovery would replay old
+	 * records over later updates if logging is re-enabled.
+	 */
 	WT_ERR(__wt_config_gets(session, cfg, "logging", &cval));
 	if (cval.val != 0)
-		WT_ERR(__wt_open(
-		   session, WT_LOG_FILENAME, 1, 0, 0, &conn->log_fh));
+		F_SET(conn, WT_CONN_LOGGING);
+	WT_ERR(__wt_exist(session, WT_LOG_FILENAME, &exist));
+	if (exist || F_ISSET(conn, WT_CONN_LOGGING))
+		WT_ERR(__wt_log_open(session));
 
 	/* Configure direct I/O and buffer alignment. */
 	WT_ERR(__wt_config_gets(session, cfg, "buffer_alignment", &cval));
@@ -959,8 +1051,10 @@ wiredtiger_open(const char *home, WT_EVENT_HANDLER *event_handler,
 #endif
 
 	/*
-	 * Configuration: direct_io, mmap, statistics.
+	 * Configuration: cursor_cache, direct_io, mmap, read_ahead, statistics.
 	 */
+	WT_ERR(__wt_config_gets(session, cfg, "cursor_cache", &cval));
+	conn->cursor_cache = (u_int)cval.val;
 	WT_ERR(__wt_config_gets(session, cfg, "direct_io", &cval));
 	for (ft = directio_types; ft->name != NULL; ft++) {
 		ret = __wt_config_subgets(session, &cval, ft->name, &sval);
@@ -972,8 +1066,14 @@ wiredtiger_open(const char *home, WT_EVENT_HANDLER *event_handler,
 	}
 	WT_ERR(__wt_config_gets(session, cfg, "mmap", &cval));
 	conn->mmap = cval.val == 0 ? 0 : 1;
+	WT_ERR(__wt_config_gets(session, cfg, "read_ahead", &cval));
+	conn->read_ahead = (u_int)cval.val;
 	WT_ERR(__wt_config_gets(session, cfg, "statistics", &cval));
 	conn->statistics = cval.val == 0 ? 0 : 1;
+	if (conn->statistics)
+		WT_ERR(__wt_stat_shard_init(session,
+		    &conn->stats_shards, conn->stat_shards,
+		    WT_STAT_SHARD_STRIDE(WT_CONNECTION_STATS)));
 
 	/* Load any extensions referenced in the config. */
 	WT_ERR(__wt_config_gets(session, cfg, "extensions", &cval));
@@ -1023,6 +1123,9 @@ wiredtiger_open(const char *home, WT_EVENT_HANDLER *event_handler,
 	/* If there's a hot-backup file, load it. */
 	WT_ERR(__wt_metadata_load_backup(session));
 
+	/* Replay the log to recover updates made after the last checkpoint. */
+	WT_ERR(__wt_txn_recover(session));
+
 	STATIC_ASSERT(offsetof(WT_CONNECTION_IMPL, iface) == 0);
 	*wt_connp = &conn->iface;
 
@@ -65,6 +65,7 @@ int
 __wt_cache_create(WT_CONNECTION_IMPL *conn, const char *cfg[])
 {
 	WT_CACHE *cache;
+	WT_CONFIG_ITEM cval;
 	WT_DECL_RET;
 	WT_SESSION_IMPL *session;
 
@@ -80,6 +81,10 @@ __wt_cache_create(WT_CONNECTION_IMPL *conn, const char *cfg[])
 	/* Use a common routine for run-time configuration options. */
 	WT_RET(__wt_cache_config(conn, cfg));
 
+	/* The eviction server starts the workers, they can't be reconfigured. */
+	WT_RET(__wt_config_gets(session, cfg, "eviction_workers", &cval));
+	cache->eviction_workers = (u_int)cval.val;
+
 	/* Add the configured cache to the cache pool. */
 	if (F_ISSET(conn, WT_CONN_CACHE_POOL))
 		WT_RET(__wt_conn_cache_pool_open(session));
@@ -89,6 +89,7 @@ __conn_dhandle_get(WT_SESSION_IMPL *session,
 	WT_CONNECTION_IMPL *conn;
 	WT_DATA_HANDLE *dhandle;
 	WT_DECL_RET;
+	uint64_t bucket, hash;
 
 	conn = S2C(session);
 
@@ -96,8 +97,11 @@ __conn_dhandle_get(WT_SESSION_IMPL *session,
 	WT_ASSERT(session, F_ISSET(session, WT_SESSION_SCHEMA_LOCKED));
 
 	/* Increment the reference count if we already have the btree open. */
-	TAILQ_FOREACH(dhandle, &conn->dhqh, q)
-		if (strcmp(name, dhandle->name) == 0 &&
+	hash = __wt_hash_city64(name, (uint32_t)strlen(name));
+	bucket = WT_DHANDLE_BUCKET(hash);
+	TAILQ_FOREACH(dhandle, &conn->dhhash[bucket], hashq)
+		if (hash == dhandle->name_hash &&
+		    strcmp(name, dhandle->name) == 0 &&
 		    ((ckpt == NULL && dhandle->checkpoint == NULL) ||
 		    (ckpt != NULL && dhandle->checkpoint != NULL &&
 		    strcmp(ckpt, dhandle->checkpoint) == 0))) {
@@ -116,6 +120,7 @@ __conn_dhandle_get(WT_SESSION_IMPL *session,
 	WT_RET(__wt_calloc_def(session, 1, &dhandle));
 	WT_RET(__wt_calloc_def(session, 1, &btree));
 	dhandle->handle = btree;
+	dhandle->name_hash = hash;
 	btree->dhandle = dhandle;
 	if ((ret = __wt_rwlock_alloc(
 		session, "btree handle", &dhandle->rwlock)) == 0 &&
@@ -125,9 +130,10 @@ __conn_dhandle_get(WT_SESSION_IMPL *session,
 	    (ret = __wt_writelock(session, dhandle->rwlock)) == 0) {
 		F_SET(dhandle, WT_DHANDLE_EXCLUSIVE);
 
-		/* Add to the connection list. */
+		/* Add to the connection list and hash bucket. */
 		dhandle->refcnt = 1;
 		TAILQ_INSERT_TAIL(&conn->dhqh, dhandle, q);
+		TAILQ_INSERT_HEAD(&conn->dhhash[bucket], dhandle, hashq);
 	}
 
 	if (ret == 0)
@@ -404,14 +410,18 @@ __wt_conn_btree_apply_single(WT_SESSION_IMPL *session, const char *uri,
 	WT_CONNECTION_IMPL *conn;
 	WT_DATA_HANDLE *dhandle, *saved_dhandle;
 	WT_DECL_RET;
+	uint64_t bucket, hash;
 
 	conn = S2C(session);
 	saved_dhandle = session->dhandle;
 
 	WT_ASSERT(session, F_ISSET(session, WT_SESSION_SCHEMA_LOCKED));
 
-	TAILQ_FOREACH(dhandle, &conn->dhqh, q)
-		if (strcmp(dhandle->name, uri) == 0) {
+	hash = __wt_hash_city64(uri, (uint32_t)strlen(uri));
+	bucket = WT_DHANDLE_BUCKET(hash);
+	TAILQ_FOREACH(dhandle, &conn->dhhash[bucket], hashq)
+		if (hash == dhandle->name_hash &&
+		    strcmp(dhandle->name, uri) == 0) {
 			/*
 			 * We have the schema lock, which prevents handles being
 			 * opened or closed, so there is no need for additional
@@ -490,6 +500,7 @@ __wt_conn_dhandle_close_all(WT_SESSION_IMPL *session, const char *name)
 	WT_CONNECTION_IMPL *conn;
 	WT_DATA_HANDLE *dhandle, *saved_dhandle;
 	WT_DECL_RET;
+	uint64_t bucket, hash;
 
 	conn = S2C(session);
 
@@ -503,8 +514,11 @@ __wt_conn_dhandle_close_all(WT_SESSION_IMPL *session, const char *name)
 	    WT_META_TRACKING(session))
 		WT_ERR(__wt_meta_track_handle_lock(session, 0));
 
-	TAILQ_FOREACH(dhandle, &conn->dhqh, q) {
-		if (strcmp(dhandle->name, name) != 0)
+	hash = __wt_hash_city64(name, (uint32_t)strlen(name));
+	bucket = WT_DHANDLE_BUCKET(hash);
+	TAILQ_FOREACH(dhandle, &conn->dhhash[bucket], hashq) {
+		if (hash != dhandle->name_hash ||
+		    strcmp(dhandle->name, name) != 0)
 			continue;
 
 		session->dhandle = dhandle;
@@ -574,6 +588,7 @@ __wt_conn_dhandle_discard_single(
 	__wt_free(session, dhandle->checkpoint);
 	__conn_btree_config_clear(session);
 	__wt_free(session, dhandle->handle);
+	__wt_stat_shard_discard(session, &dhandle->stats_shards);
 	__wt_overwrite_and_free(session, dhandle);
 
 	WT_CLEAR_BTREE_IN_SESSION(session);
@@ -611,6 +626,8 @@ restart:
 			continue;
 
 		TAILQ_REMOVE(&conn->dhqh, dhandle, q);
+		TAILQ_REMOVE(&conn->dhhash[
+		    WT_DHANDLE_BUCKET(dhandle->name_hash)], dhandle, hashq);
 		WT_TRET(__wt_conn_dhandle_discard_single(session, dhandle));
 		goto restart;
 	}
@@ -627,6 +644,8 @@ restart:
 	/* Close the metadata file handle. */
 	while ((dhandle = TAILQ_FIRST(&conn->dhqh)) != NULL) {
 		TAILQ_REMOVE(&conn->dhqh, dhandle, q);
+		TAILQ_REMOVE(&conn->dhhash[
+		    WT_DHANDLE_BUCKET(dhandle->name_hash)], dhandle, hashq);
 		WT_TRET(__wt_conn_dhandle_discard_single(session, dhandle));
 	}
 
@@ -15,15 +15,19 @@ int
 __wt_connection_init(WT_CONNECTION_IMPL *conn)
 {
 	WT_SESSION_IMPL *session;
+	u_int i;
 
 	session = conn->default_session;
 
 	TAILQ_INIT(&conn->dhqh);		/* Data handle list */
+	for (i = 0; i < WT_HASH_ARRAY_SIZE; i++)
+		TAILQ_INIT(&conn->dhhash[i]);	/* Data handle hash lists */
 	TAILQ_INIT(&conn->dlhqh);		/* Library list */
 	TAILQ_INIT(&conn->dsrcqh);		/* Data source list */
 	TAILQ_INIT(&conn->fhqh);		/* File list */
 	TAILQ_INIT(&conn->collqh);		/* Collator list */
 	TAILQ_INIT(&conn->compqh);		/* Compressor list */
+	TAILQ_INIT(&conn->extractorqh);		/* Extractor list */
 
 	TAILQ_INIT(&conn->lsmqh);		/* WT_LSM_TREE list */
 
@@ -32,13 +36,21 @@ __wt_connection_init(WT_CONNECTION_IMPL *conn)
 
 	/* Statistics. */
 	__wt_stat_init_connection_stats(&conn->stats);
+	conn->stat_shards = __wt_stat_shard_count();
+	conn->stat_dsrc_shards =
+	    WT_MIN(conn->stat_shards, WT_STAT_DSRC_SHARDS_MAX);
 
 	/* Locks. */
 	__wt_spin_init(session, &conn->api_lock);
 	__wt_spin_init(session, &conn->fh_lock);
 	__wt_spin_init(session, &conn->metadata_lock);
 	__wt_spin_init(session, &conn->schema_lock);
-	__wt_spin_init(session, &conn->serial_lock);
+	WT_RET(__wt_calloc(session, WT_PAGE_LOCKS + 1,
+	    sizeof(WT_PAGE_LOCK_SLOT), &conn->page_lock_mem));
+	conn->page_lock = (WT_PAGE_LOCK_SLOT *)(uintptr_t)WT_ALIGN(
+	    conn->page_lock_mem, WT_CACHE_LINE_ALIGNMENT);
+	for (i = 0; i < WT_PAGE_LOCKS; ++i)
+		__wt_spin_init(session, &conn->page_lock[i].lock);
 
 	/*
 	 * Block manager.
@@ -48,6 +60,13 @@ __wt_connection_init(WT_CONNECTION_IMPL *conn)
 	 */
 	__wt_spin_init(session, &conn->block_lock);
 	TAILQ_INIT(&conn->blockqh);		/* Block manager list */
+	__wt_spin_init(session, &conn->io_lock);
+	TAILQ_INIT(&conn->ioqh);		/* Block write queue */
+	TAILQ_INIT(&conn->iowaitqh);		/* Block write waiters */
+	__wt_spin_init(session, &conn->sync_lock);
+	TAILQ_INIT(&conn->syncqh);		/* Sync batch queue */
+	__wt_spin_init(session, &conn->lsm_lock);
+	TAILQ_INIT(&conn->lsmworkqh);		/* LSM work queue */
 
 	return (0);
 }
@@ -61,6 +80,7 @@ __wt_connection_destroy(WT_CONNECTION_IMPL *conn)
 {
 	WT_DECL_RET;
 	WT_SESSION_IMPL *session;
+	u_int i;
 
 	/* Check there's something to destroy. */
 	if (conn == NULL)
@@ -76,9 +96,6 @@ __wt_connection_destroy(WT_CONNECTION_IMPL *conn)
 	if (conn->lock_fh != NULL)
 		WT_TRET(__wt_close(session, conn->lock_fh));
 
-	if (conn->log_fh != NULL)
-		WT_TRET(__wt_close(session, conn->log_fh));
-
 	/* Remove from the list of connections. */
 	__wt_spin_lock(session, &__wt_process.spinlock);
 	TAILQ_REMOVE(&__wt_process.connqh, conn, q);
@@ -93,12 +110,19 @@ __wt_connection_destroy(WT_CONNECTION_IMPL *conn)
 	__wt_spin_destroy(session, &conn->fh_lock);
 	__wt_spin_destroy(session, &conn->metadata_lock);
 	__wt_spin_destroy(session, &conn->schema_lock);
-	__wt_spin_destroy(session, &conn->serial_lock);
+	if (conn->page_lock != NULL)
+		for (i = 0; i < WT_PAGE_LOCKS; ++i)
+			__wt_spin_destroy(session, &conn->page_lock[i].lock);
 	__wt_spin_destroy(session, &conn->block_lock);
+	__wt_spin_destroy(session, &conn->io_lock);
+	__wt_spin_destroy(session, &conn->sync_lock);
+	__wt_spin_destroy(session, &conn->lsm_lock);
 
 	/* Free allocated memory. */
 	__wt_free(session, conn->home);
 	__wt_free(session, conn->sessions);
+	__wt_free(session, conn->page_lock_mem);
+	__wt_stat_shard_discard(session, &conn->stats_shards);
 
 	__wt_free(NULL, conn);
 	return (ret);
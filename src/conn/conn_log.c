@@ -0,0 +1,108 @@
+/*-
+ * Copyright (c) 2008-2013 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+/*
+ * __log_server --
+ *	The log server thread: write log records that were buffered without
+ * waiting, so transactions committed with "sync=write" reach the operating
+ * system within a bounded time.
+ */
+static void *
+__log_server(void *arg)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+	WT_LOG *log;
+	WT_SESSION_IMPL *session;
+
+	session = arg;
+	conn = S2C(session);
+	log = conn->log;
+
+	while (F_ISSET(conn, WT_CONN_SERVER_RUN)) {
+		/* Write anything buffered since the last group write. */
+		__wt_spin_lock(session, &log->lock);
+		if (log->write_lsn < log->alloc_lsn && !log->writing)
+			ret = __wt_log_flush(session, WT_LOG_FLUSH);
+		__wt_spin_unlock(session, &log->lock);
+		WT_ERR(ret);
+
+		/* Wait... */
+		WT_ERR(__wt_cond_wait(
+		    session, conn->log_cond, WT_LOG_SERVER_USECS));
+	}
+
+	if (0) {
+err:		__wt_err(session, ret, "log server error");
+	}
+	return (NULL);
+}
+
+/*
+ * __wt_log_server_create -
+ *	Start the log server thread.
+ */
+int
+__wt_log_server_create(WT_CONNECTION_IMPL *conn, const char *cfg[])
+{
+	WT_SESSION_IMPL *session;
+
+	WT_UNUSED(cfg);
+	session = conn->default_session;
+
+	/* If there's no log, we're done. */
+	if (conn->log == NULL)
+		return (0);
+
+	/* The log server gets its own session. */
+	WT_RET(__wt_open_session(conn, 1, NULL, NULL, &conn->log_session));
+	conn->log_session->name = "log-server";
+
+	WT_RET(__wt_cond_alloc(session, "log server", 0, &conn->log_cond));
+
+	/*
+	 * Start the thread.
+	 */
+	WT_RET(__wt_thread_create(
+	    session, &conn->log_tid, __log_server, conn->log_session));
+	conn->log_tid_set = 1;
+
+	return (0);
+}
+
+/*
+ * __wt_log_server_destroy -
+ *	Destroy the log server thread.
+ */
+int
+__wt_log_server_destroy(WT_CONNECTION_IMPL *conn)
+{
+	WT_DECL_RET;
+	WT_SESSION *wt_session;
+	WT_SESSION_IMPL *session;
+
+	session = conn->default_session;
+
+	if (conn->log_tid_set) {
+		WT_TRET(__wt_cond_signal(session, conn->log_cond));
+		WT_TRET(__wt_thread_join(session, conn->log_tid));
+		conn->log_tid_set = 0;
+	}
+	WT_TRET(__wt_cond_destroy(session, &conn->log_cond));
+
+	/* Close the server thread's session, free its hazard array. */
+	if (conn->log_session != NULL) {
+		wt_session = &conn->log_session->iface;
+		WT_TRET(wt_session->close(wt_session, NULL));
+		__wt_free(session, conn->log_session->hazard);
+		conn->log_session = NULL;
+	}
+
+	return (ret);
+}
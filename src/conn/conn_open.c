@@ -40,6 +40,12 @@ __wt_connection_open(WT_CONNECTION_IMPL *conn, const char *cfg[])
 	/* Start worker threads. */
 	F_SET(conn, WT_CONN_EVICTION_RUN | WT_CONN_SERVER_RUN);
 
+	/* Start the optional block I/O threads, eviction writes blocks. */
+	WT_ERR(__wt_block_io_create(conn, cfg));
+
+	/* Start the optional sync threads. */
+	WT_ERR(__wt_sync_threads_create(conn, cfg));
+
 	/*
 	 * Start the eviction thread.
 	 *
@@ -59,6 +65,9 @@ __wt_connection_open(WT_CONNECTION_IMPL *conn, const char *cfg[])
 	/* Start the optional statistics thread. */
 	WT_ERR(__wt_statlog_create(conn, cfg));
 
+	/* Start the log server thread, if there's a log. */
+	WT_ERR(__wt_log_server_create(conn, cfg));
+
 	return (0);
 
 err:	WT_TRET(__wt_connection_close(conn));
@@ -81,12 +90,20 @@ __wt_connection_close(WT_CONNECTION_IMPL *conn)
 	wt_conn = (WT_CONNECTION *)conn;
 	session = conn->default_session;
 
+	/* Shut down the log server thread, flush and close the log. */
+	WT_TRET(__wt_log_server_destroy(conn));
+	WT_TRET(__wt_log_close(session));
+
+	/* Shut down the sync threads, then the block I/O threads. */
+	WT_TRET(__wt_sync_threads_destroy(conn));
+	WT_TRET(__wt_block_io_destroy(conn));
+
 	/*
-	 * Complain if files weren't closed (ignoring the lock and logging
-	 * files, we'll close them in a minute.
+	 * Complain if files weren't closed (ignoring the lock file, we'll
+	 * close it in a minute.
 	 */
 	TAILQ_FOREACH(fh, &conn->fhqh, q) {
-		if (fh == conn->lock_fh || fh == conn->log_fh)
+		if (fh == conn->lock_fh)
 			continue;
 
 		__wt_errx(session,
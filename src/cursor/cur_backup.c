@@ -127,6 +127,8 @@ __wt_curbackup_open(WT_SESSION_IMPL *session,
 	    __wt_cursor_notsup,		/* insert */
 	    __wt_cursor_notsup,		/* update */
 	    __wt_cursor_notsup,		/* remove */
+	    NULL,			/* search-batch */
+	    NULL,			/* insert-batch */
 	    __curbackup_close);		/* close */
 	WT_CURSOR *cursor;
 	WT_CURSOR_BACKUP *cb;
@@ -39,6 +39,8 @@ __wt_curconfig_open(WT_SESSION_IMPL *session,
 	    __wt_cursor_notsup,		/* insert */
 	    __wt_cursor_notsup,		/* update */
 	    __wt_cursor_notsup,		/* remove */
+	    NULL,			/* search-batch */
+	    NULL,			/* insert-batch */
 	    __curconfig_close);
 	WT_CURSOR_CONFIG *cconfig;
 	WT_CURSOR *cursor;
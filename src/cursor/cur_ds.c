@@ -282,6 +282,8 @@ __wt_curds_create(WT_SESSION_IMPL *session, const char *uri,
 	    __curds_insert,		/* insert */
 	    __curds_update,		/* update */
 	    __curds_remove,		/* remove */
+	    NULL,			/* search-batch */
+	    NULL,			/* insert-batch */
 	    __curds_close);		/* close */
 	WT_CONFIG_ITEM cval;
 	WT_CURSOR *cursor, *dsc;
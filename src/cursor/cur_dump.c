@@ -303,6 +303,8 @@ __wt_curdump_create(WT_CURSOR *child, WT_CURSOR *owner, WT_CURSOR **cursorp)
 	    __curdump_insert,		/* insert */
 	    __curdump_update,		/* update */
 	    __curdump_remove,		/* remove */
+	    NULL,			/* search-batch */
+	    NULL,			/* insert-batch */
 	    __curdump_close);		/* close */
 	WT_CURSOR *cursor;
 	WT_CURSOR_DUMP *cdump;
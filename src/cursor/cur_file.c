@@ -178,6 +178,57 @@ err:	CURSOR_UPDATE_API_END(session, ret);
 	return (ret);
 }
 
+/*
+ * __curfile_search_batch --
+ *	WT_CURSOR->search_batch method for the btree cursor type.
+ */
+static int
+__curfile_search_batch(WT_CURSOR *cursor,
+    WT_ITEM *keys, WT_ITEM *values, int *results, size_t nitems)
+{
+	WT_CURSOR_BTREE *cbt;
+	WT_DECL_RET;
+	WT_SESSION_IMPL *session;
+
+	cbt = (WT_CURSOR_BTREE *)cursor;
+
+	/* Column-stores search for each key in turn. */
+	if (cbt->btree->type != BTREE_ROW)
+		return (__wt_cursor_search_batch(
+		    cursor, keys, values, results, nitems));
+
+	CURSOR_API_CALL(cursor, session, search_batch, cbt->btree);
+	ret = __wt_btcur_search_batch(cbt, keys, values, results, nitems);
+
+err:	API_END(session);
+	return (ret);
+}
+
+/*
+ * __curfile_insert_batch --
+ *	WT_CURSOR->insert_batch method for the btree cursor type.
+ */
+static int
+__curfile_insert_batch(
+    WT_CURSOR *cursor, WT_ITEM *keys, WT_ITEM *values, size_t nitems)
+{
+	WT_CURSOR_BTREE *cbt;
+	WT_DECL_RET;
+	WT_SESSION_IMPL *session;
+
+	cbt = (WT_CURSOR_BTREE *)cursor;
+
+	/* Column-stores insert each record in turn. */
+	if (cbt->btree->type != BTREE_ROW)
+		return (__wt_cursor_insert_batch(cursor, keys, values, nitems));
+
+	CURSOR_UPDATE_API_CALL(cursor, session, insert_batch, cbt->btree);
+	ret = __wt_btcur_insert_batch(cbt, keys, values, nitems);
+
+err:	CURSOR_UPDATE_API_END(session, ret);
+	return (ret);
+}
+
 /*
  * __curfile_update --
  *	WT_CURSOR->update method for the btree cursor type.
@@ -262,12 +313,170 @@ __curfile_close(WT_CURSOR *cursor)
 		WT_TRET(__wt_session_release_btree(session));
 	/* The URI is owned by the btree handle. */
 	cursor->uri = NULL;
-	WT_TRET(__wt_cursor_close(cursor));
+
+	/*
+	 * Keep the cursor for reuse if it can be cached and the session's cache
+	 * isn't full.  Cached cursors don't hold their btree handle, so they
+	 * don't block operations needing exclusive access to the object.
+	 */
+	if (ret == 0 && cbt->cache_uri != NULL &&
+	    session->ncursor_cache < S2C(session)->cursor_cache) {
+		TAILQ_REMOVE(&session->cursors, cursor, q);
+		TAILQ_INSERT_HEAD(&session->cursor_cache, cursor, q);
+		++session->ncursor_cache;
+	} else {
+		__wt_free(session, cbt->cache_uri);
+		__wt_free(session, cbt->cache_cfg);
+		WT_TRET(__wt_cursor_close(cursor));
+	}
 
 err:	API_END(session);
 	return (ret);
 }
 
+/*
+ * __curfile_cache_free --
+ *	Free a cached cursor.
+ */
+static void
+__curfile_cache_free(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt)
+{
+	__wt_free(session, cbt->cache_uri);
+	__wt_free(session, cbt->cache_cfg);
+	__wt_buf_free(session, &cbt->iface.key);
+	__wt_buf_free(session, &cbt->iface.value);
+	__wt_free(session, cbt);
+}
+
+/*
+ * __wt_curfile_cache_discard --
+ *	Discard a session's cached cursors.
+ */
+void
+__wt_curfile_cache_discard(WT_SESSION_IMPL *session)
+{
+	WT_CURSOR *cursor;
+
+	while ((cursor = TAILQ_FIRST(&session->cursor_cache)) != NULL) {
+		TAILQ_REMOVE(&session->cursor_cache, cursor, q);
+		__curfile_cache_free(session, (WT_CURSOR_BTREE *)cursor);
+	}
+	session->ncursor_cache = 0;
+}
+
+/*
+ * __curfile_cache_ok --
+ *	Return if a cursor open can use the session's cursor cache: only cursors
+ * opened by the application or at the top level of an internal operation, with
+ * the standard configuration layout, are cached.
+ */
+static int
+__curfile_cache_ok(
+    WT_SESSION_IMPL *session, WT_CURSOR *owner, const char *cfg[])
+{
+	return (owner == NULL && S2C(session)->cursor_cache != 0 &&
+	    cfg != NULL &&
+	    cfg[0] == WT_CONFIG_BASE(session, session_open_cursor) &&
+	    (cfg[1] == NULL || cfg[2] == NULL));
+}
+
+/*
+ * __curfile_cache_get --
+ *	Return a cached cursor matching the URI and configuration, if there is
+ * one.
+ */
+static int
+__curfile_cache_get(WT_SESSION_IMPL *session,
+    const char *uri, const char *cfg[], WT_CURSOR **cursorp)
+{
+	WT_BTREE *btree;
+	WT_CURSOR *cursor;
+	WT_CURSOR_BTREE *cbt;
+	WT_DECL_RET;
+	const char *config;
+
+	*cursorp = NULL;
+
+	config = cfg[1] == NULL ? "" : cfg[1];
+	TAILQ_FOREACH(cursor, &session->cursor_cache, q) {
+		cbt = (WT_CURSOR_BTREE *)cursor;
+		if (strcmp(uri, cbt->cache_uri) == 0 &&
+		    strcmp(config, cbt->cache_cfg) == 0)
+			break;
+	}
+	if (cursor == NULL)
+		return (0);
+	TAILQ_REMOVE(&session->cursor_cache, cursor, q);
+	--session->ncursor_cache;
+
+	/*
+	 * Get the handle and lock it while the cursor is using it.  If the
+	 * object was dropped and re-created while the cursor was cached, the
+	 * cursor is stale: discard it and have the caller open a new cursor.
+	 */
+	if ((ret = __wt_session_get_btree(session, uri, NULL, cfg, 0)) != 0) {
+		__curfile_cache_free(session, cbt);
+		return (ret);
+	}
+	btree = S2BT(session);
+	if (cbt->btree != btree) {
+		ret = __wt_session_release_btree(session);
+		__curfile_cache_free(session, cbt);
+		return (ret);
+	}
+
+	/*
+	 * Reset the cursor's state.  The handle may have been closed and
+	 * re-opened while the cursor was cached, reset anything owned by it.
+	 */
+	memset(&cbt->page, 0,
+	    sizeof(WT_CURSOR_BTREE) - WT_PTRDIFF(&cbt->page, cbt));
+	cursor->uri = btree->dhandle->name;
+	cursor->key_format = btree->key_format;
+	cursor->value_format = btree->value_format;
+	cursor->recno = 0;
+	cursor->saved_err = 0;
+	F_CLR(cursor, WT_CURSTD_KEY_SET | WT_CURSTD_VALUE_SET);
+	if (!WT_CURSOR_RECNO(cursor))
+		F_CLR(cursor, WT_CURSTD_APPEND);
+
+	TAILQ_INSERT_HEAD(&session->cursors, cursor, q);
+
+	WT_CSTAT_INCR(session, cursor_cache_reuse);
+
+	*cursorp = cursor;
+	return (0);
+}
+
+/*
+ * __curfile_cache_init --
+ *	Configure a newly opened cursor to be cached when it's closed.
+ */
+static int
+__curfile_cache_init(WT_SESSION_IMPL *session,
+    WT_CURSOR *cursor, const char *uri, const char *cfg[])
+{
+	WT_CURSOR_BTREE *cbt;
+	WT_DECL_RET;
+
+	cbt = (WT_CURSOR_BTREE *)cursor;
+
+	/*
+	 * Dump cursors are wrapped, random retrieval and checkpoint cursors
+	 * are configured when the cursor is opened: don't cache them.
+	 */
+	if (cursor->close != __curfile_close ||
+	    cursor->next == __curfile_next_random ||
+	    cbt->btree->dhandle->checkpoint != NULL)
+		return (0);
+
+	WT_RET(__wt_strdup(session, uri, &cbt->cache_uri));
+	if ((ret = __wt_strdup(session,
+	    cfg[1] == NULL ? "" : cfg[1], &cbt->cache_cfg)) != 0)
+		__wt_free(session, cbt->cache_uri);
+	return (ret);
+}
+
 /*
  * __wt_curfile_create --
  *	Open a cursor for a given btree handle.
@@ -291,6 +500,8 @@ __wt_curfile_create(WT_SESSION_IMPL *session,
 	    __curfile_insert,		/* insert */
 	    __curfile_update,		/* update */
 	    __curfile_remove,		/* remove */
+	    __curfile_search_batch,	/* search-batch */
+	    __curfile_insert_batch,	/* insert-batch */
 	    __curfile_close);		/* close */
 	WT_BTREE *btree;
 	WT_CONFIG_ITEM cval;
@@ -358,6 +569,14 @@ __wt_curfile_open(WT_SESSION_IMPL *session, const char *uri,
 
 	flags = 0;
 
+	/* Check for a cached cursor before doing any other work. */
+	if (__curfile_cache_ok(session, owner, cfg) &&
+	    session->ncursor_cache != 0) {
+		WT_RET(__curfile_cache_get(session, uri, cfg, cursorp));
+		if (*cursorp != NULL)
+			return (0);
+	}
+
 	WT_RET(__wt_config_gets_defno(session, cfg, "bulk", &cval));
 	if (cval.type == WT_CONFIG_ITEM_BOOL ||
 	    (cval.type == WT_CONFIG_ITEM_NUM &&
@@ -383,7 +602,14 @@ __wt_curfile_open(WT_SESSION_IMPL *session, const char *uri,
 		WT_RET(__wt_bad_object_type(session, uri));
 
 	WT_ERR(__wt_curfile_create(session, owner, cfg, bulk, bitmap, cursorp));
-	return (0);
+
+	/* Bulk cursors require exclusive access, don't cache them. */
+	if (!bulk && __curfile_cache_ok(session, owner, cfg) &&
+	    (ret = __curfile_cache_init(session, *cursorp, uri, cfg)) != 0) {
+		WT_TRET((*cursorp)->close(*cursorp));
+		*cursorp = NULL;
+	}
+	return (ret);
 
 err:	/* If the cursor could not be opened, release the handle. */
 	WT_TRET(__wt_session_release_btree(session));
@@ -14,6 +14,7 @@
 static int
 __curindex_get_value(WT_CURSOR *cursor, ...)
 {
+	WT_CURSOR **cp;
 	WT_CURSOR_INDEX *cindex;
 	WT_DECL_RET;
 	WT_ITEM *item;
@@ -24,10 +25,13 @@ __curindex_get_value(WT_CURSOR *cursor, ...)
 	CURSOR_API_CALL(cursor, session, get_value, NULL);
 	WT_CURSOR_NEEDVALUE(cursor);
 
+	/* Covered values are projected from the index itself. */
+	cp = cindex->covered ? &cindex->child : cindex->cg_cursors;
+
 	va_start(ap, cursor);
 	if (F_ISSET(cursor, WT_CURSTD_RAW)) {
 		ret = __wt_schema_project_merge(session,
-		    cindex->cg_cursors, cindex->value_plan,
+		    cp, cindex->value_plan,
 		    cursor->value_format, &cursor->value);
 		if (ret == 0) {
 			item = va_arg(ap, WT_ITEM *);
@@ -36,7 +40,7 @@ __curindex_get_value(WT_CURSOR *cursor, ...)
 		}
 	} else
 		ret = __wt_schema_project_out(session,
-		    cindex->cg_cursors, cindex->value_plan, ap);
+		    cp, cindex->value_plan, ap);
 	va_end(ap);
 
 err:	API_END(session);
@@ -60,6 +64,47 @@ err:	cursor->saved_err = ret;
 	API_END(session);
 }
 
+/*
+ * __curindex_extract_primary --
+ *	Set a column group cursor's key from the primary key that follows the
+ * extracted columns in the key of an index with a custom extractor.
+ */
+static int
+__curindex_extract_primary(WT_CURSOR_INDEX *cindex, WT_CURSOR *cursor)
+{
+	WT_DECL_RET;
+	WT_PACK idxpack, pack;
+	WT_PACK_VALUE idxpv, pv;
+	WT_SESSION_IMPL *session;
+	const uint8_t *p, *end;
+
+	session = (WT_SESSION_IMPL *)cindex->iface.session;
+	p = cindex->child->key.data;
+	end = p + cindex->child->key.size;
+
+	/*
+	 * Skip the extracted columns: they're packed in the file's key format,
+	 * the index cursor's format only says how many there are.
+	 */
+	WT_RET(__pack_init(session, &idxpack, cindex->index->idxkey_format));
+	WT_RET(__pack_init(session, &pack, cindex->index->key_format));
+	while ((ret = __pack_next(&idxpack, &idxpv)) == 0 &&
+	    (ret = __pack_next(&pack, &pv)) == 0)
+		WT_RET(__unpack_read(session, &pv, &p, (size_t)(end - p)));
+	WT_RET_NOTFOUND_OK(ret);
+
+	if (WT_CURSOR_RECNO(cursor)) {
+		WT_RET(__wt_struct_unpack(session,
+		    p, (size_t)(end - p), "r", &cursor->recno));
+		cursor->key.data = &cursor->recno;
+		cursor->key.size = sizeof(cursor->recno);
+	} else {
+		cursor->key.data = p;
+		cursor->key.size = WT_STORE_SIZE(end - p);
+	}
+	return (0);
+}
+
 /*
  * __curindex_move --
  *	When an index cursor changes position, set the primary key in the
@@ -76,7 +121,12 @@ __curindex_move(WT_CURSOR_INDEX *cindex)
 	first = NULL;
 
 	/* Point the public cursor to the key in the child. */
-	__wt_cursor_set_raw_key(&cindex->iface, &cindex->child->key);
+	if (cindex->index->extract_repack)
+		WT_RET(__wt_struct_repack(session,
+		    cindex->index->key_format, cindex->iface.key_format,
+		    &cindex->child->key, &cindex->iface.key));
+	else
+		__wt_cursor_set_raw_key(&cindex->iface, &cindex->child->key);
 	F_CLR(&cindex->iface, WT_CURSTD_KEY_SET | WT_CURSTD_VALUE_SET);
 
 	for (i = 0, cp = cindex->cg_cursors;
@@ -84,7 +134,10 @@ __curindex_move(WT_CURSOR_INDEX *cindex)
 	    i++, cp++) {
 		if (*cp == NULL)
 			continue;
-		if (first == NULL) {
+		if (first == NULL && cindex->index->extractor != NULL) {
+			WT_RET(__curindex_extract_primary(cindex, *cp));
+			first = *cp;
+		} else if (first == NULL) {
 			/*
 			 * Set the primary key -- note that we need the primary
 			 * key columns, so we have to use the full key format,
@@ -182,6 +235,31 @@ err:	API_END(session);
 	return (ret);
 }
 
+/*
+ * __curindex_set_child_key --
+ *	Set the child cursor's key from the public cursor's key for a search.
+ */
+static int
+__curindex_set_child_key(WT_CURSOR_INDEX *cindex)
+{
+	WT_CURSOR *cursor;
+	WT_SESSION_IMPL *session;
+
+	cursor = &cindex->iface;
+	session = (WT_SESSION_IMPL *)cursor->session;
+
+	if (cindex->index->extract_repack)
+		WT_RET(__wt_struct_repack(session, cursor->key_format,
+		    cindex->index->key_format, &cursor->key,
+		    &cindex->search_key));
+	else {
+		cindex->search_key.data = cursor->key.data;
+		cindex->search_key.size = cursor->key.size;
+	}
+	__wt_cursor_set_raw_key(cindex->child, &cindex->search_key);
+	return (0);
+}
+
 /*
  * __curindex_search --
  *	WT_CURSOR->search method for index cursors.
@@ -203,7 +281,7 @@ __curindex_search(WT_CURSOR *cursor)
 	 * We expect partial matches, but we want the smallest item that
 	 * matches the prefix.  Fail if there is no matching item.
 	 */
-	__wt_cursor_set_raw_key(child, &cursor->key);
+	WT_ERR(__curindex_set_child_key(cindex));
 	WT_ERR(child->search_near(child, &exact));
 
 	/*
@@ -216,8 +294,9 @@ __curindex_search(WT_CURSOR *cursor)
 	if (exact < 0)
 		WT_ERR(child->next(child));
 
-	if (child->key.size < cursor->key.size ||
-	    memcmp(child->key.data, cursor->key.data, cursor->key.size) != 0) {
+	if (child->key.size < cindex->search_key.size ||
+	    memcmp(child->key.data,
+	    cindex->search_key.data, cindex->search_key.size) != 0) {
 		ret = WT_NOTFOUND;
 		goto err;
 	}
@@ -245,7 +324,7 @@ __curindex_search_near(WT_CURSOR *cursor, int *exact)
 
 	cindex = (WT_CURSOR_INDEX *)cursor;
 	CURSOR_API_CALL(cursor, session, search_near, NULL);
-	__wt_cursor_set_raw_key(cindex->child, &cursor->key);
+	WT_ERR(__curindex_set_child_key(cindex));
 	if ((ret = cindex->child->search_near(cindex->child, exact)) == 0)
 		ret = __curindex_move(cindex);
 	else
@@ -287,9 +366,12 @@ __curindex_close(WT_CURSOR *cursor)
 		__wt_free(session, cindex->key_plan);
 	if (cursor->value_format != cindex->table->value_format)
 		__wt_free(session, cursor->value_format);
-	if (cindex->value_plan != idx->value_plan)
+	if (cindex->value_plan != idx->value_plan &&
+	    cindex->value_plan != idx->cover_plan)
 		__wt_free(session, cindex->value_plan);
 
+	__wt_buf_free(session, &cindex->search_key);
+
 	if (cindex->child != NULL)
 		WT_TRET(cindex->child->close(cindex->child));
 
@@ -318,6 +400,10 @@ __curindex_open_colgroups(
 	WT_RET(__wt_calloc_def(session, WT_COLGROUPS(table), &cp));
 	cindex->cg_cursors = cp;
 
+	/* Covered values don't need any column groups. */
+	if (cindex->covered)
+		return (0);
+
 	/* Work out which column groups we need. */
 	for (proj = (char *)cindex->value_plan; *proj != '\0'; proj++) {
 		arg = (uint32_t)strtoul(proj, &proj, 10);
@@ -354,6 +440,8 @@ __wt_curindex_open(WT_SESSION_IMPL *session,
 	    __wt_cursor_notsup,		/* insert */
 	    __wt_cursor_notsup,		/* update */
 	    __wt_cursor_notsup,		/* remove */
+	    NULL,			/* search-batch */
+	    NULL,			/* insert-batch */
 	    __curindex_close);		/* close */
 	WT_CURSOR_INDEX *cindex;
 	WT_CURSOR *cursor;
@@ -423,10 +511,22 @@ __wt_curindex_open(WT_SESSION_IMPL *session,
 		    columns, strlen(columns), NULL, 0, &fmt));
 		cursor->value_format = __wt_buf_steal(session, &fmt, NULL);
 
+		/*
+		 * Read the columns from the index if it stores all of them,
+		 * otherwise from the table's column groups.
+		 */
 		WT_CLEAR(plan);
-		WT_ERR(__wt_struct_plan(session, table,
-		    columns, strlen(columns), 0, &plan));
+		if ((ret = __wt_struct_plan_index(session,
+		    idx, columns, strlen(columns), &plan)) == 0)
+			cindex->covered = 1;
+		else if (ret == WT_NOTFOUND)
+			ret = __wt_struct_plan(session, table,
+			    columns, strlen(columns), 0, &plan);
+		WT_ERR(ret);
 		cindex->value_plan = __wt_buf_steal(session, &plan, NULL);
+	} else if (idx->cover_plan != NULL) {
+		cindex->value_plan = idx->cover_plan;
+		cindex->covered = 1;
 	}
 
 	/* Open the column groups needed for this index cursor. */
@@ -295,22 +295,56 @@ err:	API_END(session);
 	return (ret);
 }
 
+/*
+ * __curstat_shard_init --
+ *	Copy a statistics structure and its sharded counters into the cursor,
+ * optionally clearing the structure.
+ */
+static int
+__curstat_shard_init(WT_SESSION_IMPL *session, WT_CURSOR_STAT *cst,
+    WT_STATS *stats, uint64_t *shards, u_int nshards, size_t count,
+    size_t stride, void (*clear_func)(void *), uint32_t flags)
+{
+	WT_RET(__wt_calloc_def(session, count, &cst->stats));
+	memcpy(cst->stats, stats, count * sizeof(WT_STATS));
+	__wt_stat_shard_sum(cst->stats, shards, nshards, count, stride);
+
+	/*
+	 * Clear the statistics once they're copied, there's no need to wait
+	 * until the cursor is closed.
+	 */
+	if (LF_ISSET(WT_STATISTICS_CLEAR)) {
+		__wt_stat_shard_fold(stats, shards, nshards, count, stride);
+		clear_func(stats);
+	}
+
+	cst->notpositioned = 1;
+	cst->stats_first = cst->stats;
+	cst->stats_count = (int)count;
+	cst->clear_func = NULL;
+	return (0);
+}
+
 /*
  * __curstat_conn_init --
  *	Initialize the statistics for a connection.
  */
-static void
+static int
 __curstat_conn_init(
     WT_SESSION_IMPL *session, WT_CURSOR_STAT *cst, uint32_t flags)
 {
+	WT_CONNECTION_IMPL *conn;
+
+	conn = S2C(session);
+
 	__wt_conn_stat_init(session, flags);
 
 	cst->btree = NULL;
-	cst->notpositioned = 1;
-	cst->stats_first = (WT_STATS *)&S2C(session)->stats;
-	cst->stats_count = sizeof(S2C(session)->stats) / sizeof(WT_STATS);
-	cst->clear_func = LF_ISSET(WT_STATISTICS_CLEAR) ?
-	    __wt_stat_clear_connection_stats : NULL;
+	return (__curstat_shard_init(session, cst,
+	    (WT_STATS *)&conn->stats, conn->stats_shards, conn->stat_shards,
+	    WT_STAT_COUNT(WT_CONNECTION_STATS),
+	    WT_STAT_SHARD_STRIDE(WT_CONNECTION_STATS),
+	    __wt_stat_clear_connection_stats, flags));
 }
 
 /*
@@ -322,18 +356,28 @@ __curstat_file_init(WT_SESSION_IMPL *session,
     const char *uri, const char *cfg[], WT_CURSOR_STAT *cst, uint32_t flags)
 {
 	WT_BTREE *btree;
+	WT_DATA_HANDLE *dhandle;
 
 	WT_RET(__wt_session_get_btree_ckpt(session, uri, cfg, 0));
 	btree = S2BT(session);
+	dhandle = btree->dhandle;
+	cst->btree = btree;
+
 	WT_RET(__wt_btree_stat_init(session, flags));
 
-	cst->btree = btree;
-	cst->notpositioned = 1;
-	cst->stats_first = (WT_STATS *)&btree->dhandle->stats;
-	cst->stats_count = sizeof(WT_DSRC_STATS) / sizeof(WT_STATS);
-	cst->clear_func = LF_ISSET(WT_STATISTICS_CLEAR) ?
-	    __wt_stat_clear_dsrc_stats : NULL;
-	return (0);
+	/*
+	 * Statistics are being read from the handle, shard its counters from
+	 * now on.
+	 */
+	WT_RET(__wt_stat_shard_init(session, &dhandle->stats_shards,
+	    S2C(session)->stat_dsrc_shards,
+	    WT_STAT_SHARD_STRIDE(WT_DSRC_STATS)));
+
+	return (__curstat_shard_init(session, cst,
+	    (WT_STATS *)&dhandle->stats, dhandle->stats_shards,
+	    S2C(session)->stat_dsrc_shards,
+	    WT_STAT_COUNT(WT_DSRC_STATS), WT_STAT_SHARD_STRIDE(WT_DSRC_STATS),
+	    __wt_stat_clear_dsrc_stats, flags));
 }
 
 /*
@@ -370,10 +414,9 @@ int
 __wt_curstat_init(WT_SESSION_IMPL *session,
     const char *uri, const char *cfg[], WT_CURSOR_STAT *cst, uint32_t flags)
 {
-	if (strcmp(uri, "statistics:") == 0) {
-		__curstat_conn_init(session, cst, flags);
-		return (0);
-	} else if (WT_PREFIX_MATCH(uri, "statistics:file:"))
+	if (strcmp(uri, "statistics:") == 0)
+		return (__curstat_conn_init(session, cst, flags));
+	else if (WT_PREFIX_MATCH(uri, "statistics:file:"))
 		return (__curstat_file_init(session,
 		    uri + strlen("statistics:"), cfg, cst, flags));
 	else if (WT_PREFIX_MATCH(uri, "statistics:lsm:"))
@@ -405,6 +448,8 @@ __wt_curstat_open(WT_SESSION_IMPL *session,
 	    __wt_cursor_notsup,		/* insert */
 	    __wt_cursor_notsup,		/* update */
 	    __wt_cursor_notsup,		/* remove */
+	    NULL,			/* search-batch */
+	    NULL,			/* insert-batch */
 	    __curstat_close);		/* close */
 	WT_CONFIG_ITEM cval;
 	WT_CURSOR *cursor;
@@ -19,6 +19,39 @@ __wt_cursor_notsup(WT_CURSOR *cursor)
 	return (ENOTSUP);
 }
 
+/*
+ * __cursor_search_batch_notsup --
+ *	Unsupported cursor search_batch.
+ */
+static int
+__cursor_search_batch_notsup(WT_CURSOR *cursor,
+    WT_ITEM *keys, WT_ITEM *values, int *results, size_t nitems)
+{
+	WT_UNUSED(cursor);
+	WT_UNUSED(keys);
+	WT_UNUSED(values);
+	WT_UNUSED(results);
+	WT_UNUSED(nitems);
+
+	return (ENOTSUP);
+}
+
+/*
+ * __cursor_insert_batch_notsup --
+ *	Unsupported cursor insert_batch.
+ */
+static int
+__cursor_insert_batch_notsup(
+    WT_CURSOR *cursor, WT_ITEM *keys, WT_ITEM *values, size_t nitems)
+{
+	WT_UNUSED(cursor);
+	WT_UNUSED(keys);
+	WT_UNUSED(values);
+	WT_UNUSED(nitems);
+
+	return (ENOTSUP);
+}
+
 /* 
  * __wt_cursor_noop --
  *	Cursor noop.
@@ -55,6 +88,8 @@ __wt_cursor_set_notsup(WT_CURSOR *cursor)
 	cursor->insert = __wt_cursor_notsup;
 	cursor->update = __wt_cursor_notsup;
 	cursor->remove = __wt_cursor_notsup;
+	cursor->search_batch = __cursor_search_batch_notsup;
+	cursor->insert_batch = __cursor_insert_batch_notsup;
 }
 
 /*
@@ -363,6 +398,123 @@ __cursor_search(WT_CURSOR *cursor)
 	return ((exact == 0) ? 0 : WT_NOTFOUND);
 }
 
+/*
+ * __wt_cursor_batch_append --
+ *	Append a value found by a batch search to a buffer.
+ */
+int
+__wt_cursor_batch_append(
+    WT_SESSION_IMPL *session, WT_ITEM *buf, WT_ITEM *value)
+{
+	size_t size;
+
+	size = buf->size + value->size;
+	if (size > buf->memsize)
+		WT_RET(__wt_buf_grow(session, buf, WT_MAX(size, 2 * buf->memsize)));
+	memcpy((uint8_t *)buf->mem + buf->size, value->data, value->size);
+	buf->size = WT_STORE_SIZE(size);
+	return (0);
+}
+
+/*
+ * __wt_cursor_batch_return --
+ *	Return the values found by a batch search: the values were appended
+ * to a buffer in the order the keys were searched for, a NULL order means
+ * the order of the keys.  The values are copied into the cursor's value
+ * buffer, so they remain valid until the cursor is next used.
+ */
+int
+__wt_cursor_batch_return(WT_SESSION_IMPL *session,
+    WT_CURSOR *cursor, WT_ITEM *buf,
+    WT_ITEM *values, int *results, size_t *order, size_t nitems)
+{
+	size_t i, j;
+	uint8_t *p;
+
+	WT_RET(__wt_buf_set(session, &cursor->value, buf->mem, buf->size));
+	F_CLR(cursor, WT_CURSTD_VALUE_SET);
+
+	for (p = cursor->value.mem, j = 0; j < nitems; ++j) {
+		i = order == NULL ? j : order[j];
+		if (results[i] != 0)
+			continue;
+		values[i].data = p;
+		p += values[i].size;
+	}
+	return (0);
+}
+
+/*
+ * __wt_cursor_search_batch --
+ *	WT_CURSOR->search_batch default implementation.
+ */
+int
+__wt_cursor_search_batch(WT_CURSOR *cursor,
+    WT_ITEM *keys, WT_ITEM *values, int *results, size_t nitems)
+{
+	WT_DECL_ITEM(buf);
+	WT_DECL_RET;
+	WT_SESSION_IMPL *session;
+	size_t i;
+	uint32_t raw;
+
+	session = (WT_SESSION_IMPL *)cursor->session;
+
+	/* Keys and values are raw items, whatever the cursor's formats. */
+	raw = F_ISSET(cursor, WT_CURSTD_RAW);
+	F_SET(cursor, WT_CURSTD_RAW);
+
+	WT_ERR(__wt_scr_alloc(session, 0, &buf));
+	for (i = 0; i < nitems; ++i) {
+		cursor->set_key(cursor, &keys[i]);
+		if ((ret = cursor->search(cursor)) == 0) {
+			WT_ERR(cursor->get_value(cursor, &values[i]));
+			WT_ERR(__wt_cursor_batch_append(
+			    session, buf, &values[i]));
+		} else if (ret != WT_NOTFOUND)
+			goto err;
+		results[i] = ret;
+	}
+	ret = 0;
+
+	WT_ERR(cursor->reset(cursor));
+	WT_ERR(__wt_cursor_batch_return(
+	    session, cursor, buf, values, results, NULL, nitems));
+
+err:	if (!raw)
+		F_CLR(cursor, WT_CURSTD_RAW);
+	__wt_scr_free(&buf);
+	return (ret);
+}
+
+/*
+ * __wt_cursor_insert_batch --
+ *	WT_CURSOR->insert_batch default implementation.
+ */
+int
+__wt_cursor_insert_batch(
+    WT_CURSOR *cursor, WT_ITEM *keys, WT_ITEM *values, size_t nitems)
+{
+	WT_DECL_RET;
+	size_t i;
+	uint32_t raw;
+
+	/* Keys and values are raw items, whatever the cursor's formats. */
+	raw = F_ISSET(cursor, WT_CURSTD_RAW);
+	F_SET(cursor, WT_CURSTD_RAW);
+
+	for (i = 0; i < nitems; ++i) {
+		cursor->set_key(cursor, &keys[i]);
+		cursor->set_value(cursor, &values[i]);
+		WT_ERR(cursor->insert(cursor));
+	}
+
+err:	WT_TRET(cursor->reset(cursor));
+	if (!raw)
+		F_CLR(cursor, WT_CURSTD_RAW);
+	return (ret);
+}
+
 /*
  * __wt_cursor_close --
  *	WT_CURSOR->close default implementation.
@@ -504,6 +656,10 @@ __wt_cursor_init(WT_CURSOR *cursor,
 		cursor->update = __wt_cursor_notsup;
 	if (cursor->remove == NULL)
 		cursor->remove = __wt_cursor_notsup;
+	if (cursor->search_batch == NULL)
+		cursor->search_batch = __wt_cursor_search_batch;
+	if (cursor->insert_batch == NULL)
+		cursor->insert_batch = __wt_cursor_insert_batch;
 	if (cursor->close == NULL)
 		WT_RET_MSG(session, EINVAL, "cursor lacks a close method");
 	if (cursor->compare == NULL)
@@ -27,10 +27,19 @@ static int __curtable_update(WT_CURSOR *cursor);
 	__cp = (ctable)->idx_cursors;					\
 	for (__i = 0; __i < ctable->table->nindices; __i++, __cp++) {	\
 		idx = ctable->table->indices[__i];			\
+		if (idx->extractor != NULL) {				\
+			WT_ERR(__curtable_extract(			\
+			    ctable, idx, *__cp, (*__cp)->f));		\
+			continue;					\
+		}							\
 		WT_ERR(__wt_schema_project_merge(session,		\
 		    ctable->cg_cursors,					\
 		    idx->key_plan, idx->key_format, &(*__cp)->key));	\
-		if (idx->need_value) {					\
+		if (idx->store_plan != NULL)				\
+			WT_ERR(__wt_schema_project_merge(session,	\
+			    ctable->cg_cursors, idx->store_plan,	\
+			    idx->value_format, &(*__cp)->value));	\
+		else if (idx->need_value) {				\
 			(*__cp)->value.data = "";			\
 			(*__cp)->value.size = 1;			\
 		}							\
@@ -40,6 +49,131 @@ static int __curtable_update(WT_CURSOR *cursor);
 	}								\
 } while (0)
 
+/*
+ * __curextract_insert --
+ *	WT_CURSOR->insert method for the cursor passed to extractors: append
+ * the primary key to the extracted key and apply the change to the index.
+ */
+static int
+__curextract_insert(WT_CURSOR *cursor)
+{
+	WT_CURSOR *child;
+	WT_CURSOR_EXTRACTOR *cextract;
+	WT_DECL_RET;
+	WT_ITEM *key;
+	WT_SESSION_IMPL *session;
+	size_t size;
+
+	cextract = (WT_CURSOR_EXTRACTOR *)cursor;
+	child = cextract->child;
+	CURSOR_API_CALL(cursor, session, insert, NULL);
+	WT_CURSOR_NEEDKEY(cursor);
+
+	key = &child->key;
+	if (cextract->index->extract_repack)
+		WT_ERR(__wt_struct_repack(session, cursor->key_format,
+		    cextract->index->key_format, &cursor->key, key));
+	else
+		WT_ERR(__wt_buf_set(
+		    session, key, cursor->key.data, cursor->key.size));
+	size = key->size;
+	WT_ERR(__wt_buf_grow(session, key, size + cextract->primary_key->size));
+	memcpy((uint8_t *)key->mem + size,
+	    cextract->primary_key->data, cextract->primary_key->size);
+	key->size = WT_STORE_SIZE(size + cextract->primary_key->size);
+	if (cextract->index->need_value) {
+		child->value.data = "";
+		child->value.size = 1;
+	}
+	F_SET(child, WT_CURSTD_KEY_APP | WT_CURSTD_VALUE_APP);
+
+	/*
+	 * An extractor may generate the same key more than once for a record:
+	 * only the first insert or remove of the key finds work to do.
+	 */
+	if ((ret = cextract->f(child)) == WT_DUPLICATE_KEY ||
+	    ret == WT_NOTFOUND)
+		ret = 0;
+
+err:	API_END(session);
+	return (ret);
+}
+
+/*
+ * __curtable_extract --
+ *	Call an index's extractor for the current record, inserting or
+ * removing each index key it generates.
+ */
+static int
+__curtable_extract(WT_CURSOR_TABLE *ctable,
+    WT_INDEX *idx, WT_CURSOR *child, int (*f)(WT_CURSOR *))
+{
+	WT_CURSOR_STATIC_INIT(iface,
+	    __wt_cursor_get_key,		/* get-key */
+	    __wt_cursor_notsup,			/* get-value */
+	    __wt_cursor_set_key,		/* set-key */
+	    __wt_cursor_notsup,			/* set-value */
+	    __wt_cursor_notsup,			/* compare */
+	    __wt_cursor_notsup,			/* next */
+	    __wt_cursor_notsup,			/* prev */
+	    __wt_cursor_noop,			/* reset */
+	    __wt_cursor_notsup,			/* search */
+	    __wt_cursor_notsup,			/* search-near */
+	    __curextract_insert,		/* insert */
+	    __wt_cursor_notsup,			/* update */
+	    __wt_cursor_notsup,			/* remove */
+	    NULL,				/* search-batch */
+	    NULL,				/* insert-batch */
+	    __wt_cursor_notsup);		/* close */
+	WT_CURSOR *primary;
+	WT_CURSOR_EXTRACTOR cextract;
+	WT_DECL_ITEM(key);
+	WT_DECL_ITEM(value);
+	WT_DECL_RET;
+	WT_SESSION_IMPL *session;
+	WT_TABLE *table;
+	size_t size;
+
+	session = (WT_SESSION_IMPL *)ctable->iface.session;
+	table = ctable->table;
+	primary = *ctable->cg_cursors;
+
+	WT_CLEAR(cextract);
+	cextract.iface = iface;
+	cextract.iface.session = &session->iface;
+	cextract.iface.uri = idx->name;
+	cextract.iface.key_format = idx->idxkey_format;
+	cextract.iface.value_format = "";
+	cextract.index = idx;
+	cextract.child = child;
+	cextract.f = f;
+
+	/*
+	 * Extractors see the primary key and the whole value of the record,
+	 * packed in the table's formats, whatever the cursor's projection.
+	 */
+	WT_ERR(__wt_scr_alloc(session, 0, &value));
+	WT_ERR(__wt_schema_project_merge(session,
+	    ctable->cg_cursors, table->plan, table->value_format, value));
+	if (WT_CURSOR_RECNO(primary)) {
+		WT_ERR(__wt_scr_alloc(session, 0, &key));
+		WT_ERR(__wt_struct_size(session, &size, "r", primary->recno));
+		WT_ERR(__wt_buf_initsize(session, key, size));
+		WT_ERR(__wt_struct_pack(
+		    session, key->mem, size, "r", primary->recno));
+		cextract.primary_key = key;
+	} else
+		cextract.primary_key = &primary->key;
+
+	WT_ERR(idx->extractor->extract(idx->extractor, &session->iface,
+	    cextract.primary_key, value, &cextract.iface));
+
+err:	__wt_buf_free(session, &cextract.iface.key);
+	__wt_scr_free(&key);
+	__wt_scr_free(&value);
+	return (ret);
+}
+
 /*
  * __wt_curtable_get_key --
  *	WT_CURSOR->get_key implementation for tables.
@@ -721,6 +855,8 @@ __wt_curtable_open(WT_SESSION_IMPL *session,
 	    __curtable_insert,			/* insert */
 	    __curtable_update,			/* update */
 	    __curtable_remove,			/* remove */
+	    NULL,				/* search-batch */
+	    NULL,				/* insert-batch */
 	    __curtable_close);			/* close */
 	WT_CONFIG_ITEM cval;
 	WT_CURSOR *cursor;
@@ -91,6 +91,20 @@ struct __wt_size {
 	WT_SIZE *next[0];			/* Size skiplist */
 };
 
+/*
+ * In segregated allocation mode, blocks freed in the live checkpoint that are
+ * up to WT_BLOCK_SIZE_CLASSES allocation units in size aren't merged into the
+ * avail list, they're kept on per-size lists of free extents (linked through
+ * the WT_EXT.next[0] entry), and reused without searching the avail list.
+ * The per-size lists are merged into the avail list, coalescing adjacent free
+ * extents, when the avail list is needed: when checkpointing the file, before
+ * extending it, and when more than WT_BLOCK_SIZE_CLASS_MAX extents are on the
+ * lists.  The lists aren't used while the file is being compacted: compaction
+ * depends on allocating the lowest offset of the best-fit size.
+ */
+#define	WT_BLOCK_SIZE_CLASSES		128
+#define	WT_BLOCK_SIZE_CLASS_MAX		1024
+
 /*
  * WT_EXT_FOREACH --
  *	Walk a block manager skiplist.
@@ -152,6 +166,7 @@ struct __wt_bm {
 	    (WT_BM *, WT_SESSION_IMPL *, const uint8_t *, uint32_t, int *);
 	int (*compact_skip)(WT_BM *, WT_SESSION_IMPL *, int, int *);
 	int (*free)(WT_BM *, WT_SESSION_IMPL *, const uint8_t *, uint32_t);
+	int (*preload)(WT_BM *, WT_SESSION_IMPL *, const uint8_t *, uint32_t);
 	int (*read)
 	    (WT_BM *, WT_SESSION_IMPL *, WT_ITEM *, const uint8_t *, uint32_t);
 	int (*salvage_end)(WT_BM *, WT_SESSION_IMPL *);
@@ -181,6 +196,51 @@ struct __wt_bm {
 	int is_live;				/* The live system */
 };
 
+/*
+ * WT_BLOCK_IO --
+ *	A block write queued for the connection's I/O threads.  The write stays
+ * on the queue until it completes, so reads and writes of the same blocks can
+ * wait for it, and until it succeeds, so reads of the block can be satisfied
+ * from the copy.  Preallocations of file space are queued the same way, but
+ * don't hold up reads or writes.
+ */
+struct __wt_block_io {
+	WT_BLOCK *block;			/* Block handle */
+	off_t	  offset;			/* File offset */
+	uint32_t  size;				/* Write size */
+	WT_ITEM	  buf;				/* Copy of the block */
+	int	  extend;			/* Preallocate, don't write */
+
+	int	  active;			/* Being written */
+	int	  error;			/* Failed write, to retry */
+	TAILQ_ENTRY(__wt_block_io) q;		/* Connection's write queue */
+};
+
+/*
+ * WT_BLOCK_IO_WAITER --
+ *	A thread waiting for queued writes to complete, signalled each time a
+ * queued write completes or fails.
+ */
+struct __wt_block_io_waiter {
+	WT_CONDVAR *cond;			/* Waiting session's condvar */
+	TAILQ_ENTRY(__wt_block_io_waiter) q;	/* Connection's wait queue */
+};
+
+/*
+ * Writes are written by the thread writing the page when more than this many
+ * bytes are queued.
+ */
+#define	WT_BLOCK_IO_QUEUE_MAX	(32 * WT_MEGABYTE)
+
+/*
+ * WT_BLOCK_IO_THREAD --
+ *	Encapsulation of a block I/O thread.
+ */
+struct __wt_block_io_thread {
+	WT_SESSION_IMPL *session;
+	pthread_t tid;
+};
+
 /*
  * WT_BLOCK --
  *	Block manager handle, references a single file.
@@ -202,6 +262,16 @@ struct __wt_block {
 	int64_t	 os_cache_dirty;	/* System buffer cache write max */
 	int64_t	 os_cache_dirty_max;
 
+	int	 alloc_segregated;	/* Segregated allocation */
+	WT_EXT	*size_class[WT_BLOCK_SIZE_CLASSES];
+	u_int	 size_class_cnt;	/* Extents on the per-size lists */
+	u_int	 compact_ckpts;		/* Checkpoints left in compaction */
+
+	off_t	 extend_size;		/* File preallocation chunk */
+	off_t	 extend_len;		/* End of preallocated space */
+	off_t	 extend_off;		/* Scheduled preallocation offset */
+	off_t	 extend_pending;	/* Scheduled preallocation length */
+
 	/*
 	 * There is only a single checkpoint in a file that can be written.  The
 	 * information could logically live in the WT_BM structure, but then we
@@ -212,6 +282,9 @@ struct __wt_block {
 	WT_SPINLOCK	live_lock;	/* Live checkpoint lock */
 	WT_BLOCK_CKPT	live;		/* Live checkpoint */
 
+	/* Background writes, locked by the connection's I/O lock. */
+	u_int	io_pending;		/* Queued and active writes */
+
 	/*
 	 * Array of free WT_EXTLIST structures, if we're doing lots of I/O,
 	 * a cache avoids an allocation/free while holding the spin lock.
@@ -14,6 +14,7 @@ struct __wt_bloom {
 	const char *uri;
 	char *config;
 	uint8_t *bitstring;     /* For in memory representation. */
+	uint8_t *bitmap;	/* Finalized filter loaded into memory. */
 	WT_SESSION_IMPL *session;
 	WT_CURSOR *c;
 
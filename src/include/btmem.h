@@ -198,6 +198,17 @@ struct __wt_page_modify {
 					 * wraparound.
 					 */
 
+	/*
+	 * Modifications to the page are serialized by one of the connection's
+	 * page locks, chosen when the modify structure is allocated: threads
+	 * modifying different pages (or different trees) rarely contend.
+	 */
+#define	WT_PAGE_LOCK(s, p)						\
+	__wt_spin_lock((s), &S2C(s)->page_lock[(p)->modify->page_lock].lock)
+#define	WT_PAGE_UNLOCK(s, p)						\
+	__wt_spin_unlock((s), &S2C(s)->page_lock[(p)->modify->page_lock].lock)
+	u_int page_lock;		/* Page's lock */
+
 #define	WT_PM_REC_EMPTY		0x01	/* Reconciliation: page empty */
 #define	WT_PM_REC_REPLACE	0x02	/* Reconciliation: page replaced */
 #define	WT_PM_REC_SPLIT		0x04	/* Reconciliation: page split */
@@ -428,6 +439,15 @@ struct __wt_ref {
 	wt_txnid_t txnid;		/* Transaction ID */
 
 	volatile WT_PAGE_STATE state;	/* Page state */
+
+	/*
+	 * Count of hazard pointers set on the page, eviction checks the count
+	 * instead of reviewing every session's hazard pointers.  The count is
+	 * in the WT_REF rather than the page: a reader may increment it after
+	 * the page has been evicted and before it sees the changed state, and
+	 * the reference outlives the page.
+	 */
+	volatile uint32_t pin_count;	/* Hazard pointers to the page */
 };
 
 /*
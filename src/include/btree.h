@@ -124,3 +124,37 @@ struct __wt_salvage_cookie {
 
 	int	 done;				/* Ignore the rest */
 };
+
+/*
+ * WT_SYNC_BATCH --
+ *	A batch of dirty leaf pages of a file, reconciled in parallel by the
+ * connection's sync threads and the thread flushing the file.  The flushing
+ * thread holds a hazard reference to each page until the batch completes.
+ */
+struct __wt_sync_batch {
+	WT_DATA_HANDLE *dhandle;		/* File being flushed */
+	int	 isolation;			/* Flushing isolation */
+	WT_CONDVAR *cond;			/* Flushing session's condvar */
+
+	WT_PAGE **pages;			/* Pages to reconcile */
+	u_int	 npages;			/* Pages in the batch */
+	u_int	 max;				/* Maximum pages in a batch */
+
+	u_int	 next;				/* Locked: next page to claim */
+	u_int	 done;				/* Locked: pages reconciled */
+	int	 ret;				/* Locked: first error */
+
+	int	 queued;			/* Locked: on the queue */
+	TAILQ_ENTRY(__wt_sync_batch) q;		/* Connection's sync queue */
+};
+
+#define	WT_SYNC_BATCH_MAX	64		/* Pages in a sync batch */
+
+/*
+ * WT_SYNC_THREAD --
+ *	Encapsulation of a sync thread.
+ */
+struct __wt_sync_thread {
+	WT_SESSION_IMPL *session;
+	pthread_t tid;
+};
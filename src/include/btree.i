@@ -225,6 +225,12 @@ __wt_page_modify_init(WT_SESSION_IMPL *session, WT_PAGE *page)
 
 	WT_RET(__wt_calloc_def(session, 1, &modify));
 
+	/*
+	 * Spread pages across the page locks; the count isn't protected, the
+	 * lock chosen doesn't matter as long as it doesn't change.
+	 */
+	modify->page_lock = S2C(session)->page_lock_cnt++ % WT_PAGE_LOCKS;
+
 	/*
 	 * Multiple threads of control may be searching and deciding to modify
 	 * a page.  If our modify structure is used, update the page's memory
@@ -509,34 +515,15 @@ __wt_page_swap_func(
  * __wt_page_hazard_check --
  *	Return if there's a hazard pointer to the page in the system.
  */
-static inline WT_HAZARD *
-__wt_page_hazard_check(WT_SESSION_IMPL *session, WT_PAGE *page)
+static inline int
+__wt_page_hazard_check(WT_REF *ref)
 {
-	WT_CONNECTION_IMPL *conn;
-	WT_HAZARD *hp;
-	WT_SESSION_IMPL *s;
-	uint32_t i, hazard_size, session_cnt;
-
-	conn = S2C(session);
-
 	/*
-	 * No lock is required because the session array is fixed size, but it
-	 * may contain inactive entries.  We must review any active session
-	 * that might contain a hazard pointer, so insert a barrier before
-	 * reading the active session count.  That way, no matter what sessions
-	 * come or go, we'll check the slots for all of the sessions that could
-	 * have been active when we started our check.
+	 * Our caller has locked the page's reference, which is a full barrier:
+	 * any reader that set a hazard pointer after our check will see the
+	 * locked state and give up the page.
 	 */
-	WT_ORDERED_READ(session_cnt, conn->session_cnt);
-	for (s = conn->sessions, i = 0; i < session_cnt; ++s, ++i) {
-		if (!s->active)
-			continue;
-		WT_ORDERED_READ(hazard_size, s->hazard_size);
-		for (hp = s->hazard; hp < s->hazard + hazard_size; ++hp)
-			if (hp->page == page)
-				return (hp);
-	}
-	return (NULL);
+	return (ref->pin_count != 0);
 }
 
 /*
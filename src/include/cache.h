@@ -25,6 +25,16 @@ struct __wt_evict_entry {
 	WT_PAGE	 *page;				/* Page to flush/evict */
 };
 
+/*
+ * WT_EVICT_WORKER --
+ *	Encapsulation of an eviction worker thread.
+ */
+struct __wt_evict_worker {
+	WT_SESSION_IMPL *session;
+	u_int id;
+	pthread_t tid;
+};
+
 /*
  * WiredTiger cache structure.
  */
@@ -61,6 +71,9 @@ struct __wt_cache {
 	u_int eviction_target;		/* Percent to end eviction */
 	u_int eviction_dirty_target;    /* Percent to allow dirty */
 
+	u_int eviction_workers;		/* Number of eviction workers */
+	WT_EVICT_WORKER *workers;	/* Eviction worker threads */
+
 	/*
 	 * LRU eviction list information.
 	 */
@@ -90,6 +103,7 @@ struct __wt_cache {
 	 */
 #define	WT_EVICT_NO_PROGRESS	0x01	/* Check if pages are being evicted */
 #define	WT_EVICT_STUCK		0x02	/* Eviction server is stuck */
+#define	WT_EVICT_WORKER_RUN	0x04	/* Eviction workers running */
 	uint32_t flags;
 };
 
@@ -49,11 +49,13 @@ __wt_eviction_check(WT_SESSION_IMPL *session, int *read_lockoutp, int wake)
 static inline int
 __wt_cache_full_check(WT_SESSION_IMPL *session, int onepass)
 {
+	struct timespec start;
 	WT_BTREE *btree;
 	WT_DECL_RET;
 	int lockout, wake;
 
 	btree = S2BT(session);
+	start.tv_sec = 0;
 
 	/*
 	 * Only wake the eviction server the first time through here (if the
@@ -62,28 +64,37 @@ __wt_cache_full_check(WT_SESSION_IMPL *session, int onepass)
 	 * busier.
 	 */
 	for (wake = 0;; wake = (wake + 1) % 1000) {
-		WT_RET(__wt_eviction_check(session, &lockout, wake == 0));
+		WT_ERR(__wt_eviction_check(session, &lockout, wake == 0));
 		if (!lockout || F_ISSET(session,
 		    WT_SESSION_NO_CACHE_CHECK | WT_SESSION_SCHEMA_LOCKED))
-			return (0);
+			break;
 		if (btree != NULL &&
 		    F_ISSET(btree, WT_BTREE_BULK | WT_BTREE_NO_EVICTION))
-			return (0);
+			break;
+
+		/* Time how long the application waits for space. */
+		if (start.tv_sec == 0)
+			WT_CSTAT_LATENCY_START(session, start);
+
 		ret = __wt_evict_lru_page(session, 1);
 		if (ret == 0 && onepass)
-			return (0);
+			break;
 		else if (ret == WT_NOTFOUND)
 			/*
 			 * The eviction queue was empty - wait for it to
 			 * re-populate before trying again.
 			 */
-			WT_RET(__wt_cond_wait(session,
+			WT_ERR(__wt_cond_wait(session,
 			    S2C(session)->cache->evict_waiter_cond, 10000));
 		else if (ret != 0 && ret != EBUSY)
 			/*
 			 * We've dealt with expected returns - we came across
 			 * a real error.
 			 */
-			return (ret);
+			goto err;
 	}
+	ret = 0;
+
+err:	WT_CSTAT_LATENCY(session, latency_evict_wait, start);
+	return (ret);
 }
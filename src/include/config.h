@@ -22,6 +22,48 @@ struct __wt_config_check {
 	const WT_CONFIG_CHECK *subconfigs;
 };
 
+/*
+ * WT_CONFIG_COMPILED --
+ *	A configuration string compiled by WT_CONNECTION::compile_configuration:
+ * the string is checked once against its method and its keys and values, and
+ * those of the method's default configuration, are parsed once, so API calls
+ * passed the string look keys up without tokenizing it.
+ */
+struct __wt_config_compiled {
+	const WT_CONFIG_ENTRY *entry;	/* Method checked against */
+	const char *str;		/* String copy, in an arena */
+
+	WT_CONFIG_ITEM *keys;		/* String's keys and values */
+	WT_CONFIG_ITEM *values;
+	u_int nitems;
+
+	WT_CONFIG_ITEM *base_keys;	/* Method's default keys and values */
+	WT_CONFIG_ITEM *base_values;
+	u_int nbase;
+};
+
+/*
+ * WT_CONFIG_ARENA --
+ *	Compiled strings are copied into arenas so they can be recognized by
+ * address.  Arenas never move once they are published, readers search them
+ * without locking: when one fills, a new arena twice the size is added to the
+ * front of the connection's list.
+ */
+struct __wt_config_arena {
+	WT_CONFIG_ARENA *next;		/* Next (older) arena */
+
+	char	*mem;			/* Compiled string copies */
+	size_t	 mem_size;		/* Arena bytes */
+	size_t	 mem_len;		/* Arena bytes used */
+
+	WT_CONFIG_COMPILED *compiled;	/* Compiled strings, by address */
+	u_int	 compiled_max;		/* Compiled string slots */
+	u_int	 compiled_cnt;		/* Compiled strings */
+};
+					/* Initial arena size */
+#define	WT_CONFIG_ARENA_COMPILED	64
+#define	WT_CONFIG_ARENA_SIZE		(4 * 1024)
+
 #define	WT_CONFIG_REF(session, n)					\
 	(S2C(session)->config_entries[WT_CONFIG_ENTRY_##n])
 struct __wt_config_entry {
@@ -53,12 +53,34 @@ struct __wt_named_data_source {
 	TAILQ_ENTRY(__wt_named_data_source) q;
 };
 
+/*
+ * WT_NAMED_EXTRACTOR --
+ *	An extractor list entry
+ */
+struct __wt_named_extractor {
+	const char *name;		/* Name of extractor */
+	WT_EXTRACTOR *extractor;	/* User supplied object */
+					/* Linked list of extractors */
+	TAILQ_ENTRY(__wt_named_extractor) q;
+};
+
 /*
  * Allocate some additional slots for internal sessions.  There is a default
  * session for each connection, plus a session for the eviction thread.
  */
 #define	WT_NUM_INTERNAL_SESSIONS	2
 
+/*
+ * WT_PAGE_LOCK_SLOT --
+ *	A page lock, padded to a cache line so threads taking different page
+ * locks don't contend for the same line.
+ */
+#define	WT_CACHE_LINE_ALIGNMENT	64
+union __wt_page_lock_slot {
+	WT_SPINLOCK lock;
+	uint8_t pad[WT_ALIGN(sizeof(WT_SPINLOCK), WT_CACHE_LINE_ALIGNMENT)];
+};
+
 /*
  * WT_CONNECTION_IMPL --
  *	Implementation of WT_CONNECTION
@@ -74,7 +96,16 @@ struct __wt_connection_impl {
 	WT_SPINLOCK fh_lock;		/* File handle queue spinlock */
 	WT_SPINLOCK metadata_lock;	/* Metadata spinlock */
 	WT_SPINLOCK schema_lock;	/* Schema operation spinlock */
-	WT_SPINLOCK serial_lock;	/* Serial function call spinlock */
+
+	/*
+	 * Serialized page modifications take one of a set of page locks, see
+	 * WT_PAGE_LOCK.  The array is aligned to a cache line, it's allocated
+	 * with an extra slot to allow for the alignment.
+	 */
+#define	WT_PAGE_LOCKS		256
+	WT_PAGE_LOCK_SLOT *page_lock;	/* Page locks */
+	void	   *page_lock_mem;	/* Page lock allocation */
+	u_int	    page_lock_cnt;	/* Next page lock to assign */
 
 					/* Connection queue */
 	TAILQ_ENTRY(__wt_connection_impl) q;
@@ -91,6 +122,9 @@ struct __wt_connection_impl {
 					/* Configuration */
 	const WT_CONFIG_ENTRY **config_entries;
 
+					/* Compiled configuration strings */
+	WT_CONFIG_ARENA *config_arena;
+
 	void  **foc;			/* Free-on-close array */
 	size_t  foc_cnt;		/* Array entries */
 	size_t  foc_size;		/* Array size */
@@ -102,6 +136,8 @@ struct __wt_connection_impl {
 
 					/* Locked: data handle list */
 	TAILQ_HEAD(__wt_dhandle_qh, __wt_data_handle) dhqh;
+					/* Locked: data handle hash array */
+	TAILQ_HEAD(__wt_dhhash, __wt_data_handle) dhhash[WT_HASH_ARRAY_SIZE];
 					/* Locked: LSM handle list. */
 	TAILQ_HEAD(__wt_lsm_qh, __wt_lsm_tree) lsmqh;
 					/* Locked: file list */
@@ -112,6 +148,31 @@ struct __wt_connection_impl {
 	WT_SPINLOCK block_lock;		/* Locked: block manager list */
 	TAILQ_HEAD(__wt_block_qh, __wt_block) blockqh;
 
+	WT_SPINLOCK io_lock;		/* Locked: block write queue */
+	TAILQ_HEAD(__wt_block_io_qh, __wt_block_io) ioqh;
+					/* Locked: threads waiting for writes */
+	TAILQ_HEAD(__wt_block_io_waitqh, __wt_block_io_waiter) iowaitqh;
+	uint64_t io_bytes;		/* Bytes queued and being written */
+	int	 io_run;		/* Queue accepting writes */
+	u_int	 io_next;		/* Next I/O thread to wake */
+	u_int	 io_threads;		/* Count of I/O threads */
+	WT_BLOCK_IO_THREAD *io_thread;	/* I/O threads */
+
+	WT_SPINLOCK sync_lock;		/* Locked: sync batch queue */
+	TAILQ_HEAD(__wt_sync_qh, __wt_sync_batch) syncqh;
+	int	 sync_run;		/* Sync threads running */
+	u_int	 sync_threads;		/* Count of sync threads */
+	WT_SYNC_THREAD *sync_thread;	/* Sync threads */
+
+	WT_SPINLOCK lsm_lock;		/* Locked: LSM work queue */
+	TAILQ_HEAD(__wt_lsm_work_qh, __wt_lsm_work_unit) lsmworkqh;
+	int	 lsm_run;		/* LSM worker threads running */
+	u_int	 lsm_merging;		/* Workers running merges */
+	WT_CONDVAR *lsm_cond;		/* LSM worker wait mutex */
+	u_int	 lsm_workers;		/* Count of LSM worker threads */
+	u_int	 lsm_helpers;		/* Locked: merge helper threads */
+	WT_LSM_WORKER *lsm_worker;	/* LSM worker threads */
+
 	u_int open_btree_count;		/* Locked: open writable btree count */
 	u_int next_file_id;		/* Locked: file ID counter */
 
@@ -151,6 +212,9 @@ struct __wt_connection_impl {
 	long		 ckpt_usecs;	/* Checkpoint period */
 
 	WT_CONNECTION_STATS stats;	/* Connection statistics */
+	uint64_t	*stats_shards;	/* Sharded statistics counters */
+	u_int		 stat_shards;	/* Slots in sharded counters */
+	u_int		 stat_dsrc_shards;/* Slots in data-source counters */
 	int		 statistics;	/* Global statistics configuration */
 	WT_SESSION_IMPL *stat_session;	/* Statistics log session */
 	pthread_t	 stat_tid;	/* Statistics log thread */
@@ -165,7 +229,11 @@ struct __wt_connection_impl {
 	const char	*stat_stamp;	/* Statistics log entry timestamp */
 	long		 stat_usecs;	/* Statistics log period */
 
-	WT_FH	   *log_fh;		/* Logging file handle */
+	WT_LOG	   *log;		/* Logging subsystem */
+	WT_SESSION_IMPL *log_session;	/* Log server session */
+	pthread_t	 log_tid;	/* Log server thread */
+	int		 log_tid_set;	/* Log server thread set */
+	WT_CONDVAR	*log_cond;	/* Log server wait mutex */
 
 					/* Locked: collator list */
 	TAILQ_HEAD(__wt_coll_qh, __wt_named_collator) collqh;
@@ -176,6 +244,9 @@ struct __wt_connection_impl {
 					/* Locked: data source list */
 	TAILQ_HEAD(__wt_dsrc_qh, __wt_named_data_source) dsrcqh;
 
+					/* Locked: extractor list */
+	TAILQ_HEAD(__wt_extractor_qh, __wt_named_extractor) extractorqh;
+
 	FILE *msgfile;
 	void (*msgcall)(const WT_CONNECTION_IMPL *, const char *);
 
@@ -186,6 +257,8 @@ struct __wt_connection_impl {
 
 	uint32_t direct_io;		/* O_DIRECT configuration */
 	int	 mmap;			/* mmap configuration */
+	u_int	 read_ahead;		/* Pages to read ahead of scans */
+	u_int	 cursor_cache;		/* Closed cursors cached per session */
 	uint32_t verbose;
 
 	uint32_t flags;
@@ -22,6 +22,8 @@
 	insert,								\
 	update,								\
 	remove,								\
+	search_batch,							\
+	insert_batch,							\
 	close)								\
 	static const WT_CURSOR n = {					\
 	NULL,				/* session */			\
@@ -41,6 +43,8 @@
 	insert,								\
 	update,								\
 	remove,								\
+	search_batch,							\
+	insert_batch,							\
 	close,								\
 	{ NULL, NULL },			/* TAILQ_ENTRY q */		\
 	0,				/* recno key */			\
@@ -67,6 +71,14 @@ struct __wt_cursor_btree {
 
 	WT_BTREE *btree;		/* Enclosing btree */
 
+	/*
+	 * Cursors that can be cached when closed save the URI and configuration
+	 * string they were opened with: a later open with the same URI and
+	 * configuration reuses the cursor.
+	 */
+	char	*cache_uri;		/* Cached cursor URI */
+	char	*cache_cfg;		/* Cached cursor configuration */
+
 	/*
 	 * The following fields are set by the search functions as a precursor
 	 * to page modification: we have a page, a WT_COL/WT_ROW slot on the
@@ -197,6 +209,15 @@ struct __wt_cursor_config {
 	WT_CURSOR iface;
 };
 
+struct __wt_cursor_extractor {
+	WT_CURSOR iface;
+
+	WT_INDEX *index;		/* Index being maintained */
+	WT_CURSOR *child;		/* Index cursor */
+	const WT_ITEM *primary_key;	/* Packed primary key */
+	int (*f)(WT_CURSOR *);		/* Index cursor insert or remove */
+};
+
 struct __wt_cursor_dump {
 	WT_CURSOR iface;
 
@@ -212,6 +233,10 @@ struct __wt_cursor_index {
 
 	WT_CURSOR *child;
 	WT_CURSOR **cg_cursors;
+
+	WT_ITEM search_key;		/* Search key in the index's format */
+
+	int covered;			/* Values read from the index */
 };
 
 struct __wt_cursor_stat {
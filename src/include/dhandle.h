@@ -27,6 +27,12 @@
 
 #define	WT_WITH_BTREE(s, b, e)	WT_WITH_DHANDLE(s, (b)->dhandle, e)
 
+/*
+ * Data handles are hashed by name, checkpoint handles share their file's
+ * bucket.
+ */
+#define	WT_DHANDLE_BUCKET(hash)	((hash) & (WT_HASH_ARRAY_SIZE - 1))
+
 /*
  * WT_DATA_HANDLE --
  *	A handle for a generic named data source.
@@ -35,8 +41,10 @@ struct __wt_data_handle {
 	WT_RWLOCK *rwlock;		/* Lock for shared/exclusive ops */
 	uint32_t   refcnt;		/* Sessions using this handle */
 	TAILQ_ENTRY(__wt_data_handle) q;/* Linked list of handles */
+	TAILQ_ENTRY(__wt_data_handle) hashq;/* Hash bucket list */
 
 	const char *name;		/* Object name as a URI */
+	uint64_t name_hash;		/* Hash of the name */
 	const char *checkpoint;		/* Checkpoint name (or NULL) */
 	const char **cfg;		/* Configuration information */
 
@@ -44,6 +52,7 @@ struct __wt_data_handle {
 	void *handle;			/* Generic handle */
 
 	WT_DSRC_STATS stats;		/* Data-source statistics */
+	uint64_t *stats_shards;		/* Sharded statistics counters */
 
 	/* Flags values over 0xff are reserved for WT_BTREE_* */
 #define	WT_DHANDLE_DISCARD	        0x01	/* Discard on release */
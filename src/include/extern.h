@@ -69,10 +69,20 @@ extern int __wt_block_off_remove_overlap(WT_SESSION_IMPL *session,
     WT_EXTLIST *el,
     off_t off,
     off_t size);
+extern void __wt_block_preallocate( WT_SESSION_IMPL *session,
+    WT_BLOCK *block,
+    off_t offset,
+    off_t len);
+extern int __wt_block_preallocate_pending(WT_SESSION_IMPL *session,
+    WT_BLOCK *block);
 extern int __wt_block_alloc( WT_SESSION_IMPL *session,
     WT_BLOCK *block,
     off_t *offp,
     off_t size);
+extern int __wt_block_size_class_flush(WT_SESSION_IMPL *session,
+    WT_BLOCK *block);
+extern void __wt_block_size_class_discard(WT_SESSION_IMPL *session,
+    WT_BLOCK *block);
 extern int __wt_block_free(WT_SESSION_IMPL *session,
     WT_BLOCK *block,
     const uint8_t *addr,
@@ -116,6 +126,30 @@ extern int __wt_block_extlist_init(WT_SESSION_IMPL *session,
     const char *name,
     const char *extname);
 extern void __wt_block_extlist_free(WT_SESSION_IMPL *session, WT_EXTLIST *el);
+extern int __wt_block_io_create(WT_CONNECTION_IMPL *conn, const char *cfg[]);
+extern int __wt_block_io_destroy(WT_CONNECTION_IMPL *conn);
+extern int __wt_block_io_write(WT_SESSION_IMPL *session,
+    WT_BLOCK *block,
+    off_t offset,
+    uint32_t size,
+    const void *mem,
+    int *queuedp);
+extern int __wt_block_io_extend(WT_SESSION_IMPL *session,
+    WT_BLOCK *block,
+    off_t offset,
+    off_t len,
+    int *queuedp);
+extern int __wt_block_io_wait( WT_SESSION_IMPL *session,
+    WT_BLOCK *block,
+    off_t offset,
+    uint32_t size);
+extern int __wt_block_io_read(WT_SESSION_IMPL *session,
+    WT_BLOCK *block,
+    off_t offset,
+    uint32_t size,
+    void *mem,
+    int *foundp);
+extern void __wt_block_io_discard(WT_SESSION_IMPL *session, WT_BLOCK *block);
 extern int __wt_block_map( WT_SESSION_IMPL *session,
     WT_BLOCK *block,
     void *mapp,
@@ -143,6 +177,10 @@ extern int __wt_desc_init(WT_SESSION_IMPL *session, WT_FH *fh);
 extern void __wt_block_stat(WT_SESSION_IMPL *session,
     WT_BLOCK *block,
     WT_DSRC_STATS *stats);
+extern int __wt_bm_preload(WT_BM *bm,
+    WT_SESSION_IMPL *session,
+    const uint8_t *addr,
+    uint32_t addr_size);
 extern int __wt_bm_read(WT_BM *bm,
     WT_SESSION_IMPL *session,
     WT_ITEM *buf,
@@ -210,6 +248,7 @@ extern int __wt_bloom_open(WT_SESSION_IMPL *session,
     WT_BLOOM **bloomp);
 extern int __wt_bloom_insert(WT_BLOOM *bloom, WT_ITEM *key);
 extern int __wt_bloom_finalize(WT_BLOOM *bloom);
+extern int __wt_bloom_load(WT_BLOOM *bloom, uint8_t **bitsp);
 extern int __wt_bloom_hash(WT_BLOOM *bloom, WT_ITEM *key, WT_BLOOM_HASH *bhash);
 extern int __wt_bloom_hash_get(WT_BLOOM *bloom, WT_BLOOM_HASH *bhash);
 extern int __wt_bloom_get(WT_BLOOM *bloom, WT_ITEM *key);
@@ -232,6 +271,15 @@ extern int __wt_btcur_reset(WT_CURSOR_BTREE *cbt);
 extern int __wt_btcur_search(WT_CURSOR_BTREE *cbt);
 extern int __wt_btcur_search_near(WT_CURSOR_BTREE *cbt, int *exact);
 extern int __wt_btcur_insert(WT_CURSOR_BTREE *cbt);
+extern int __wt_btcur_search_batch(WT_CURSOR_BTREE *cbt,
+    WT_ITEM *keys,
+    WT_ITEM *values,
+    int *results,
+    size_t nitems);
+extern int __wt_btcur_insert_batch( WT_CURSOR_BTREE *cbt,
+    WT_ITEM *keys,
+    WT_ITEM *values,
+    size_t nitems);
 extern int __wt_btcur_remove(WT_CURSOR_BTREE *cbt);
 extern int __wt_btcur_update(WT_CURSOR_BTREE *cbt);
 extern int __wt_btcur_compare(WT_CURSOR_BTREE *a_arg,
@@ -343,6 +391,18 @@ extern int __wt_bt_cache_force_write(WT_SESSION_IMPL *session);
 extern int __wt_bt_cache_op(WT_SESSION_IMPL *session,
     WT_CKPT *ckptbase,
     int op);
+extern int __wt_sync_threads_create(WT_CONNECTION_IMPL *conn,
+    const char *cfg[]);
+extern int __wt_sync_threads_destroy(WT_CONNECTION_IMPL *conn);
+extern int __wt_sync_batch_alloc(WT_SESSION_IMPL *session,
+    WT_SYNC_BATCH **batchp);
+extern int __wt_sync_batch_add(WT_SESSION_IMPL *session,
+    WT_SYNC_BATCH *batch,
+    WT_PAGE *page,
+    int *addedp);
+extern int __wt_sync_batch_run(WT_SESSION_IMPL *session, WT_SYNC_BATCH *batch);
+extern int __wt_sync_batch_free(WT_SESSION_IMPL *session,
+    WT_SYNC_BATCH **batchp);
 extern int __wt_upgrade(WT_SESSION_IMPL *session, const char *cfg[]);
 extern int __wt_verify(WT_SESSION_IMPL *session, const char *cfg[]);
 extern int __wt_verify_dsk(WT_SESSION_IMPL *session,
@@ -451,6 +511,9 @@ extern int __wt_search_insert(WT_SESSION_IMPL *session,
 extern int __wt_row_search(WT_SESSION_IMPL *session,
     WT_CURSOR_BTREE *cbt,
     int is_modify);
+extern int __wt_row_search_page( WT_SESSION_IMPL *session,
+    WT_CURSOR_BTREE *cbt,
+    int is_modify);
 extern int __wt_row_random(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt);
 extern int __wt_config_initn( WT_SESSION_IMPL *session,
     WT_CONFIG *conf,
@@ -465,6 +528,8 @@ extern int __wt_config_subinit( WT_SESSION_IMPL *session,
 extern int __wt_config_next(WT_CONFIG *conf,
     WT_CONFIG_ITEM *key,
     WT_CONFIG_ITEM *value);
+extern const WT_CONFIG_COMPILED *__wt_config_compiled(WT_SESSION_IMPL *session,
+    const char *str);
 extern int __wt_config_get(WT_SESSION_IMPL *session,
     const char **cfg,
     WT_CONFIG_ITEM *key,
@@ -500,6 +565,10 @@ extern int __wt_configure_method(WT_SESSION_IMPL *session,
     const char *config,
     const char *type,
     const char *check);
+extern int __wt_config_compile(WT_SESSION_IMPL *session,
+    const char *method,
+    const char *config,
+    const char **compiledp);
 extern int __wt_config_check(WT_SESSION_IMPL *session,
     const WT_CONFIG_ENTRY *entry,
     const char *config,
@@ -562,6 +631,8 @@ extern int __wt_checkpoint_create(WT_CONNECTION_IMPL *conn, const char *cfg[]);
 extern int __wt_checkpoint_destroy(WT_CONNECTION_IMPL *conn);
 extern int __wt_connection_init(WT_CONNECTION_IMPL *conn);
 extern int __wt_connection_destroy(WT_CONNECTION_IMPL *conn);
+extern int __wt_log_server_create(WT_CONNECTION_IMPL *conn, const char *cfg[]);
+extern int __wt_log_server_destroy(WT_CONNECTION_IMPL *conn);
 extern int __wt_connection_open(WT_CONNECTION_IMPL *conn, const char *cfg[]);
 extern int __wt_connection_close(WT_CONNECTION_IMPL *conn);
 extern void __wt_conn_stat_init(WT_SESSION_IMPL *session, uint32_t flags);
@@ -587,6 +658,7 @@ extern int __wt_curdump_create(WT_CURSOR *child,
 extern int __wt_curfile_truncate( WT_SESSION_IMPL *session,
     WT_CURSOR *start,
     WT_CURSOR *stop);
+extern void __wt_curfile_cache_discard(WT_SESSION_IMPL *session);
 extern int __wt_curfile_create(WT_SESSION_IMPL *session,
     WT_CURSOR *owner,
     const char *cfg[],
@@ -623,6 +695,25 @@ extern int __wt_cursor_get_keyv(WT_CURSOR *cursor, uint32_t flags, va_list ap);
 extern void __wt_cursor_set_keyv(WT_CURSOR *cursor, uint32_t flags, va_list ap);
 extern int __wt_cursor_get_value(WT_CURSOR *cursor, ...);
 extern void __wt_cursor_set_value(WT_CURSOR *cursor, ...);
+extern int __wt_cursor_batch_append( WT_SESSION_IMPL *session,
+    WT_ITEM *buf,
+    WT_ITEM *value);
+extern int __wt_cursor_batch_return(WT_SESSION_IMPL *session,
+    WT_CURSOR *cursor,
+    WT_ITEM *buf,
+    WT_ITEM *values,
+    int *results,
+    size_t *order,
+    size_t nitems);
+extern int __wt_cursor_search_batch(WT_CURSOR *cursor,
+    WT_ITEM *keys,
+    WT_ITEM *values,
+    int *results,
+    size_t nitems);
+extern int __wt_cursor_insert_batch( WT_CURSOR *cursor,
+    WT_ITEM *keys,
+    WT_ITEM *values,
+    size_t nitems);
 extern int __wt_cursor_close(WT_CURSOR *cursor);
 extern int __wt_cursor_dup(WT_SESSION_IMPL *session,
     WT_CURSOR *to_dup,
@@ -644,7 +735,31 @@ extern int __wt_curtable_open(WT_SESSION_IMPL *session,
     const char *uri,
     const char *cfg[],
     WT_CURSOR **cursorp);
-extern int __wt_log_put(WT_SESSION_IMPL *session, WT_LOGREC_DESC *recdesc, ...);
+extern int __wt_log_open(WT_SESSION_IMPL *session);
+extern int __wt_log_close(WT_SESSION_IMPL *session);
+extern int __wt_log_flush(WT_SESSION_IMPL *session, uint32_t flags);
+extern int __wt_log_write(WT_SESSION_IMPL *session,
+    WT_ITEM *record,
+    off_t *lsnp,
+    uint32_t flags);
+extern int __wt_log_put(WT_SESSION_IMPL *session,
+    WT_LOGREC_DESC *recdesc,
+    off_t *lsnp,
+    uint32_t flags,
+    ...);
+extern void __wt_log_ckpt_lsn(WT_SESSION_IMPL *session, off_t *lsnp);
+extern int __wt_log_scan(WT_SESSION_IMPL *session,
+    off_t start,
+    int (*func)(WT_SESSION_IMPL *,
+    WT_ITEM *,
+    off_t,
+    void *),
+    void *cookie);
+extern int __wt_logop_read(WT_SESSION_IMPL *session,
+    const uint8_t **pp,
+    const uint8_t *end,
+    uint32_t *optypep,
+    uint32_t *opsizep);
 extern int __wt_log_vprintf(WT_SESSION_IMPL *session,
     const char *fmt,
     va_list ap);
@@ -653,6 +768,7 @@ extern int __wt_log_printf(WT_SESSION_IMPL *session,
     ...) WT_GCC_ATTRIBUTE((format (printf,
     2,
     3)));
+extern WT_LOGREC_DESC __wt_logdesc_commit;
 extern WT_LOGREC_DESC __wt_logdesc_debug;
 extern int __wt_clsm_init_merge( WT_CURSOR *cursor,
     u_int start_chunk,
@@ -666,7 +782,9 @@ extern int __wt_lsm_merge_update_tree(WT_SESSION_IMPL *session,
     WT_LSM_TREE *lsm_tree,
     u_int start_chunk,
     u_int nchunks,
-    WT_LSM_CHUNK *chunk);
+    WT_LSM_CHUNK **chunks,
+    u_int nnew);
+extern uint32_t __wt_lsm_merge_policy_config(WT_CONFIG_ITEM *cval);
 extern int __wt_lsm_merge( WT_SESSION_IMPL *session,
     WT_LSM_TREE *lsm_tree,
     u_int id,
@@ -717,9 +835,13 @@ extern int __wt_lsm_tree_worker(WT_SESSION_IMPL *session,
     const char *[]),
     const char *cfg[],
     uint32_t open_flags);
-extern void *__wt_lsm_merge_worker(void *vargs);
-extern void *__wt_lsm_bloom_worker(void *arg);
-extern void *__wt_lsm_checkpoint_worker(void *arg);
+extern int __wt_lsm_work_queue( WT_SESSION_IMPL *session,
+    WT_LSM_TREE *lsm_tree,
+    uint32_t type);
+extern void __wt_lsm_work_cancel(WT_SESSION_IMPL *session,
+    WT_LSM_TREE *lsm_tree);
+extern int __wt_lsm_worker_start(WT_SESSION_IMPL *session);
+extern int __wt_lsm_worker_destroy(WT_CONNECTION_IMPL *conn);
 extern int __wt_metadata_get(WT_SESSION *session,
     const char *uri,
     const char **valuep);
@@ -743,9 +865,10 @@ extern int __wt_meta_checkpoint_clear(WT_SESSION_IMPL *session,
 extern int __wt_meta_ckptlist_get( WT_SESSION_IMPL *session,
     const char *fname,
     WT_CKPT **ckptbasep);
-extern int __wt_meta_ckptlist_set( WT_SESSION_IMPL *session,
+extern int __wt_meta_ckptlist_set(WT_SESSION_IMPL *session,
     const char *fname,
-    WT_CKPT *ckptbase);
+    WT_CKPT *ckptbase,
+    off_t ckpt_lsn);
 extern void __wt_meta_ckptlist_free(WT_SESSION_IMPL *session,
     WT_CKPT *ckptbase);
 extern void __wt_meta_checkpoint_free(WT_SESSION_IMPL *session, WT_CKPT *ckpt);
@@ -815,6 +938,10 @@ extern int __wt_errno(void);
 extern int __wt_exist(WT_SESSION_IMPL *session,
     const char *filename,
     int *existp);
+extern int __wt_fallocate(WT_SESSION_IMPL *session,
+    WT_FH *fh,
+    off_t offset,
+    off_t len);
 extern int __wt_filesize(WT_SESSION_IMPL *session, WT_FH *fh, off_t *sizep);
 extern int __wt_bytelock(WT_FH *fhp, off_t byte, int lock);
 extern int __wt_fsync(WT_SESSION_IMPL *session, WT_FH *fh);
@@ -914,6 +1041,11 @@ extern int __wt_struct_unpack(WT_SESSION_IMPL *session,
     size_t size,
     const char *fmt,
     ...);
+extern int __wt_struct_repack(WT_SESSION_IMPL *session,
+    const char *infmt,
+    const char *outfmt,
+    const WT_ITEM *inbuf,
+    WT_ITEM *outbuf);
 extern int __wt_schema_colgroup_source(WT_SESSION_IMPL *session,
     WT_TABLE *table,
     const char *cgname,
@@ -952,6 +1084,9 @@ extern int __wt_schema_colgroup_name(WT_SESSION_IMPL *session,
     WT_ITEM *buf);
 extern int __wt_schema_open_colgroups(WT_SESSION_IMPL *session,
     WT_TABLE *table);
+extern int __wt_schema_get_extractor(WT_SESSION_IMPL *session,
+    WT_CONFIG_ITEM *cval,
+    WT_EXTRACTOR **extractorp);
 extern int __wt_schema_open_index(WT_SESSION_IMPL *session,
     WT_TABLE *table,
     const char *idxname,
@@ -983,6 +1118,11 @@ extern int __wt_struct_plan(WT_SESSION_IMPL *session,
     size_t len,
     int value_only,
     WT_ITEM *plan);
+extern int __wt_struct_plan_index(WT_SESSION_IMPL *session,
+    WT_INDEX *idx,
+    const char *columns,
+    size_t len,
+    WT_ITEM *plan);
 extern int __wt_struct_reformat(WT_SESSION_IMPL *session,
     WT_TABLE *table,
     const char *columns,
@@ -1068,6 +1208,7 @@ extern int __wt_session_discard_btree( WT_SESSION_IMPL *session,
     WT_DATA_HANDLE_CACHE *dhandle_cache);
 extern int __wt_salvage(WT_SESSION_IMPL *session, const char *cfg[]);
 extern uint32_t __wt_cksum(const void *chunk, size_t len);
+extern void __wt_cksum_init(void);
 extern void __wt_event_handler_set(WT_SESSION_IMPL *session,
     WT_EVENT_HANDLER *handler);
 extern void __wt_err(WT_SESSION_IMPL *session,
@@ -1226,6 +1367,26 @@ extern void __wt_stat_init_dsrc_stats(WT_DSRC_STATS *stats);
 extern void __wt_stat_clear_dsrc_stats(void *stats_arg);
 extern void __wt_stat_init_connection_stats(WT_CONNECTION_STATS *stats);
 extern void __wt_stat_clear_connection_stats(void *stats_arg);
+extern u_int __wt_stat_shard_count(void);
+extern int __wt_stat_shard_init(WT_SESSION_IMPL *session,
+    uint64_t **shardsp,
+    u_int nshards,
+    size_t stride);
+extern void __wt_stat_shard_discard(WT_SESSION_IMPL *session,
+    uint64_t **shardsp);
+extern void __wt_stat_shard_sum(WT_STATS *stats,
+    const uint64_t *shards,
+    u_int nshards,
+    size_t count,
+    size_t stride);
+extern void __wt_stat_shard_fold(WT_STATS *stats,
+    uint64_t *shards,
+    u_int nshards,
+    size_t count,
+    size_t stride);
+extern void __wt_stat_latency( WT_SESSION_IMPL *session,
+    size_t key,
+    const struct timespec *start);
 extern int __wt_txnid_cmp(const void *v1, const void *v2);
 extern void __wt_txn_release_snapshot(WT_SESSION_IMPL *session);
 extern void __wt_txn_get_oldest(WT_SESSION_IMPL *session);
@@ -1234,6 +1395,7 @@ extern void __wt_txn_get_snapshot( WT_SESSION_IMPL *session,
     wt_txnid_t max_id,
     int force);
 extern void __wt_txn_get_evict_snapshot(WT_SESSION_IMPL *session);
+extern WT_TXN_SYNC __wt_txn_sync_config(WT_CONFIG_ITEM *cval);
 extern int __wt_txn_begin(WT_SESSION_IMPL *session, const char *cfg[]);
 extern void __wt_txn_release(WT_SESSION_IMPL *session);
 extern int __wt_txn_commit(WT_SESSION_IMPL *session, const char *cfg[]);
@@ -1245,3 +1407,13 @@ extern void __wt_txn_global_destroy(WT_CONNECTION_IMPL *conn);
 extern int __wt_txn_checkpoint(WT_SESSION_IMPL *session, const char *cfg[]);
 extern int __wt_checkpoint(WT_SESSION_IMPL *session, const char *cfg[]);
 extern int __wt_checkpoint_close(WT_SESSION_IMPL *session, const char *cfg[]);
+extern int __wt_txn_log_op(WT_SESSION_IMPL *session,
+    WT_BTREE *btree,
+    WT_ITEM *key,
+    uint64_t recno,
+    WT_ITEM *value);
+extern int __wt_txn_log_sync( WT_SESSION_IMPL *session,
+    const char *cfg[],
+    WT_TXN_SYNC *syncp);
+extern int __wt_txn_log_commit(WT_SESSION_IMPL *session, WT_TXN_SYNC sync);
+extern int __wt_txn_recover(WT_SESSION_IMPL *session);
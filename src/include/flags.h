@@ -3,8 +3,9 @@
  * flags section: BEGIN
  */
 #define	WT_CACHE_POOL_RUN				0x00000001
-#define	WT_CONN_CACHE_POOL				0x00000040
-#define	WT_CONN_EVICTION_RUN				0x00000020
+#define	WT_CONN_CACHE_POOL				0x00000080
+#define	WT_CONN_EVICTION_RUN				0x00000040
+#define	WT_CONN_LOGGING					0x00000020
 #define	WT_CONN_LSM_MERGE				0x00000010
 #define	WT_CONN_PANIC					0x00000008
 #define	WT_CONN_SERVER_RUN				0x00000004
@@ -13,6 +14,8 @@
 #define	WT_DIRECTIO_DATA				0x00000002
 #define	WT_DIRECTIO_LOG					0x00000001
 #define	WT_EVICTION_SERVER_LOCKED			0x00000004
+#define	WT_LOG_FLUSH					0x00000002
+#define	WT_LOG_FSYNC					0x00000001
 #define	WT_SESSION_INTERNAL				0x00000010
 #define	WT_SESSION_NO_CACHE				0x00000008
 #define	WT_SESSION_NO_CACHE_CHECK			0x00000004
@@ -33,16 +36,17 @@
 #define	WT_TREE_SKIP_INTL				0x00000004
 #define	WT_TREE_SKIP_LEAF				0x00000002
 #define	WT_TREE_WAIT					0x00000001
-#define	WT_VERB_block					0x00002000
-#define	WT_VERB_ckpt					0x00001000
-#define	WT_VERB_evict					0x00000800
-#define	WT_VERB_evictserver				0x00000400
-#define	WT_VERB_fileops					0x00000200
-#define	WT_VERB_hazard					0x00000100
-#define	WT_VERB_lsm					0x00000080
-#define	WT_VERB_mutex					0x00000040
-#define	WT_VERB_read					0x00000020
-#define	WT_VERB_reconcile				0x00000010
+#define	WT_VERB_block					0x00004000
+#define	WT_VERB_ckpt					0x00002000
+#define	WT_VERB_evict					0x00001000
+#define	WT_VERB_evictserver				0x00000800
+#define	WT_VERB_fileops					0x00000400
+#define	WT_VERB_hazard					0x00000200
+#define	WT_VERB_lsm					0x00000100
+#define	WT_VERB_mutex					0x00000080
+#define	WT_VERB_read					0x00000040
+#define	WT_VERB_reconcile				0x00000020
+#define	WT_VERB_recovery				0x00000010
 #define	WT_VERB_salvage					0x00000008
 #define	WT_VERB_shared_cache				0x00000004
 #define	WT_VERB_verify					0x00000002
@@ -7,6 +7,55 @@
 
 #define	WT_LOG_FILENAME	"WiredTiger.log"		/* Log file name */
 
+/*
+ * Log sequence numbers (LSNs) are byte offsets of log records in the log file.
+ */
+#define	WT_LOG_INVALID_LSN	((off_t)-1)
+
+#define	WT_LOG_SCAN_CHUNK	(1024 * 1024)	/* Log scan read size */
+
+/*
+ * Records buffered without waiting are written by the log server within
+ * WT_LOG_SERVER_USECS, or as soon as WT_LOG_BUF_MAX bytes are buffered.
+ */
+#define	WT_LOG_BUF_MAX		(1024 * 1024)
+#define	WT_LOG_SERVER_USECS	100000
+
+/*
+ * WT_LOG_RECORD --
+ *	A log record header.  Records are appended to the log file back-to-back,
+ * each header is followed by the packed fields of the record.
+ */
+struct __wt_log_record {
+	uint32_t len;			/* 00-03: Record length, with header */
+	uint32_t cksum;			/* 04-07: Record checksum */
+	uint32_t rectype;		/* 08-11: Record type */
+	uint32_t unused;		/* 12-15: Padding */
+};
+/*
+ * WT_LOG_RECORD_SIZE is the expected structure size -- we verify the build to
+ * ensure the compiler hasn't inserted padding, the header is written directly
+ * into the log file.
+ */
+#define	WT_LOG_RECORD_SIZE		16
+
+/*
+ * DO NOT EDIT: automatically built by dist/log.py.
+ */
+/* Log record types: BEGIN */
+
+#define	WT_LOGREC_INVALID	0
+#define	WT_LOGREC_COMMIT	1
+#define	WT_LOGREC_DEBUG	2
+
+#define	WT_LOGOP_INVALID	0
+#define	WT_LOGOP_COL_PUT	1
+#define	WT_LOGOP_COL_REMOVE	2
+#define	WT_LOGOP_ROW_PUT	3
+#define	WT_LOGOP_ROW_REMOVE	4
+
+/* Log record types: END */
+
 /* Logging subsystem declarations. */
 typedef enum {
 	WT_LOGREC_INT16,
@@ -19,6 +68,35 @@ typedef enum {
 } WT_LOGREC_FIELDTYPE;
 
 typedef struct {
+	uint32_t rectype;
 	const char *fmt;
 	const char *fields[];
 } WT_LOGREC_DESC;
+
+/*
+ * WT_LOG --
+ *	The connection's log.
+ *
+ * Committing threads copy their records into the active buffer and then wait
+ * for the log to be written (and optionally synced) past the end of their
+ * record.  The first waiting thread to find no write in progress becomes the
+ * group leader: it swaps the buffers, writes and syncs everything buffered so
+ * far in a single call, and wakes the rest of the group.  Records buffered
+ * while the leader is writing are written by the next leader.
+ */
+struct __wt_log {
+	WT_FH	   *fh;			/* Log file handle */
+
+	WT_SPINLOCK lock;		/* Locked: buffers, LSNs */
+
+	off_t	alloc_lsn;		/* Next LSN to allocate */
+	off_t	write_lsn;		/* End of the last write */
+	off_t	sync_lsn;		/* End of the last sync */
+
+	WT_ITEM	buf[2];			/* Filled while the other is written */
+	u_int	buf_active;		/* Buffer being filled */
+	int	buf_sync;		/* Active buffer requires a sync */
+
+	int	writing;		/* Group leader is writing */
+	u_int	waiters;		/* Threads waiting for a write */
+};
@@ -1,7 +1,211 @@
 /* DO NOT EDIT: automatically built by dist/log.py. */
 
 static inline int
-__wt_logput_debug(WT_SESSION_IMPL *session, const char * message)
+__wt_logput_commit(WT_SESSION_IMPL *session,
+    off_t *lsnp, uint32_t flags, uint32_t txnid, WT_ITEM *ops)
 {
-	return (__wt_log_put(session, &__wt_logdesc_debug, message));
+	return (__wt_log_put(session,
+	    &__wt_logdesc_commit, lsnp, flags, txnid, ops));
+}
+
+static inline int
+__wt_logput_debug(WT_SESSION_IMPL *session,
+    off_t *lsnp, uint32_t flags, const char *message)
+{
+	return (__wt_log_put(session,
+	    &__wt_logdesc_debug, lsnp, flags, message));
+}
+
+static inline int
+__wt_logop_col_put_pack(WT_SESSION_IMPL *session, WT_ITEM *logrec,
+    const char *uri, uint64_t recno, WT_ITEM *value)
+{
+	const char *fmt = "IISru";
+	size_t size;
+	uint32_t optype, recsize;
+
+	/*
+	 * The record size doesn't include the operation type or the size: a
+	 * size that included its own variable-length encoding might have no
+	 * consistent value.
+	 */
+	optype = WT_LOGOP_COL_PUT;
+	WT_RET(__wt_struct_size(session, &size, "Sru", uri, recno, value));
+	recsize = (uint32_t)size;
+	size += __wt_vsize_uint(optype) + __wt_vsize_uint(recsize);
+
+	WT_RET(__wt_buf_grow(session, logrec, logrec->size + size));
+	WT_RET(__wt_struct_pack(session,
+	    (uint8_t *)logrec->mem + logrec->size, size, fmt,
+	    optype, recsize, uri, recno, value));
+
+	logrec->size += (uint32_t)size;
+	return (0);
+}
+
+static inline int
+__wt_logop_col_remove_pack(WT_SESSION_IMPL *session, WT_ITEM *logrec,
+    const char *uri, uint64_t recno)
+{
+	const char *fmt = "IISr";
+	size_t size;
+	uint32_t optype, recsize;
+
+	/*
+	 * The record size doesn't include the operation type or the size: a
+	 * size that included its own variable-length encoding might have no
+	 * consistent value.
+	 */
+	optype = WT_LOGOP_COL_REMOVE;
+	WT_RET(__wt_struct_size(session, &size, "Sr", uri, recno));
+	recsize = (uint32_t)size;
+	size += __wt_vsize_uint(optype) + __wt_vsize_uint(recsize);
+
+	WT_RET(__wt_buf_grow(session, logrec, logrec->size + size));
+	WT_RET(__wt_struct_pack(session,
+	    (uint8_t *)logrec->mem + logrec->size, size, fmt,
+	    optype, recsize, uri, recno));
+
+	logrec->size += (uint32_t)size;
+	return (0);
+}
+
+static inline int
+__wt_logop_row_put_pack(WT_SESSION_IMPL *session, WT_ITEM *logrec,
+    const char *uri, WT_ITEM *key, WT_ITEM *value)
+{
+	const char *fmt = "IISuu";
+	size_t size;
+	uint32_t optype, recsize;
+
+	/*
+	 * The record size doesn't include the operation type or the size: a
+	 * size that included its own variable-length encoding might have no
+	 * consistent value.
+	 */
+	optype = WT_LOGOP_ROW_PUT;
+	WT_RET(__wt_struct_size(session, &size, "Suu", uri, key, value));
+	recsize = (uint32_t)size;
+	size += __wt_vsize_uint(optype) + __wt_vsize_uint(recsize);
+
+	WT_RET(__wt_buf_grow(session, logrec, logrec->size + size));
+	WT_RET(__wt_struct_pack(session,
+	    (uint8_t *)logrec->mem + logrec->size, size, fmt,
+	    optype, recsize, uri, key, value));
+
+	logrec->size += (uint32_t)size;
+	return (0);
+}
+
+static inline int
+__wt_logop_row_remove_pack(WT_SESSION_IMPL *session, WT_ITEM *logrec,
+    const char *uri, WT_ITEM *key)
+{
+	const char *fmt = "IISu";
+	size_t size;
+	uint32_t optype, recsize;
+
+	/*
+	 * The record size doesn't include the operation type or the size: a
+	 * size that included its own variable-length encoding might have no
+	 * consistent value.
+	 */
+	optype = WT_LOGOP_ROW_REMOVE;
+	WT_RET(__wt_struct_size(session, &size, "Su", uri, key));
+	recsize = (uint32_t)size;
+	size += __wt_vsize_uint(optype) + __wt_vsize_uint(recsize);
+
+	WT_RET(__wt_buf_grow(session, logrec, logrec->size + size));
+	WT_RET(__wt_struct_pack(session,
+	    (uint8_t *)logrec->mem + logrec->size, size, fmt,
+	    optype, recsize, uri, key));
+
+	logrec->size += (uint32_t)size;
+	return (0);
+}
+
+static inline int
+__wt_logrec_commit_unpack(WT_SESSION_IMPL *session,
+    WT_ITEM *record, uint32_t *txnidp, WT_ITEM *opsp)
+{
+	return (__wt_struct_unpack(session,
+	    (uint8_t *)record->data + WT_LOG_RECORD_SIZE,
+	    record->size - WT_LOG_RECORD_SIZE,
+	    "Iu", txnidp, opsp));
+}
+
+static inline int
+__wt_logrec_debug_unpack(WT_SESSION_IMPL *session,
+    WT_ITEM *record, const char **messagep)
+{
+	return (__wt_struct_unpack(session,
+	    (uint8_t *)record->data + WT_LOG_RECORD_SIZE,
+	    record->size - WT_LOG_RECORD_SIZE,
+	    "S", messagep));
+}
+
+static inline int
+__wt_logop_col_put_unpack(WT_SESSION_IMPL *session,
+    const uint8_t **pp, const uint8_t *end, const char **urip, uint64_t *recnop,
+    WT_ITEM *valuep)
+{
+	const char *fmt = "IISru";
+	uint32_t optype, recsize, size;
+
+	WT_RET(__wt_logop_read(session, pp, end, &optype, &size));
+	WT_ASSERT(session, optype == WT_LOGOP_COL_PUT);
+	WT_RET(__wt_struct_unpack(session, *pp, size, fmt,
+	    &optype, &recsize, urip, recnop, valuep));
+
+	*pp += size;
+	return (0);
+}
+
+static inline int
+__wt_logop_col_remove_unpack(WT_SESSION_IMPL *session,
+    const uint8_t **pp, const uint8_t *end, const char **urip, uint64_t *recnop)
+{
+	const char *fmt = "IISr";
+	uint32_t optype, recsize, size;
+
+	WT_RET(__wt_logop_read(session, pp, end, &optype, &size));
+	WT_ASSERT(session, optype == WT_LOGOP_COL_REMOVE);
+	WT_RET(__wt_struct_unpack(session, *pp, size, fmt,
+	    &optype, &recsize, urip, recnop));
+
+	*pp += size;
+	return (0);
+}
+
+static inline int
+__wt_logop_row_put_unpack(WT_SESSION_IMPL *session,
+    const uint8_t **pp, const uint8_t *end, const char **urip, WT_ITEM *keyp,
+    WT_ITEM *valuep)
+{
+	const char *fmt = "IISuu";
+	uint32_t optype, recsize, size;
+
+	WT_RET(__wt_logop_read(session, pp, end, &optype, &size));
+	WT_ASSERT(session, optype == WT_LOGOP_ROW_PUT);
+	WT_RET(__wt_struct_unpack(session, *pp, size, fmt,
+	    &optype, &recsize, urip, keyp, valuep));
+
+	*pp += size;
+	return (0);
+}
+
+static inline int
+__wt_logop_row_remove_unpack(WT_SESSION_IMPL *session,
+    const uint8_t **pp, const uint8_t *end, const char **urip, WT_ITEM *keyp)
+{
+	const char *fmt = "IISu";
+	uint32_t optype, recsize, size;
+
+	WT_RET(__wt_logop_read(session, pp, end, &optype, &size));
+	WT_ASSERT(session, optype == WT_LOGOP_ROW_REMOVE);
+	WT_RET(__wt_struct_unpack(session, *pp, size, fmt,
+	    &optype, &recsize, urip, keyp));
+
+	*pp += size;
+	return (0);
 }
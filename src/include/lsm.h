@@ -32,6 +32,16 @@ struct __wt_cursor_lsm {
 	uint32_t flags;
 };
 
+/*
+ * WT_LSM_CMP --
+ *	Compare two keys of an LSM tree.
+ */
+#define	WT_LSM_CMP(s, lsm_tree, k1, k2, cmp)				\
+	(((lsm_tree)->collator == NULL) ?				\
+	(((cmp) = __wt_btree_lex_compare((k1), (k2))), 0) :		\
+	(lsm_tree)->collator->compare((lsm_tree)->collator,		\
+	    &(s)->iface, (k1), (k2), &(cmp)))
+
 /*
  * WT_LSM_CHUNK --
  *	A single chunk (file) in an LSM tree.
@@ -41,6 +51,7 @@ struct __wt_lsm_chunk {
 	uint32_t generation;		/* Merge generation */
 	const char *uri;		/* Data source for this chunk */
 	const char *bloom_uri;		/* URI of Bloom filter, if any */
+	uint8_t *bloom_bits;		/* Bloom filter loaded in memory */
 	uint64_t count;			/* Approximate count of records */
 	struct timespec create_ts;	/* Creation time (for rate limiting) */
 
@@ -49,10 +60,44 @@ struct __wt_lsm_chunk {
 #define	WT_LSM_CHUNK_EVICTED	0x02
 #define	WT_LSM_CHUNK_MERGING	0x04
 #define	WT_LSM_CHUNK_ONDISK	0x08
-#define	WT_LSM_CHUNK_STABLE	0x10
+#define	WT_LSM_CHUNK_PARTITION	0x10	/* Follows a sibling partition */
+#define	WT_LSM_CHUNK_STABLE	0x20
 	uint32_t flags;
 };
 
+/*
+ * WT_LSM_WORK_UNIT --
+ *	A type of background work on an LSM tree, queued for the connection's
+ * LSM worker threads.  Each tree has one unit of each type, which is either
+ * queued or not: queueing work already queued only makes it runnable sooner.
+ * Work types double as priorities, lower types are run first.
+ */
+struct __wt_lsm_work_unit {
+	WT_LSM_TREE *lsm_tree;		/* Tree to work on */
+	TAILQ_ENTRY(__wt_lsm_work_unit) q;
+
+#define	WT_LSM_WORK_SWITCH	0	/* Switch the in-memory chunk */
+#define	WT_LSM_WORK_FLUSH	1	/* Checkpoint completed chunks */
+#define	WT_LSM_WORK_BLOOM	2	/* Create Bloom filters */
+#define	WT_LSM_WORK_DROP	3	/* Drop chunks that have been merged */
+#define	WT_LSM_WORK_MERGE	4	/* Merge chunks */
+#define	WT_LSM_WORK_MAX		5
+	uint32_t type;
+
+	struct timespec ready;		/* Not runnable before this time */
+	long backoff;			/* Locked: error retry delay */
+	int queued;			/* Locked: on the work queue */
+};
+
+/*
+ * Busy work is retried after WT_LSM_WORK_RETRY_USECS, merges that find nothing
+ * to do look again after WT_LSM_MERGE_RETRY_USECS.  Work that fails is retried
+ * after a delay that doubles with each failure, up to WT_LSM_ERROR_RETRY_MAX.
+ */
+#define	WT_LSM_WORK_RETRY_USECS		10000
+#define	WT_LSM_MERGE_RETRY_USECS	1000000
+#define	WT_LSM_ERROR_RETRY_MAX		(60 * WT_MILLION)
+
 /*
  * WT_LSM_TREE --
  *	An LSM tree.
@@ -66,7 +111,6 @@ struct __wt_lsm_tree {
 
 	int refcnt;			/* Number of users of the tree */
 	WT_RWLOCK *rwlock;
-	WT_CONDVAR *ckpt_cond;		/* Used to notify worker of a switch */
 	TAILQ_ENTRY(__wt_lsm_tree) q;
 
 	WT_DSRC_STATS stats;		/* LSM statistics */
@@ -81,6 +125,13 @@ struct __wt_lsm_tree {
 	uint32_t chunk_size;
 	u_int merge_max;
 	u_int merge_threads;
+	u_int merge_ratio;
+
+#define	WT_LSM_MERGE_DEFAULT	0
+#define	WT_LSM_MERGE_LEVELED	1
+#define	WT_LSM_MERGE_TIERED	2
+	uint32_t merge_policy;		/* Merge chunk selection */
+	u_int merge_partitions;		/* Key ranges built in parallel */
 
 #define	WT_LSM_BLOOM_MERGED				0x00000001
 #define	WT_LSM_BLOOM_NEWEST				0x00000002
@@ -88,16 +139,12 @@ struct __wt_lsm_tree {
 #define	WT_LSM_BLOOM_OLDEST				0x00000008
 	uint32_t bloom;			/* Bloom creation policy */
 
-#define	WT_LSM_MAX_WORKERS	10
-					/* Passed to thread_create */
-	WT_SESSION_IMPL *worker_sessions[WT_LSM_MAX_WORKERS];
-					/* LSM worker thread(s) */
-	pthread_t worker_tids[WT_LSM_MAX_WORKERS];
-	WT_SESSION_IMPL *ckpt_session;	/* For checkpoint worker */
-	pthread_t ckpt_tid;		/* LSM checkpoint worker thread */
-
-	WT_SESSION_IMPL *bloom_session;	/* For bloom worker */
-	pthread_t bloom_tid;		/* LSM bloom worker thread */
+#define	WT_LSM_MAX_WORKERS	10	/* Maximum concurrent merges */
+					/* Background work, one of each type */
+	WT_LSM_WORK_UNIT work[WT_LSM_WORK_MAX];
+	uint32_t work_running;		/* Locked: types being worked on */
+	u_int merge_active;		/* Locked: merges running */
+	struct timespec merge_ts;	/* Time of the last merge */
 
 	WT_LSM_CHUNK **chunk;		/* Array of active LSM chunks */
 	size_t chunk_alloc;		/* Space allocated for chunks */
@@ -117,6 +164,38 @@ struct __wt_lsm_tree {
 	uint32_t flags;
 };
 
+/*
+ * WT_LSM_MERGE_PART --
+ *	A key range of a merge, built into a chunk of its own.  Large merges are
+ * split into several partitions, built by helper threads in parallel.  The
+ * range is exclusive of the lower key and inclusive of the upper key, either
+ * may be NULL if the range is unbounded.
+ */
+struct __wt_lsm_merge_part {
+	WT_LSM_TREE *lsm_tree;
+	WT_SESSION_IMPL *session;	/* Helper thread session, if any */
+	pthread_t tid;			/* Helper thread */
+
+	u_int start_chunk, nchunks;	/* Chunks being merged */
+	uint32_t start_id;		/* ID of the first chunk merged */
+	uint64_t record_count;		/* Expected records, for Bloom */
+	int create_bloom;		/* Create a Bloom filter */
+
+	WT_ITEM *lower, *upper;		/* Key range */
+
+	WT_LSM_CHUNK *chunk;		/* New chunk */
+	uint64_t insert_count;		/* Records inserted */
+	int ret;			/* Helper thread return */
+};
+
+/*
+ * Merges are only split into partitions of at least WT_LSM_PARTITION_MIN
+ * records, and the split keys are chosen from WT_LSM_PARTITION_SAMPLES random
+ * keys per partition.
+ */
+#define	WT_LSM_PARTITION_MIN		10000
+#define	WT_LSM_PARTITION_SAMPLES	100
+
 /*
  * WT_LSM_DATA_SOURCE --
  *	Implementation of the WT_DATA_SOURCE interface for LSM.
@@ -129,7 +208,7 @@ struct __wt_lsm_data_source {
 
 /*
  * WT_LSM_WORKER_COOKIE --
- *	State for an LSM worker thread.
+ *	A copy of an LSM tree's chunk array, used by LSM worker threads.
  */
 struct __wt_lsm_worker_cookie {
 	WT_LSM_CHUNK **chunk_array;
@@ -138,10 +217,13 @@ struct __wt_lsm_worker_cookie {
 };
 
 /*
- * WT_LSM_WORKER_ARGS --
- *	State for an LSM worker thread.
+ * WT_LSM_WORKER --
+ *	Encapsulation of an LSM worker thread, shared by all of the LSM trees
+ * in the connection.
  */
-struct __wt_lsm_worker_args {
-	WT_LSM_TREE *lsm_tree;
-	u_int id;
+struct __wt_lsm_worker {
+	WT_SESSION_IMPL *session;
+	pthread_t tid;
+
+	WT_LSM_WORKER_COOKIE cookie;	/* Chunk array copy */
 };
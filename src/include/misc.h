@@ -50,6 +50,9 @@
 #define	WT_SKIP_MAXDEPTH	10
 #define	WT_SKIP_PROBABILITY	(UINT32_MAX >> 2)
 
+/* Buckets in the data handle hash tables, must be a power-of-two. */
+#define	WT_HASH_ARRAY_SIZE	512
+
 /* The number of hazard pointers that can be in use is grown dynamically. */
 #define	WT_HAZARD_INCR		10
 
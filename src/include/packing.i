@@ -464,6 +464,8 @@ __wt_struct_packv(WT_SESSION_IMPL *session,
 
 	if (fmt[0] != '\0' && fmt[1] == '\0') {
 		pv.type = fmt[0];
+		pv.havesize = 0;
+		pv.size = 1;
 		WT_PACK_GET(session, pv, ap);
 		return (__pack_write(session, &pv, &p, size));
 	}
@@ -497,6 +499,8 @@ __wt_struct_sizev(
 
 	if (fmt[0] != '\0' && fmt[1] == '\0') {
 		pv.type = fmt[0];
+		pv.havesize = 0;
+		pv.size = 1;
 		WT_PACK_GET(session, pv, ap);
 		*sizep = __pack_size(session, &pv);
 		return (0);
@@ -529,9 +533,11 @@ __wt_struct_unpackv(WT_SESSION_IMPL *session,
 
 	if (fmt[0] != '\0' && fmt[1] == '\0') {
 		pv.type = fmt[0];
+		pv.havesize = 0;
+		pv.size = 1;
 		if ((ret = __unpack_read(session, &pv, &p, size)) == 0)
 			WT_UNPACK_PUT(session, pv, ap);
-		return (0);
+		return (ret);
 	}
 
 	WT_RET(__pack_init(session, &pack, fmt));
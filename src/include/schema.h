@@ -32,6 +32,17 @@ struct __wt_index {
 	const char *key_plan;		/* Key projection plan */
 	const char *value_plan;		/* Value projection plan */
 
+	WT_CONFIG_ITEM valcolconf;	/* List of stored value columns */
+	const char *value_format;	/* Stored value format */
+	const char *store_plan;		/* Stored value projection plan */
+
+	const char *cover_columns;	/* Columns stored in the index */
+	u_int ncover_key_columns;	/* Stored columns in the key */
+	const char *cover_plan;		/* Covered value projection plan */
+
+	WT_EXTRACTOR *extractor;	/* Custom key extractor */
+	int extract_repack;		/* Extracted keys end with an item */
+
 	int need_value;			/* Index must have a non-empty value */
 };
 
@@ -62,7 +62,7 @@ __wt_col_append_serial(
 
 	args->skipdepth = skipdepth;
 
-	__wt_spin_lock(session, &S2C(session)->serial_lock);
+	WT_PAGE_LOCK(session, page);
 	ret = __wt_col_append_serial_func(session, args);
 
 	/* Increment in-memory footprint before decrement is possible. */
@@ -82,7 +82,7 @@ __wt_col_append_serial(
 	if (incr_mem != 0)
 		__wt_cache_page_inmem_incr(session, page, incr_mem);
 
-	__wt_spin_unlock(session, &S2C(session)->serial_lock);
+	WT_PAGE_UNLOCK(session, page);
 
 	/* Free any unused memory after releasing serialization mutex. */
 	if (!args->new_inslist_taken)
@@ -201,7 +201,7 @@ __wt_insert_serial(
 
 	args->skipdepth = skipdepth;
 
-	__wt_spin_lock(session, &S2C(session)->serial_lock);
+	WT_PAGE_LOCK(session, page);
 	ret = __wt_insert_serial_func(session, args);
 
 	/* Increment in-memory footprint before decrement is possible. */
@@ -221,7 +221,7 @@ __wt_insert_serial(
 	if (incr_mem != 0)
 		__wt_cache_page_inmem_incr(session, page, incr_mem);
 
-	__wt_spin_unlock(session, &S2C(session)->serial_lock);
+	WT_PAGE_UNLOCK(session, page);
 
 	/* Free any unused memory after releasing serialization mutex. */
 	if (!args->new_inslist_taken)
@@ -326,7 +326,7 @@ __wt_update_serial(
 
 	args->upd_obsolete = upd_obsolete;
 
-	__wt_spin_lock(session, &S2C(session)->serial_lock);
+	WT_PAGE_LOCK(session, page);
 	ret = __wt_update_serial_func(session, args);
 
 	/* Increment in-memory footprint before decrement is possible. */
@@ -342,7 +342,7 @@ __wt_update_serial(
 	if (incr_mem != 0)
 		__wt_cache_page_inmem_incr(session, page, incr_mem);
 
-	__wt_spin_unlock(session, &S2C(session)->serial_lock);
+	WT_PAGE_UNLOCK(session, page);
 
 	/* Free any unused memory after releasing serialization mutex. */
 	if (!args->new_upd_taken)
@@ -14,6 +14,7 @@ struct __wt_data_handle_cache {
 	WT_DATA_HANDLE *dhandle;
 
 	TAILQ_ENTRY(__wt_data_handle_cache) q;
+	TAILQ_ENTRY(__wt_data_handle_cache) hashq;
 };
 
 /*
@@ -58,10 +59,16 @@ struct __wt_session_impl {
 
 	WT_DATA_HANDLE *dhandle;	/* Current data handle */
 	TAILQ_HEAD(__dhandles, __wt_data_handle_cache) dhandles;
+					/* Hashed handle reference list */
+	TAILQ_HEAD(__dhandles_hash, __wt_data_handle_cache)
+	    dhhash[WT_HASH_ARRAY_SIZE];
 
 	WT_CURSOR *cursor;		/* Current cursor */
 					/* Cursors closed with the session */
 	TAILQ_HEAD(__cursors, __wt_cursor) cursors;
+					/* Closed cursors kept for reuse */
+	TAILQ_HEAD(__cursor_cache, __wt_cursor) cursor_cache;
+	u_int	ncursor_cache;		/* Count of cached cursors */
 
 	WT_BTREE *metafile;		/* Metadata file */
 	void	*meta_track;		/* Metadata operation tracking */
@@ -75,6 +82,7 @@ struct __wt_session_impl {
 
 	WT_ITEM	logrec_buf;		/* Buffer for log records */
 	WT_ITEM	logprint_buf;		/* Buffer for debug log records */
+	u_int	log_wait;		/* Waiting for a log write */
 
 	WT_ITEM	**scratch;		/* Temporary memory for any function */
 	u_int	scratch_alloc;		/* Currently allocated */
@@ -101,6 +109,9 @@ struct __wt_session_impl {
 	u_int	 excl_next;		/* Next empty slot */
 	size_t	 excl_allocated;	/* Bytes allocated */
 
+	WT_PAGE *read_ahead_page;	/* Page last read ahead */
+	uint32_t read_ahead_slot;	/* Slot last read ahead */
+
 	uint32_t id;			/* Offset in conn->session_array */
 
 	uint32_t flags;
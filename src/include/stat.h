@@ -28,40 +28,107 @@ struct __wt_stats {
 	(stats)->fld.v = (uint64_t)(value);				\
 } while (0)
 
+/*
+ * Statistics counters updated by application threads are sharded: a thread
+ * increments the slot selected by its session ID rather than a counter shared
+ * with every other thread.  There's a slot per CPU (up to WT_STAT_SHARDS_MAX),
+ * each slot holds a counter for every field of the statistics structure and
+ * starts on its own cache line, the slots are summed when a statistics cursor
+ * reads the structure.  More sessions than slots share slots, increments are
+ * atomic.
+ *
+ * There can be many data handles: their slots are only allocated once a
+ * statistics cursor reads the handle, and there are fewer of them (up to
+ * WT_STAT_DSRC_SHARDS_MAX).  The connection's slots are allocated when
+ * statistics are configured.  Until the slots are allocated (or if the
+ * allocation fails), the increments go to the statistics structure.
+ * Statistics that are set rather than incremented are stored in the structure
+ * itself.
+ */
+#define	WT_STAT_SHARDS_MAX	64		/* Maximum slots */
+#define	WT_STAT_DSRC_SHARDS_MAX	8	/* Maximum data-source slots */
+#define	WT_STAT_SHARD_ALIGN	64		/* Cache line size */
+
+#define	WT_STAT_COUNT(type)						\
+	(sizeof(type) / sizeof(WT_STATS))
+#define	WT_STAT_SHARD_STRIDE(type)					\
+	((size_t)WT_ALIGN(WT_STAT_COUNT(type) * sizeof(uint64_t),	\
+	    WT_STAT_SHARD_ALIGN) / sizeof(uint64_t))
+#define	WT_STAT_KEY(type, fld)						\
+	(offsetof(type, fld) / sizeof(WT_STATS))
+#define	WT_STAT_SHARD_ADD(						\
+    session, shards, nshards, stats, type, fld, value) do {		\
+	uint64_t *__shards = (shards);					\
+	if (__shards == NULL)						\
+		(void)WT_ATOMIC_ADD((stats)->fld.v, (uint64_t)(value));	\
+	else								\
+		(void)WT_ATOMIC_ADD(__shards[				\
+		    ((session)->id % (nshards)) *			\
+		    WT_STAT_SHARD_STRIDE(type) + WT_STAT_KEY(type, fld)],\
+		    (uint64_t)(value));					\
+} while (0)
+
 /* Connection statistics. */
+#define	WT_CSTAT_ADD(session, fld, v)					\
+	WT_STAT_SHARD_ADD(session, S2C(session)->stats_shards,		\
+	    S2C(session)->stat_shards,					\
+	    &S2C(session)->stats, WT_CONNECTION_STATS, fld, v)
 #define	WT_CSTAT_DECR(session, fld) do {				\
 	if (S2C(session)->statistics)					\
-		WT_STAT_DECR(&S2C(session)->stats, fld);		\
+		WT_CSTAT_ADD(session, fld, -1);				\
 } while (0)
 #define	WT_CSTAT_INCR(session, fld) do {				\
 	if (S2C(session)->statistics)					\
-		WT_STAT_INCR(&S2C(session)->stats, fld);		\
+		WT_CSTAT_ADD(session, fld, 1);				\
 } while (0)
 #define	WT_CSTAT_INCRV(session, fld, v) do {				\
 	if (S2C(session)->statistics)					\
-		WT_STAT_INCRV(&S2C(session)->stats, fld, v);		\
+		WT_CSTAT_ADD(session, fld, v);				\
 } while (0)
 #define	WT_CSTAT_SET(session, fld, v) do {				\
 	if (S2C(session)->statistics)					\
 		WT_STAT_SET(&S2C(session)->stats, fld, v);		\
 } while (0)
 
+/*
+ * Connection latency histograms: a histogram is a run of statistics named for
+ * the operation with a suffix of the bucket number, the bucket limits step 1,
+ * 2, 5 through each power of ten microseconds, see __wt_stat_latency.  A start
+ * time of zero means statistics weren't configured when the operation began.
+ */
+#define	WT_STAT_LATENCY_BUCKETS	20
+#define	WT_CSTAT_LATENCY_START(session, start) do {			\
+	(start).tv_sec = 0;						\
+	(start).tv_nsec = 0;						\
+	if (S2C(session)->statistics)					\
+		(void)__wt_epoch(session, &(start));			\
+} while (0)
+#define	WT_CSTAT_LATENCY(session, fld, start) do {			\
+	if ((start).tv_sec != 0)					\
+		__wt_stat_latency(session,				\
+		    WT_STAT_KEY(WT_CONNECTION_STATS, fld##_00), &(start));\
+} while (0)
+
 /* Data-source statistics. */
+#define	WT_DSTAT_ADD(session, fld, v)					\
+	WT_STAT_SHARD_ADD(session, (session)->dhandle->stats_shards,	\
+	    S2C(session)->stat_dsrc_shards,				\
+	    &(session)->dhandle->stats, WT_DSRC_STATS, fld, v)
 #define	WT_DSTAT_DECR(session, fld) do {				\
 	if (S2C(session)->statistics)					\
-		WT_STAT_DECR(&(session)->dhandle->stats, fld);		\
+		WT_DSTAT_ADD(session, fld, -1);				\
 } while (0)
 #define	WT_DSTAT_INCR(session, fld) do {				\
 	if (S2C(session)->statistics)					\
-		WT_STAT_INCR(&session->dhandle->stats, fld);		\
+		WT_DSTAT_ADD(session, fld, 1);				\
 } while (0)
 #define	WT_DSTAT_INCRV(session, fld, v) do {				\
 	if (S2C(session)->statistics)					\
-		WT_STAT_INCRV(&session->dhandle->stats, fld, v);	\
+		WT_DSTAT_ADD(session, fld, v);				\
 } while (0)
 #define	WT_DSTAT_SET(session, fld, v) do {				\
 	if (S2C(session)->statistics)					\
-		WT_STAT_SET(&session->dhandle->stats, fld, v);		\
+		WT_STAT_SET(&(session)->dhandle->stats, fld, v);	\
 } while (0)
 
 /* Flags used by statistics initialization. */
@@ -78,6 +145,7 @@ struct __wt_stats {
  */
 struct __wt_dsrc_stats {
 	WT_STATS block_alloc;
+	WT_STATS block_alloc_segregated;
 	WT_STATS block_allocsize;
 	WT_STATS block_checkpoint_size;
 	WT_STATS block_extension;
@@ -85,6 +153,7 @@ struct __wt_dsrc_stats {
 	WT_STATS block_magic;
 	WT_STATS block_major;
 	WT_STATS block_minor;
+	WT_STATS block_preallocate;
 	WT_STATS block_size;
 	WT_STATS bloom_count;
 	WT_STATS bloom_false_positive;
@@ -171,8 +240,10 @@ struct __wt_connection_stats {
 	WT_STATS block_byte_read;
 	WT_STATS block_byte_write;
 	WT_STATS block_map_read;
+	WT_STATS block_preload;
 	WT_STATS block_read;
 	WT_STATS block_write;
+	WT_STATS block_write_background;
 	WT_STATS cache_bytes_dirty;
 	WT_STATS cache_bytes_inuse;
 	WT_STATS cache_bytes_max;
@@ -195,6 +266,8 @@ struct __wt_connection_stats {
 	WT_STATS cache_read;
 	WT_STATS cache_write;
 	WT_STATS cond_wait;
+	WT_STATS config_compiled_lookup;
+	WT_STATS cursor_cache_reuse;
 	WT_STATS cursor_create;
 	WT_STATS cursor_insert;
 	WT_STATS cursor_next;
@@ -205,6 +278,171 @@ struct __wt_connection_stats {
 	WT_STATS cursor_search_near;
 	WT_STATS cursor_update;
 	WT_STATS file_open;
+	WT_STATS latency_evict_wait_00;
+	WT_STATS latency_evict_wait_01;
+	WT_STATS latency_evict_wait_02;
+	WT_STATS latency_evict_wait_03;
+	WT_STATS latency_evict_wait_04;
+	WT_STATS latency_evict_wait_05;
+	WT_STATS latency_evict_wait_06;
+	WT_STATS latency_evict_wait_07;
+	WT_STATS latency_evict_wait_08;
+	WT_STATS latency_evict_wait_09;
+	WT_STATS latency_evict_wait_10;
+	WT_STATS latency_evict_wait_11;
+	WT_STATS latency_evict_wait_12;
+	WT_STATS latency_evict_wait_13;
+	WT_STATS latency_evict_wait_14;
+	WT_STATS latency_evict_wait_15;
+	WT_STATS latency_evict_wait_16;
+	WT_STATS latency_evict_wait_17;
+	WT_STATS latency_evict_wait_18;
+	WT_STATS latency_evict_wait_19;
+	WT_STATS latency_fsync_00;
+	WT_STATS latency_fsync_01;
+	WT_STATS latency_fsync_02;
+	WT_STATS latency_fsync_03;
+	WT_STATS latency_fsync_04;
+	WT_STATS latency_fsync_05;
+	WT_STATS latency_fsync_06;
+	WT_STATS latency_fsync_07;
+	WT_STATS latency_fsync_08;
+	WT_STATS latency_fsync_09;
+	WT_STATS latency_fsync_10;
+	WT_STATS latency_fsync_11;
+	WT_STATS latency_fsync_12;
+	WT_STATS latency_fsync_13;
+	WT_STATS latency_fsync_14;
+	WT_STATS latency_fsync_15;
+	WT_STATS latency_fsync_16;
+	WT_STATS latency_fsync_17;
+	WT_STATS latency_fsync_18;
+	WT_STATS latency_fsync_19;
+	WT_STATS latency_insert_00;
+	WT_STATS latency_insert_01;
+	WT_STATS latency_insert_02;
+	WT_STATS latency_insert_03;
+	WT_STATS latency_insert_04;
+	WT_STATS latency_insert_05;
+	WT_STATS latency_insert_06;
+	WT_STATS latency_insert_07;
+	WT_STATS latency_insert_08;
+	WT_STATS latency_insert_09;
+	WT_STATS latency_insert_10;
+	WT_STATS latency_insert_11;
+	WT_STATS latency_insert_12;
+	WT_STATS latency_insert_13;
+	WT_STATS latency_insert_14;
+	WT_STATS latency_insert_15;
+	WT_STATS latency_insert_16;
+	WT_STATS latency_insert_17;
+	WT_STATS latency_insert_18;
+	WT_STATS latency_insert_19;
+	WT_STATS latency_read_00;
+	WT_STATS latency_read_01;
+	WT_STATS latency_read_02;
+	WT_STATS latency_read_03;
+	WT_STATS latency_read_04;
+	WT_STATS latency_read_05;
+	WT_STATS latency_read_06;
+	WT_STATS latency_read_07;
+	WT_STATS latency_read_08;
+	WT_STATS latency_read_09;
+	WT_STATS latency_read_10;
+	WT_STATS latency_read_11;
+	WT_STATS latency_read_12;
+	WT_STATS latency_read_13;
+	WT_STATS latency_read_14;
+	WT_STATS latency_read_15;
+	WT_STATS latency_read_16;
+	WT_STATS latency_read_17;
+	WT_STATS latency_read_18;
+	WT_STATS latency_read_19;
+	WT_STATS latency_remove_00;
+	WT_STATS latency_remove_01;
+	WT_STATS latency_remove_02;
+	WT_STATS latency_remove_03;
+	WT_STATS latency_remove_04;
+	WT_STATS latency_remove_05;
+	WT_STATS latency_remove_06;
+	WT_STATS latency_remove_07;
+	WT_STATS latency_remove_08;
+	WT_STATS latency_remove_09;
+	WT_STATS latency_remove_10;
+	WT_STATS latency_remove_11;
+	WT_STATS latency_remove_12;
+	WT_STATS latency_remove_13;
+	WT_STATS latency_remove_14;
+	WT_STATS latency_remove_15;
+	WT_STATS latency_remove_16;
+	WT_STATS latency_remove_17;
+	WT_STATS latency_remove_18;
+	WT_STATS latency_remove_19;
+	WT_STATS latency_search_00;
+	WT_STATS latency_search_01;
+	WT_STATS latency_search_02;
+	WT_STATS latency_search_03;
+	WT_STATS latency_search_04;
+	WT_STATS latency_search_05;
+	WT_STATS latency_search_06;
+	WT_STATS latency_search_07;
+	WT_STATS latency_search_08;
+	WT_STATS latency_search_09;
+	WT_STATS latency_search_10;
+	WT_STATS latency_search_11;
+	WT_STATS latency_search_12;
+	WT_STATS latency_search_13;
+	WT_STATS latency_search_14;
+	WT_STATS latency_search_15;
+	WT_STATS latency_search_16;
+	WT_STATS latency_search_17;
+	WT_STATS latency_search_18;
+	WT_STATS latency_search_19;
+	WT_STATS latency_update_00;
+	WT_STATS latency_update_01;
+	WT_STATS latency_update_02;
+	WT_STATS latency_update_03;
+	WT_STATS latency_update_04;
+	WT_STATS latency_update_05;
+	WT_STATS latency_update_06;
+	WT_STATS latency_update_07;
+	WT_STATS latency_update_08;
+	WT_STATS latency_update_09;
+	WT_STATS latency_update_10;
+	WT_STATS latency_update_11;
+	WT_STATS latency_update_12;
+	WT_STATS latency_update_13;
+	WT_STATS latency_update_14;
+	WT_STATS latency_update_15;
+	WT_STATS latency_update_16;
+	WT_STATS latency_update_17;
+	WT_STATS latency_update_18;
+	WT_STATS latency_update_19;
+	WT_STATS latency_write_00;
+	WT_STATS latency_write_01;
+	WT_STATS latency_write_02;
+	WT_STATS latency_write_03;
+	WT_STATS latency_write_04;
+	WT_STATS latency_write_05;
+	WT_STATS latency_write_06;
+	WT_STATS latency_write_07;
+	WT_STATS latency_write_08;
+	WT_STATS latency_write_09;
+	WT_STATS latency_write_10;
+	WT_STATS latency_write_11;
+	WT_STATS latency_write_12;
+	WT_STATS latency_write_13;
+	WT_STATS latency_write_14;
+	WT_STATS latency_write_15;
+	WT_STATS latency_write_16;
+	WT_STATS latency_write_17;
+	WT_STATS latency_write_18;
+	WT_STATS latency_write_19;
+	WT_STATS log_bytes_written;
+	WT_STATS log_records;
+	WT_STATS log_syncs;
+	WT_STATS log_writes;
+	WT_STATS lsm_partitions_built;
 	WT_STATS lsm_rows_merged;
 	WT_STATS memory_allocation;
 	WT_STATS memory_free;
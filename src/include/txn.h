@@ -42,15 +42,40 @@ typedef uint32_t wt_txnid_t;
 #define	TXNID_LT(t1, t2)						\
 	((t1) != (t2) && TXNID_LE(t1, t2))
 
+/* Transaction state bitmap word and bit for a session slot. */
+#define	WT_TXN_STATE_WORDS(n)	(((n) + 63) / 64)
+#define	WT_TXN_STATE_WORD(slot)	((slot) / 64)
+#define	WT_TXN_STATE_BIT(slot)	((uint64_t)1 << ((slot) % 64))
+
 struct __wt_txn_state {
 	volatile wt_txnid_t id;
 	volatile wt_txnid_t snap_min;
 };
 
+/*
+ * Commit durability, from strongest to weakest: wait for the log to be synced,
+ * wait for the log to be written, buffer the log records, don't log.
+ */
+enum __wt_txn_sync {
+	TXN_SYNC_FULL,
+	TXN_SYNC_FLUSH,
+	TXN_SYNC_WRITE,
+	TXN_SYNC_NONE
+};
+
 struct __wt_txn_global {
 	volatile wt_txnid_t current;	/* Current transaction ID. */
 	volatile uint32_t gen;		/* Completed transaction generation */
 	WT_TXN_STATE *states;		/* Per-session transaction states */
+
+	/*
+	 * A bitmap of the transaction states in use: sessions mark their state
+	 * before setting an ID or snap_min, and clear the mark when neither is
+	 * set, so scans of the states skip idle sessions.
+	 */
+	volatile uint64_t *state_map;
+
+	WT_TXN_SYNC sync;		/* Default commit durability */
 };
 
 enum __wt_txn_isolation {
@@ -63,6 +88,7 @@ struct __wt_txn {
 	wt_txnid_t id;
 
 	WT_TXN_ISOLATION isolation;
+	WT_TXN_SYNC sync;
 
 	/*
 	 * Snapshot data:
@@ -96,6 +122,11 @@ struct __wt_txn {
 	size_t		modref_alloc;
 	u_int		modref_count;
 
+	/* Updates made by this transaction, packed as log operations. */
+	WT_ITEM		logrec;
+	off_t		commit_lsn;	/* LSN of a commit in progress */
+	off_t		ckpt_lsn;	/* Checkpoint's recovery LSN */
+
 #define	TXN_AUTOCOMMIT	0x01
 #define	TXN_ERROR	0x02
 #define	TXN_OLDEST	0x04
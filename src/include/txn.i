@@ -8,6 +8,90 @@
 static inline void __wt_txn_read_first(WT_SESSION_IMPL *session);
 static inline void __wt_txn_read_last(WT_SESSION_IMPL *session);
 
+/*
+ * __wt_txn_state_set --
+ *	Mark the session's transaction state in use, before setting its ID or
+ * snap_min.
+ */
+static inline void
+__wt_txn_state_set(WT_SESSION_IMPL *session)
+{
+	WT_TXN_GLOBAL *txn_global;
+	uint64_t bit;
+	uint32_t word;
+
+	txn_global = &S2C(session)->txn_global;
+	word = WT_TXN_STATE_WORD(session->id);
+	bit = WT_TXN_STATE_BIT(session->id);
+
+	/*
+	 * Only the session changes its own bit, so adding and subtracting the
+	 * bit are the same as setting and clearing it.  The atomic operation
+	 * is a full barrier, the mark is set before the state is.
+	 */
+	if ((txn_global->state_map[word] & bit) == 0)
+		(void)WT_ATOMIC_ADD(txn_global->state_map[word], bit);
+}
+
+/*
+ * __wt_txn_state_clear --
+ *	Clear the mark on the session's transaction state if neither its ID nor
+ * its snap_min is set.
+ */
+static inline void
+__wt_txn_state_clear(WT_SESSION_IMPL *session)
+{
+	WT_TXN_GLOBAL *txn_global;
+	WT_TXN_STATE *txn_state;
+	uint64_t bit;
+	uint32_t word;
+
+	txn_global = &S2C(session)->txn_global;
+	txn_state = &txn_global->states[session->id];
+	if (txn_state->id != WT_TXN_NONE || txn_state->snap_min != WT_TXN_NONE)
+		return;
+
+	word = WT_TXN_STATE_WORD(session->id);
+	bit = WT_TXN_STATE_BIT(session->id);
+	if ((txn_global->state_map[word] & bit) != 0)
+		(void)WT_ATOMIC_SUB(txn_global->state_map[word], bit);
+}
+
+/*
+ * __wt_txn_state_next --
+ *	Return the next transaction state in use, starting at the given slot,
+ * and update the slot to follow it; return NULL if there are no more.
+ */
+static inline WT_TXN_STATE *
+__wt_txn_state_next(
+    WT_CONNECTION_IMPL *conn, uint32_t *slotp, uint32_t session_cnt)
+{
+	WT_TXN_GLOBAL *txn_global;
+	uint64_t bits;
+	uint32_t slot;
+
+	txn_global = &conn->txn_global;
+
+	for (slot = *slotp; slot < session_cnt;) {
+		/* Read the mark before the state it covers. */
+		WT_ORDERED_READ(
+		    bits, txn_global->state_map[WT_TXN_STATE_WORD(slot)]);
+		bits >>= slot % 64;
+		if (bits == 0) {
+			slot = (WT_TXN_STATE_WORD(slot) + 1) * 64;
+			continue;
+		}
+		for (; (bits & 1) == 0; bits >>= 1)
+			++slot;
+		if (slot >= session_cnt)
+			break;
+		*slotp = slot + 1;
+		return (&txn_global->states[slot]);
+	}
+	*slotp = session_cnt;
+	return (NULL);
+}
+
 /*
  * __wt_txn_modify --
  *	Mark a WT_UPDATE object modified by the current transaction.
@@ -277,8 +361,10 @@ __wt_txn_read_first(WT_SESSION_IMPL *session)
 	    (!F_ISSET(txn, TXN_RUNNING) &&
 	    txn->isolation == TXN_ISO_SNAPSHOT))
 		__wt_txn_get_snapshot(session, WT_TXN_NONE, WT_TXN_NONE, 0);
-	else if (!F_ISSET(txn, TXN_RUNNING))
+	else if (!F_ISSET(txn, TXN_RUNNING)) {
+		__wt_txn_state_set(session);
 		txn_state->snap_min = txn_global->current;
+	}
 }
 
 /*
@@ -299,8 +385,10 @@ __wt_txn_read_last(WT_SESSION_IMPL *session)
 	    (!F_ISSET(txn, TXN_RUNNING) &&
 	    txn->isolation == TXN_ISO_SNAPSHOT))
 		__wt_txn_release_snapshot(session);
-	else if (!F_ISSET(txn, TXN_RUNNING))
+	else if (!F_ISSET(txn, TXN_RUNNING)) {
 		txn_state->snap_min = WT_TXN_NONE;
+		__wt_txn_state_clear(session);
+	}
 }
 
 /*
@@ -334,9 +422,7 @@ __wt_txn_am_oldest(WT_SESSION_IMPL *session)
 		return (0);
 
 	WT_ORDERED_READ(session_cnt, conn->session_cnt);
-	for (i = 0, s = txn_global->states;
-	    i < session_cnt;
-	    i++, s++)
+	for (i = 0; (s = __wt_txn_state_next(conn, &i, session_cnt)) != NULL;)
 		if ((id = s->id) != WT_TXN_NONE && TXNID_LT(id, my_id))
 			return (0);
 
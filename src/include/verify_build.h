@@ -45,6 +45,7 @@ __wt_verify_build(void)
 {
 	/* On-disk structures should not be padded. */
 	SIZE_CHECK(WT_BLOCK_DESC, WT_BLOCK_DESC_SIZE);
+	SIZE_CHECK(WT_LOG_RECORD, WT_LOG_RECORD_SIZE);
 
 	/*
 	 * We mix-and-match 32-bit unsigned values and size_t's, mostly because
@@ -51,6 +51,8 @@ enum __wt_page_state;
     typedef enum __wt_page_state WT_PAGE_STATE;
 enum __wt_txn_isolation;
     typedef enum __wt_txn_isolation WT_TXN_ISOLATION;
+enum __wt_txn_sync;
+    typedef enum __wt_txn_sync WT_TXN_SYNC;
 struct __wt_addr;
     typedef struct __wt_addr WT_ADDR;
 struct __wt_block;
@@ -61,6 +63,12 @@ struct __wt_block_desc;
     typedef struct __wt_block_desc WT_BLOCK_DESC;
 struct __wt_block_header;
     typedef struct __wt_block_header WT_BLOCK_HEADER;
+struct __wt_block_io;
+    typedef struct __wt_block_io WT_BLOCK_IO;
+struct __wt_block_io_thread;
+    typedef struct __wt_block_io_thread WT_BLOCK_IO_THREAD;
+struct __wt_block_io_waiter;
+    typedef struct __wt_block_io_waiter WT_BLOCK_IO_WAITER;
 struct __wt_bloom;
     typedef struct __wt_bloom WT_BLOOM;
 struct __wt_bloom_hash;
@@ -89,8 +97,12 @@ struct __wt_condvar;
     typedef struct __wt_condvar WT_CONDVAR;
 struct __wt_config;
     typedef struct __wt_config WT_CONFIG;
+struct __wt_config_arena;
+    typedef struct __wt_config_arena WT_CONFIG_ARENA;
 struct __wt_config_check;
     typedef struct __wt_config_check WT_CONFIG_CHECK;
+struct __wt_config_compiled;
+    typedef struct __wt_config_compiled WT_CONFIG_COMPILED;
 struct __wt_config_entry;
     typedef struct __wt_config_entry WT_CONFIG_ENTRY;
 struct __wt_connection_impl;
@@ -107,6 +119,8 @@ struct __wt_cursor_config;
     typedef struct __wt_cursor_config WT_CURSOR_CONFIG;
 struct __wt_cursor_dump;
     typedef struct __wt_cursor_dump WT_CURSOR_DUMP;
+struct __wt_cursor_extractor;
+    typedef struct __wt_cursor_extractor WT_CURSOR_EXTRACTOR;
 struct __wt_cursor_index;
     typedef struct __wt_cursor_index WT_CURSOR_INDEX;
 struct __wt_cursor_lsm;
@@ -125,6 +139,8 @@ struct __wt_dsrc_stats;
     typedef struct __wt_dsrc_stats WT_DSRC_STATS;
 struct __wt_evict_entry;
     typedef struct __wt_evict_entry WT_EVICT_ENTRY;
+struct __wt_evict_worker;
+    typedef struct __wt_evict_worker WT_EVICT_WORKER;
 struct __wt_ext;
     typedef struct __wt_ext WT_EXT;
 struct __wt_extlist;
@@ -141,14 +157,22 @@ struct __wt_insert;
     typedef struct __wt_insert WT_INSERT;
 struct __wt_insert_head;
     typedef struct __wt_insert_head WT_INSERT_HEAD;
+struct __wt_log;
+    typedef struct __wt_log WT_LOG;
+struct __wt_log_record;
+    typedef struct __wt_log_record WT_LOG_RECORD;
 struct __wt_lsm_chunk;
     typedef struct __wt_lsm_chunk WT_LSM_CHUNK;
 struct __wt_lsm_data_source;
     typedef struct __wt_lsm_data_source WT_LSM_DATA_SOURCE;
+struct __wt_lsm_merge_part;
+    typedef struct __wt_lsm_merge_part WT_LSM_MERGE_PART;
 struct __wt_lsm_tree;
     typedef struct __wt_lsm_tree WT_LSM_TREE;
-struct __wt_lsm_worker_args;
-    typedef struct __wt_lsm_worker_args WT_LSM_WORKER_ARGS;
+struct __wt_lsm_work_unit;
+    typedef struct __wt_lsm_work_unit WT_LSM_WORK_UNIT;
+struct __wt_lsm_worker;
+    typedef struct __wt_lsm_worker WT_LSM_WORKER;
 struct __wt_lsm_worker_cookie;
     typedef struct __wt_lsm_worker_cookie WT_LSM_WORKER_COOKIE;
 struct __wt_named_collator;
@@ -157,6 +181,8 @@ struct __wt_named_compressor;
     typedef struct __wt_named_compressor WT_NAMED_COMPRESSOR;
 struct __wt_named_data_source;
     typedef struct __wt_named_data_source WT_NAMED_DATA_SOURCE;
+struct __wt_named_extractor;
+    typedef struct __wt_named_extractor WT_NAMED_EXTRACTOR;
 struct __wt_page;
     typedef struct __wt_page WT_PAGE;
 struct __wt_page_header;
@@ -183,6 +209,10 @@ struct __wt_size;
     typedef struct __wt_size WT_SIZE;
 struct __wt_stats;
     typedef struct __wt_stats WT_STATS;
+struct __wt_sync_batch;
+    typedef struct __wt_sync_batch WT_SYNC_BATCH;
+struct __wt_sync_thread;
+    typedef struct __wt_sync_thread WT_SYNC_THREAD;
 struct __wt_table;
     typedef struct __wt_table WT_TABLE;
 struct __wt_txn;
@@ -193,6 +223,8 @@ struct __wt_txn_state;
     typedef struct __wt_txn_state WT_TXN_STATE;
 struct __wt_update;
     typedef struct __wt_update WT_UPDATE;
+union __wt_page_lock_slot;
+    typedef union __wt_page_lock_slot WT_PAGE_LOCK_SLOT;
 /*
  * Forward type declarations for internal types: END
  * DO NOT EDIT: automatically built by dist/s_typedef.
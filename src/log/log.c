@@ -7,37 +7,447 @@
 
 #include "wt_internal.h"
 
+/*
+ * __wt_log_open --
+ *	Open the connection's log file.
+ */
+int
+__wt_log_open(WT_SESSION_IMPL *session)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+	WT_LOG *log;
+	off_t size;
+
+	conn = S2C(session);
+
+	WT_RET(__wt_calloc_def(session, 1, &log));
+	conn->log = log;
+
+	__wt_spin_init(session, &log->lock);
+	WT_ERR(__wt_open(session, WT_LOG_FILENAME, 1, 0, 0, &log->fh));
+
+	/* New records are appended to the end of the file. */
+	WT_ERR(__wt_filesize(session, log->fh, &size));
+	log->alloc_lsn = log->write_lsn = log->sync_lsn = size;
+
+	if (0) {
+err:		WT_TRET(__wt_log_close(session));
+	}
+	return (ret);
+}
+
+/*
+ * __wt_log_close --
+ *	Flush anything buffered and close the connection's log file.
+ */
+int
+__wt_log_close(WT_SESSION_IMPL *session)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+	WT_LOG *log;
+
+	conn = S2C(session);
+
+	if ((log = conn->log) == NULL)
+		return (0);
+
+	if (log->fh != NULL) {
+		/*
+		 * Every committing thread waits for its own records, anything
+		 * left in the buffers was written without waiting (debugging
+		 * messages, for example).
+		 */
+		__wt_spin_lock(session, &log->lock);
+		if (log->sync_lsn < log->alloc_lsn)
+			ret = __wt_log_flush(session, WT_LOG_FSYNC);
+		__wt_spin_unlock(session, &log->lock);
+
+		WT_TRET(__wt_close(session, log->fh));
+	}
+
+	__wt_buf_free(session, &log->buf[0]);
+	__wt_buf_free(session, &log->buf[1]);
+	__wt_spin_destroy(session, &log->lock);
+	__wt_free(session, conn->log);
+
+	return (ret);
+}
+
+/*
+ * __log_wake_waiters --
+ *	Wake every thread waiting for a log write.
+ */
 static int
-__log_record_size(WT_SESSION_IMPL *session,
-    size_t *sizep, WT_LOGREC_DESC *recdesc, va_list ap)
+__log_wake_waiters(WT_SESSION_IMPL *session)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+	WT_SESSION_IMPL *s;
+	uint32_t i, session_cnt;
+
+	conn = S2C(session);
+
+	WT_ORDERED_READ(session_cnt, conn->session_cnt);
+	for (s = conn->sessions, i = 0; i < session_cnt; ++s, ++i)
+		if (s->log_wait && s != session)
+			WT_TRET(__wt_cond_signal(session, s->cond));
+	return (ret);
+}
+
+/*
+ * __log_group_write --
+ *	Write (and optionally sync) everything in the active log buffer.  Called
+ * with the log lock held, the lock is dropped while the write is done.
+ */
+static int
+__log_group_write(WT_SESSION_IMPL *session)
+{
+	WT_DECL_RET;
+	WT_ITEM *buf;
+	WT_LOG *log;
+	off_t offset;
+	int sync;
+
+	log = S2C(session)->log;
+
+	/*
+	 * Swap buffers so threads can keep buffering records while we write,
+	 * the other buffer is empty because no other write is in progress.
+	 */
+	buf = &log->buf[log->buf_active];
+	log->buf_active ^= 1;
+	sync = log->buf_sync;
+	log->buf_sync = 0;
+	offset = log->write_lsn;
+	log->writing = 1;
+	__wt_spin_unlock(session, &log->lock);
+
+	if (buf->size > 0) {
+		ret = __wt_write(
+		    session, log->fh, offset, buf->size, buf->mem);
+		WT_CSTAT_INCR(session, log_writes);
+		WT_CSTAT_INCRV(session, log_bytes_written, buf->size);
+	}
+	if (ret == 0 && sync) {
+		ret = __wt_fsync(session, log->fh);
+		WT_CSTAT_INCR(session, log_syncs);
+	}
+
+	__wt_spin_lock(session, &log->lock);
+
+	/*
+	 * If the write failed, the log has a hole in it and committed updates
+	 * after that point are no longer durable: there's no way to continue.
+	 */
+	if (ret != 0)
+		WT_PANIC_ERR(session, ret,
+		    "%s: log write failed", log->fh->name);
+	else {
+		log->write_lsn = offset + (off_t)buf->size;
+		if (sync)
+			log->sync_lsn = log->write_lsn;
+	}
+	buf->size = 0;
+	log->writing = 0;
+
+	if (log->waiters > 0)
+		WT_TRET(__log_wake_waiters(session));
+	return (ret);
+}
+
+/*
+ * __wt_log_flush --
+ *	Wait until everything buffered in the log is written, and optionally
+ * synced.  Called with the log lock held.
+ */
+int
+__wt_log_flush(WT_SESSION_IMPL *session, uint32_t flags)
+{
+	WT_DECL_RET;
+	WT_LOG *log;
+	off_t end;
+
+	log = S2C(session)->log;
+	end = log->alloc_lsn;
+
+	if (LF_ISSET(WT_LOG_FSYNC) && log->sync_lsn < end)
+		log->buf_sync = 1;
+
+	for (;;) {
+		if (LF_ISSET(WT_LOG_FSYNC) ?
+		    log->sync_lsn >= end : log->write_lsn >= end)
+			break;
+		if (F_ISSET(S2C(session), WT_CONN_PANIC))
+			return (WT_PANIC);
+
+		/*
+		 * If no write is in progress, become the leader and write the
+		 * group, including our own records.
+		 */
+		if (!log->writing) {
+			WT_RET(__log_group_write(session));
+			continue;
+		}
+
+		/*
+		 * Wait for the current leader: it wakes every waiting thread
+		 * when its write completes, and the first of them to find
+		 * records still buffered leads the next group.  Our condition
+		 * variable remembers a signal that arrives before we wait.
+		 */
+		session->log_wait = 1;
+		++log->waiters;
+		__wt_spin_unlock(session, &log->lock);
+		ret = __wt_cond_wait(session, session->cond, 0);
+		__wt_spin_lock(session, &log->lock);
+		--log->waiters;
+		session->log_wait = 0;
+		WT_RET(ret);
+	}
+	return (0);
+}
+
+/*
+ * __wt_log_write --
+ *	Append a record to the log.  The record must start with space for a
+ * WT_LOG_RECORD header.  Unless flags are specified, the record is buffered
+ * and written with the next group, or by the log server.
+ */
+int
+__wt_log_write(WT_SESSION_IMPL *session,
+    WT_ITEM *record, off_t *lsnp, uint32_t flags)
 {
-	return (__wt_struct_sizev(session, sizep, recdesc->fmt, ap));
+	WT_DECL_RET;
+	WT_ITEM *buf;
+	WT_LOG *log;
+	WT_LOG_RECORD *logrec;
+	off_t lsn;
+
+	log = S2C(session)->log;
+
+	/* Fill in the record header. */
+	logrec = (WT_LOG_RECORD *)record->mem;
+	logrec->len = record->size;
+	logrec->cksum = 0;
+	logrec->cksum = __wt_cksum(record->mem, record->size);
+
+	__wt_spin_lock(session, &log->lock);
+
+	/* Copy the record into the active buffer and allocate an LSN. */
+	buf = &log->buf[log->buf_active];
+	WT_ERR(__wt_buf_grow(session, buf, buf->size + record->size));
+	memcpy((uint8_t *)buf->mem + buf->size, record->mem, record->size);
+	buf->size += record->size;
+	lsn = log->alloc_lsn;
+	log->alloc_lsn += (off_t)record->size;
+	WT_CSTAT_INCR(session, log_records);
+
+	/*
+	 * Return the LSN before waiting for the write, checkpoints look for the
+	 * LSNs of commits in progress (see __wt_log_ckpt_lsn).
+	 */
+	if (lsnp != NULL)
+		*lsnp = lsn;
+
+	/*
+	 * Records that don't wait for a flush are written by a later commit
+	 * or the log server, but don't let the buffer grow without bound.
+	 */
+	if (!LF_ISSET(WT_LOG_FLUSH | WT_LOG_FSYNC) &&
+	    buf->size >= WT_LOG_BUF_MAX)
+		flags = WT_LOG_FLUSH;
+	if (LF_ISSET(WT_LOG_FLUSH | WT_LOG_FSYNC))
+		ret = __wt_log_flush(session, flags);
+
+err:	__wt_spin_unlock(session, &log->lock);
+	return (ret);
 }
 
+/*
+ * __wt_log_put --
+ *	Pack a record described by a WT_LOGREC_DESC and append it to the log.
+ */
 int
-__wt_log_put(WT_SESSION_IMPL *session, WT_LOGREC_DESC *recdesc, ...)
+__wt_log_put(WT_SESSION_IMPL *session,
+    WT_LOGREC_DESC *recdesc, off_t *lsnp, uint32_t flags, ...)
 {
 	WT_DECL_RET;
 	WT_ITEM *buf;
+	WT_LOG_RECORD *logrec;
 	va_list ap;
 	size_t size;
 
 	buf = &session->logrec_buf;
 	size = 0;
 
-	va_start(ap, recdesc);
-	ret = __log_record_size(session, &size, recdesc, ap);
+	va_start(ap, flags);
+	ret = __wt_struct_sizev(session, &size, recdesc->fmt, ap);
 	va_end(ap);
 	WT_RET(ret);
 
-	WT_RET(__wt_buf_initsize(session, buf, size));
+	WT_RET(__wt_buf_initsize(session, buf, WT_LOG_RECORD_SIZE + size));
+	logrec = (WT_LOG_RECORD *)buf->mem;
+	logrec->rectype = recdesc->rectype;
+	logrec->unused = 0;
 
-	va_start(ap, recdesc);
-	ret = __wt_struct_packv(session, buf->mem, size, recdesc->fmt, ap);
+	va_start(ap, flags);
+	ret = __wt_struct_packv(session,
+	    (uint8_t *)buf->mem + WT_LOG_RECORD_SIZE, size, recdesc->fmt, ap);
 	va_end(ap);
+	WT_RET(ret);
+
+	return (__wt_log_write(session, buf, lsnp, flags));
+}
+
+/*
+ * __wt_log_ckpt_lsn --
+ *	Return the LSN from which a checkpoint starting now must be recovered:
+ * the end of the log, or the earliest commit in progress, whose updates may
+ * not be visible to the checkpoint.  Without a log, any log created later
+ * must be recovered from its start.
+ */
+void
+__wt_log_ckpt_lsn(WT_SESSION_IMPL *session, off_t *lsnp)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_LOG *log;
+	WT_SESSION_IMPL *s;
+	off_t commit_lsn, lsn;
+	uint32_t i, session_cnt;
+
+	conn = S2C(session);
+
+	if ((log = conn->log) == NULL) {
+		*lsnp = 0;
+		return;
+	}
+
+	/*
+	 * Commit LSNs are allocated with the log lock held, and cleared after
+	 * the transaction is visible: any commit not found here either has a
+	 * larger LSN, or is visible to a snapshot taken after we return.
+	 */
+	__wt_spin_lock(session, &log->lock);
+	lsn = log->alloc_lsn;
+	WT_ORDERED_READ(session_cnt, conn->session_cnt);
+	for (s = conn->sessions, i = 0; i < session_cnt; ++s, ++i) {
+		if (!s->active)
+			continue;
+		WT_ORDERED_READ(commit_lsn, s->txn.commit_lsn);
+		if (commit_lsn != WT_LOG_INVALID_LSN && commit_lsn < lsn)
+			lsn = commit_lsn;
+	}
+	__wt_spin_unlock(session, &log->lock);
+
+	*lsnp = lsn;
+}
+
+/*
+ * __wt_log_scan --
+ *	Call a function for each complete record in the log, starting at an
+ * LSN.  The first record that is incomplete or fails its checksum marks the
+ * end of the log: it was being written when the system failed, the log is
+ * truncated so new records follow the last complete record.
+ */
+int
+__wt_log_scan(WT_SESSION_IMPL *session, off_t start,
+    int (*func)(WT_SESSION_IMPL *, WT_ITEM *, off_t, void *), void *cookie)
+{
+	WT_DECL_ITEM(buf);
+	WT_DECL_RET;
+	WT_ITEM record;
+	WT_LOG *log;
+	WT_LOG_RECORD *logrec;
+	off_t buf_off, end, lsn;
+	size_t len, offset;
+	uint32_t cksum;
+
+	log = S2C(session)->log;
+
+	/* We're single-threaded: new records aren't written during a scan. */
+	WT_RET(__wt_filesize(session, log->fh, &end));
+	WT_RET(__wt_scr_alloc(session, WT_LOG_SCAN_CHUNK, &buf));
+
+	WT_CLEAR(record);
+	for (buf_off = lsn = start; lsn < end; lsn += (off_t)len) {
+		/*
+		 * Read the log in large chunks, re-filling the buffer from the
+		 * current record when it runs out.
+		 */
+		offset = (size_t)(lsn - buf_off);
+		if (offset + WT_LOG_RECORD_SIZE > buf->size) {
+			buf_off = lsn;
+			offset = 0;
+			len = (size_t)WT_MIN(WT_LOG_SCAN_CHUNK, end - lsn);
+			if (len < WT_LOG_RECORD_SIZE)
+				break;
+			WT_ERR(__wt_read(session, log->fh, lsn, len, buf->mem));
+			buf->size = len;
+		}
+
+		logrec = (WT_LOG_RECORD *)((uint8_t *)buf->mem + offset);
+		len = logrec->len;
+		if (len < WT_LOG_RECORD_SIZE || (off_t)len > end - lsn)
+			break;
+		if (offset + len > buf->size) {
+			buf_off = lsn;
+			offset = 0;
+			WT_ERR(__wt_buf_init(session, buf, len));
+			WT_ERR(__wt_read(session, log->fh, lsn, len, buf->mem));
+			buf->size = len;
+			logrec = (WT_LOG_RECORD *)buf->mem;
+		}
+
+		cksum = logrec->cksum;
+		logrec->cksum = 0;
+		if (__wt_cksum(logrec, len) != cksum)
+			break;
+		logrec->cksum = cksum;
+
+		record.data = logrec;
+		record.size = WT_STORE_SIZE(len);
+		WT_ERR(func(session, &record, lsn, cookie));
+	}
+
+	if (lsn < end) {
+		WT_ERR(__wt_msg(session,
+		    "%s: discarding %" PRIuMAX " bytes of incomplete log "
+		    "records at LSN %" PRIuMAX, log->fh->name,
+		    (uintmax_t)(end - lsn), (uintmax_t)lsn));
+		WT_ERR(__wt_ftruncate(session, log->fh, lsn));
+		WT_ERR(__wt_fsync(session, log->fh));
+		__wt_spin_lock(session, &log->lock);
+		log->alloc_lsn = log->write_lsn = log->sync_lsn = lsn;
+		__wt_spin_unlock(session, &log->lock);
+	}
+
+err:	__wt_scr_free(&buf);
 	return (ret);
 }
 
+/*
+ * __wt_logop_read --
+ *	Peek at the type and size of the next operation in a commit record.
+ */
+int
+__wt_logop_read(WT_SESSION_IMPL *session,
+    const uint8_t **pp, const uint8_t *end, uint32_t *optypep, uint32_t *opsizep)
+{
+	WT_RET(__wt_struct_unpack(session,
+	    *pp, WT_PTRDIFF(end, *pp), "II", optypep, opsizep));
+
+	/* The recorded size doesn't include the type and size themselves. */
+	*opsizep += (uint32_t)
+	    (__wt_vsize_uint(*optypep) + __wt_vsize_uint(*opsizep));
+	return (0);
+}
+
+/*
+ * __wt_log_vprintf --
+ *	Write a debugging message into the log.
+ */
 int
 __wt_log_vprintf(WT_SESSION_IMPL *session, const char *fmt, va_list ap)
 {
@@ -48,32 +458,26 @@ __wt_log_vprintf(WT_SESSION_IMPL *session, const char *fmt, va_list ap)
 
 	conn = S2C(session);
 
-	if (conn->log_fh == NULL)
+	if (!F_ISSET(conn, WT_CONN_LOGGING))
 		return (0);
 
 	buf = &session->logprint_buf;
 
 	va_copy(ap_copy, ap);
-	len = (size_t)vsnprintf(NULL, 0, fmt, ap_copy) + 2;
+	len = (size_t)vsnprintf(NULL, 0, fmt, ap_copy) + 1;
 	va_end(ap_copy);
 
 	WT_RET(__wt_buf_initsize(session, buf, len));
 
 	(void)vsnprintf(buf->mem, len, fmt, ap);
 
-	/*
-	 * For now, just dump the text into the file.  Later, we will use
-	 * __wt_logput_debug to wrap this in a log header.
-	 */
-#if 1
-	strcpy((char *)buf->mem + len - 2, "\n");
-	return ((write(conn->log_fh->fd, buf->mem, len - 1) ==
-	    (ssize_t)len - 1) ? 0 : WT_ERROR);
-#else
-	return (__wt_logput_debug(session, (char *)buf->mem));
-#endif
+	return (__wt_logput_debug(session, NULL, 0, (char *)buf->mem));
 }
 
+/*
+ * __wt_log_printf --
+ *	Write a debugging message into the log.
+ */
 int
 __wt_log_printf(WT_SESSION_IMPL *session, const char *fmt, ...)
     WT_GCC_FUNC_ATTRIBUTE((format (printf, 2, 3)))
@@ -2,8 +2,14 @@
 
 #include "wt_internal.h"
 
+WT_LOGREC_DESC
+__wt_logdesc_commit =
+{
+	WT_LOGREC_COMMIT, "Iu", { "txnid", "ops", NULL }
+};
+
 WT_LOGREC_DESC
 __wt_logdesc_debug =
 {
-	"S", { "message", NULL }
+	WT_LOGREC_DEBUG, "S", { "message", NULL }
 };
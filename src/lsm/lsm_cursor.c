@@ -11,12 +11,6 @@
 	for ((i) = (clsm)->nchunks; (i) > 0;)				\
 		if (((c) = (clsm)->cursors[--i]) != NULL)
 
-#define	WT_LSM_CMP(s, lsm_tree, k1, k2, cmp)				\
-	(((lsm_tree)->collator == NULL) ?				\
-	(((cmp) = __wt_btree_lex_compare((k1), (k2))), 0) :		\
-	(lsm_tree)->collator->compare((lsm_tree)->collator,		\
-	    &(s)->iface, (k1), (k2), &(cmp)))
-
 #define	WT_LSM_CURCMP(s, lsm_tree, c1, c2, cmp)				\
 	WT_LSM_CMP(s, lsm_tree, &(c1)->key, &(c2)->key, cmp)
 
@@ -198,12 +192,19 @@ __clsm_open_cursors(
 			    chunk->uri, &clsm->iface, NULL, cp);
 		WT_ERR(ret);
 
+		/*
+		 * Bloom filters are shared in memory by all of the cursors on
+		 * a chunk, the first cursor to open a filter loads it.
+		 */
 		if (F_ISSET(chunk, WT_LSM_CHUNK_BLOOM) &&
-		    !F_ISSET(clsm, WT_CLSM_MERGE))
+		    !F_ISSET(clsm, WT_CLSM_MERGE)) {
 			WT_ERR(__wt_bloom_open(session, chunk->bloom_uri,
 			    lsm_tree->bloom_bit_count,
 			    lsm_tree->bloom_hash_count,
 			    c, &clsm->blooms[i]));
+			WT_ERR(__wt_bloom_load(
+			    clsm->blooms[i], &chunk->bloom_bits));
+		}
 
 		/* Child cursors always use overwrite and raw mode. */
 		F_SET(*cp, WT_CURSTD_OVERWRITE | WT_CURSTD_RAW);
@@ -838,6 +839,8 @@ __clsm_put(
 
 		if (ovfl && F_ISSET(lsm_tree, WT_LSM_TREE_LOCKED)) {
 			F_SET(lsm_tree, WT_LSM_TREE_NEED_SWITCH);
+			WT_RET(__wt_lsm_work_queue(
+			    session, lsm_tree, WT_LSM_WORK_SWITCH));
 			ovfl = 0;
 		}
 	} else
@@ -866,17 +869,23 @@ __clsm_insert(WT_CURSOR *cursor)
 {
 	WT_CURSOR_LSM *clsm;
 	WT_DECL_RET;
+	WT_ITEM value;
 	WT_SESSION_IMPL *session;
 
 	WT_LSM_UPDATE_ENTER(clsm, cursor, session, insert);
 	WT_CURSOR_NEEDKEY(cursor);
 	WT_LSM_NEEDVALUE(cursor);
 
-	if (!F_ISSET(cursor, WT_CURSTD_OVERWRITE) &&
-	    (ret = __clsm_search(cursor)) != WT_NOTFOUND) {
-		if (ret == 0)
-			ret = WT_DUPLICATE_KEY;
-		return (ret);
+	/* Searching for the key replaces the value: restore it. */
+	if (!F_ISSET(cursor, WT_CURSTD_OVERWRITE)) {
+		value = cursor->value;
+		ret = __clsm_search(cursor);
+		cursor->value = value;
+		if (ret != WT_NOTFOUND) {
+			if (ret == 0)
+				ret = WT_DUPLICATE_KEY;
+			return (ret);
+		}
 	}
 
 	ret = __clsm_put(session, clsm, &cursor->key, &cursor->value);
@@ -894,15 +903,22 @@ __clsm_update(WT_CURSOR *cursor)
 {
 	WT_CURSOR_LSM *clsm;
 	WT_DECL_RET;
+	WT_ITEM value;
 	WT_SESSION_IMPL *session;
 
 	WT_LSM_UPDATE_ENTER(clsm, cursor, session, update);
 	WT_CURSOR_NEEDKEY(cursor);
 	WT_LSM_NEEDVALUE(cursor);
 
-	if (F_ISSET(cursor, WT_CURSTD_OVERWRITE) ||
-	    (ret = __clsm_search(cursor)) == 0)
-		ret = __clsm_put(session, clsm, &cursor->key, &cursor->value);
+	/* Searching for the key replaces the value: restore it. */
+	if (!F_ISSET(cursor, WT_CURSTD_OVERWRITE)) {
+		value = cursor->value;
+		ret = __clsm_search(cursor);
+		cursor->value = value;
+		WT_ERR(ret);
+	}
+
+	ret = __clsm_put(session, clsm, &cursor->key, &cursor->value);
 
 err:	CURSOR_UPDATE_API_END(session, ret);
 	return (ret);
@@ -982,6 +998,8 @@ __wt_clsm_open(WT_SESSION_IMPL *session,
 	    __clsm_insert,		/* insert */
 	    __clsm_update,		/* update */
 	    __clsm_remove,		/* remove */
+	    NULL,			/* search-batch */
+	    NULL,			/* insert-batch */
 	    __clsm_close);		/* close */
 	WT_CONFIG_ITEM cval;
 	WT_CURSOR *cursor;
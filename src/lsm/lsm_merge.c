@@ -9,13 +9,13 @@
 
 /*
  * __wt_lsm_merge_update_tree --
- *	Merge a set of chunks and populate a new one.
+ *	Replace a set of chunks with the new chunks they were merged into.
  *	Must be called with the LSM lock held.
  */
 int
 __wt_lsm_merge_update_tree(WT_SESSION_IMPL *session,
     WT_LSM_TREE *lsm_tree, u_int start_chunk, u_int nchunks,
-    WT_LSM_CHUNK *chunk)
+    WT_LSM_CHUNK **chunks, u_int nnew)
 {
 	size_t chunk_sz, chunks_after_merge;
 	u_int i, j;
@@ -46,43 +46,458 @@ __wt_lsm_merge_update_tree(WT_SESSION_IMPL *session,
 	WT_ASSERT(session, j == nchunks);
 
 	/* Update the current chunk list. */
+	chunk_sz = sizeof(*lsm_tree->chunk);
+	if ((lsm_tree->nchunks - nchunks + nnew) * chunk_sz >
+	    lsm_tree->chunk_alloc)
+		WT_RET(__wt_realloc(session, &lsm_tree->chunk_alloc,
+		    WT_MAX(10 * chunk_sz, 2 * lsm_tree->chunk_alloc),
+		    &lsm_tree->chunk));
 	chunks_after_merge = lsm_tree->nchunks - (nchunks + start_chunk);
-	memmove(lsm_tree->chunk + start_chunk + 1,
+	memmove(lsm_tree->chunk + start_chunk + nnew,
 	    lsm_tree->chunk + start_chunk + nchunks,
-	    chunks_after_merge * sizeof(*lsm_tree->chunk));
-	lsm_tree->nchunks -= nchunks - 1;
-	memset(lsm_tree->chunk + lsm_tree->nchunks, 0,
-	    (nchunks - 1) * sizeof(*lsm_tree->chunk));
-	lsm_tree->chunk[start_chunk] = chunk;
+	    chunks_after_merge * chunk_sz);
+	if (nchunks > nnew)
+		memset(lsm_tree->chunk + lsm_tree->nchunks - (nchunks - nnew),
+		    0, (nchunks - nnew) * chunk_sz);
+	lsm_tree->nchunks = lsm_tree->nchunks - nchunks + nnew;
+	memcpy(lsm_tree->chunk + start_chunk, chunks, nnew * chunk_sz);
 	lsm_tree->dsk_gen++;
 
 	return (0);
 }
 
 /*
- * __wt_lsm_merge --
- *	Merge a set of chunks of an LSM tree.
+ * __wt_lsm_merge_policy_config --
+ *	Return the merge policy for an "lsm_merge_policy" configuration value.
  */
-int
-__wt_lsm_merge(
-    WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree, u_int id, int stalls)
+uint32_t
+__wt_lsm_merge_policy_config(WT_CONFIG_ITEM *cval)
+{
+	return (WT_STRING_MATCH("leveled", cval->str, cval->len) ?
+	    WT_LSM_MERGE_LEVELED :
+	    WT_STRING_MATCH("tiered", cval->str, cval->len) ?
+	    WT_LSM_MERGE_TIERED : WT_LSM_MERGE_DEFAULT);
+}
+
+/*
+ * __lsm_merge_level --
+ *	Return the first chunk of the level holding a chunk: the partitions of
+ * a merge are a single level, merged together.
+ */
+static u_int
+__lsm_merge_level(WT_LSM_TREE *lsm_tree, u_int i)
+{
+	while (i > 0 && F_ISSET(lsm_tree->chunk[i], WT_LSM_CHUNK_PARTITION))
+		--i;
+	return (i);
+}
+
+/*
+ * __lsm_merge_leveled --
+ *	Choose chunks to merge for the leveled policy: each level should be at
+ * least lsm_merge_ratio times larger than all newer levels together.  Find
+ * the oldest level where that isn't so, and merge it with the newer levels.
+ * The number of levels is logarithmic in the size of the tree, at the cost of
+ * rewriting records more often.
+ */
+static void
+__lsm_merge_leveled(
+    WT_LSM_TREE *lsm_tree, u_int max_chunks, u_int *startp, u_int *endp)
+{
+	uint64_t count, newer;
+	u_int end_chunk, i, j, level;
+
+	end_chunk = *endp;
+	*startp = end_chunk + 1;
+	for (i = end_chunk + 1, newer = 0; i > 0; i = level) {
+		level = __lsm_merge_level(lsm_tree, i - 1);
+		for (count = 0, j = level; j < i; j++) {
+			if (F_ISSET(lsm_tree->chunk[j], WT_LSM_CHUNK_MERGING))
+				break;
+			count += lsm_tree->chunk[j]->count;
+		}
+		if (j < i)
+			break;
+		if (i <= end_chunk && newer * lsm_tree->merge_ratio > count)
+			*startp = level;
+		newer += count;
+	}
+	if (*startp <= end_chunk)
+		*endp = WT_MIN(end_chunk, *startp + max_chunks - 1);
+}
+
+/*
+ * __lsm_merge_tiered --
+ *	Choose chunks to merge for the tiered policy: once lsm_merge_ratio
+ * adjacent levels have the same generation, merge them into a level of the
+ * next generation.  Each merge rewrites a record into a level lsm_merge_ratio
+ * times larger, so records are rewritten a logarithmic number of times, at the
+ * cost of searching more chunks.
+ */
+static void
+__lsm_merge_tiered(
+    WT_LSM_TREE *lsm_tree, u_int max_chunks, u_int *startp, u_int *endp)
+{
+	WT_LSM_CHUNK *chunk;
+	uint32_t generation;
+	u_int i, j, nlevels, run_end, run_start;
+
+	/* Find the newest run of levels of the same generation to merge. */
+	for (i = *endp + 1; i > 0; i = run_start) {
+		run_end = i - 1;
+		generation = lsm_tree->chunk[run_end]->generation;
+		for (run_start = run_end; run_start > 0; --run_start) {
+			chunk = lsm_tree->chunk[run_start - 1];
+			if (F_ISSET(chunk, WT_LSM_CHUNK_MERGING) ||
+			    chunk->generation != generation)
+				break;
+		}
+		for (nlevels = 0, j = run_start; j <= run_end; j++)
+			if (!F_ISSET(lsm_tree->chunk[j], WT_LSM_CHUNK_PARTITION))
+				++nlevels;
+		if (nlevels >= lsm_tree->merge_ratio) {
+			/* Merge the oldest levels of the run. */
+			for (nlevels = 0, j = run_start; j <= run_end; j++)
+				if (!F_ISSET(lsm_tree->chunk[j],
+				    WT_LSM_CHUNK_PARTITION) &&
+				    ++nlevels > lsm_tree->merge_ratio)
+					break;
+			*startp = run_start;
+			*endp = WT_MIN(j, run_start + max_chunks) - 1;
+			return;
+		}
+		if (run_start > 0 && F_ISSET(
+		    lsm_tree->chunk[run_start - 1], WT_LSM_CHUNK_MERGING))
+			break;
+	}
+	*startp = *endp + 1;
+}
+
+/*
+ * __lsm_merge_split --
+ *	Choose keys splitting a merge into partitions of similar size, from a
+ * sorted sample of random keys in the chunks being merged, in proportion to
+ * their sizes.  Returns fewer partitions than requested if there are too few
+ * distinct keys.
+ */
+static int
+__lsm_merge_split(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree,
+    WT_LSM_CHUNK **chunks, u_int nchunks, uint64_t record_count,
+    WT_ITEM *splits, u_int *npartsp)
+{
+	WT_CURSOR *cursor;
+	WT_DECL_RET;
+	WT_ITEM key, *samples, tmp;
+	uint64_t want;
+	u_int c, i, j, n, nparts, nsamples;
+	int cmp;
+	const char *cfg[3];
+
+	cursor = NULL;
+	nparts = *npartsp;
+	nsamples = nparts * WT_LSM_PARTITION_SAMPLES + nchunks;
+	WT_RET(__wt_calloc_def(session, nsamples, &samples));
+
+	cfg[0] = WT_CONFIG_BASE(session, session_open_cursor);
+	cfg[1] = "checkpoint=WiredTigerCheckpoint,next_random,raw";
+	cfg[2] = NULL;
+	for (c = n = 0; c < nchunks; c++) {
+		want = 1 + nparts * WT_LSM_PARTITION_SAMPLES *
+		    chunks[c]->count / WT_MAX(record_count, 1);
+		WT_ERR(__wt_open_cursor(
+		    session, chunks[c]->uri, NULL, cfg, &cursor));
+		for (; want > 0 && n < nsamples &&
+		    (ret = cursor->next(cursor)) == 0; --want, n++) {
+			WT_ERR(cursor->get_key(cursor, &key));
+			WT_ERR(__wt_buf_set(
+			    session, &samples[n], key.data, key.size));
+		}
+		WT_ERR_NOTFOUND_OK(ret);
+		ret = cursor->close(cursor);
+		cursor = NULL;
+		WT_ERR(ret);
+	}
+
+	/*
+	 * Sort the sample: keys are compared with the tree's collator, and
+	 * there are at most a few thousand of them, an insertion sort will do.
+	 */
+	for (i = 1; i < n; i++)
+		for (j = i; j > 0; --j) {
+			WT_ERR(WT_LSM_CMP(session,
+			    lsm_tree, &samples[j - 1], &samples[j], cmp));
+			if (cmp <= 0)
+				break;
+			tmp = samples[j - 1];
+			samples[j - 1] = samples[j];
+			samples[j] = tmp;
+		}
+
+	/* Split at evenly spaced keys in the sample, skipping duplicates. */
+	for (i = 1, j = 0; n > 0 && i < nparts; i++) {
+		key = samples[i * n / nparts];
+		if (j > 0) {
+			WT_ERR(WT_LSM_CMP(
+			    session, lsm_tree, &splits[j - 1], &key, cmp));
+			if (cmp >= 0)
+				continue;
+		}
+		WT_ERR(__wt_buf_set(session, &splits[j++], key.data, key.size));
+	}
+	*npartsp = j + 1;
+
+err:	if (cursor != NULL)
+		WT_TRET(cursor->close(cursor));
+	for (i = 0; i < nsamples; i++)
+		__wt_buf_free(session, &samples[i]);
+	__wt_free(session, samples);
+	return (ret);
+}
+
+/*
+ * __lsm_merge_build --
+ *	Merge the records in a partition's key range into a new chunk.
+ */
+static int
+__lsm_merge_build(WT_SESSION_IMPL *session, WT_LSM_MERGE_PART *part)
 {
 	WT_BLOOM *bloom;
 	WT_CURSOR *src, *dest;
-	WT_DECL_ITEM(bbuf);
 	WT_DECL_RET;
 	WT_ITEM buf, key, value;
-	WT_LSM_CHUNK *chunk, *youngest;
-	uint32_t generation, start_id;
-	uint64_t insert_count, record_count, r;
-	u_int dest_id, end_chunk, i, max_chunks, nchunks, start_chunk;
-	int create_bloom;
+	WT_LSM_CHUNK *chunk;
+	WT_LSM_TREE *lsm_tree;
+	uint64_t insert_count, r;
+	int cmp;
 	const char *cfg[3];
 
+	lsm_tree = part->lsm_tree;
 	src = dest = NULL;
 	bloom = NULL;
+
+	WT_RET(__wt_calloc_def(session, 1, &chunk));
+	chunk->id = WT_ATOMIC_ADD(lsm_tree->last, 1);
+	part->chunk = chunk;
+
+	/*
+	 * Special setup for the merge cursor:
+	 * first, reset to open the dependent cursors;
+	 * then restrict the cursor to a specific number of chunks;
+	 * then set MERGE so the cursor doesn't track updates to the tree.
+	 */
+	WT_ERR(__wt_open_cursor(session, lsm_tree->name, NULL, NULL, &src));
+	F_SET(src, WT_CURSTD_RAW);
+	WT_ERR(__wt_clsm_init_merge(
+	    src, part->start_chunk, part->start_id, part->nchunks));
+
+	WT_WITH_SCHEMA_LOCK(session, ret = __wt_lsm_tree_setup_chunk(
+	    session, lsm_tree, chunk));
+	WT_ERR(ret);
+	if (part->create_bloom) {
+		WT_CLEAR(buf);
+		WT_ERR(__wt_lsm_tree_bloom_name(
+		    session, lsm_tree, chunk->id, &buf));
+		chunk->bloom_uri = __wt_buf_steal(session, &buf, NULL);
+
+		WT_ERR(__wt_bloom_create(session, chunk->bloom_uri,
+		    lsm_tree->bloom_config,
+		    part->record_count, lsm_tree->bloom_bit_count,
+		    lsm_tree->bloom_hash_count, &bloom));
+	}
+
+	/* Discard pages we read as soon as we're done with them. */
+	F_SET(session, WT_SESSION_NO_CACHE);
+
+	cfg[0] = WT_CONFIG_BASE(session, session_open_cursor);
+	cfg[1] = "bulk,raw";
+	cfg[2] = NULL;
+	WT_ERR(__wt_open_cursor(session, chunk->uri, NULL, cfg, &dest));
+
+	/*
+	 * Iterating with a key set starts after the key, which is where the
+	 * partition's range starts.
+	 */
+	if (part->lower != NULL)
+		src->set_key(src, part->lower);
+	for (insert_count = 0; (ret = src->next(src)) == 0; insert_count++) {
+		if (insert_count % 1000 &&
+		    !F_ISSET(lsm_tree, WT_LSM_TREE_WORKING)) {
+			ret = EINTR;
+			goto err;
+		}
+		WT_ERR(src->get_key(src, &key));
+		if (part->upper != NULL) {
+			WT_ERR(WT_LSM_CMP(
+			    session, lsm_tree, &key, part->upper, cmp));
+			if (cmp > 0)
+				break;
+		}
+		dest->set_key(dest, &key);
+		WT_ERR(src->get_value(src, &value));
+		dest->set_value(dest, &value);
+		WT_ERR(dest->insert(dest));
+		if (part->create_bloom)
+			WT_ERR(__wt_bloom_insert(bloom, &key));
+	}
+	WT_ERR_NOTFOUND_OK(ret);
+	part->insert_count = insert_count;
+
+	WT_CSTAT_INCRV(session, lsm_rows_merged, insert_count);
+	WT_VERBOSE_ERR(session, lsm,
+	    "Bloom size for %" PRIu64 " has %" PRIu64 " items inserted.",
+	    part->record_count, insert_count);
+
+	/* We've successfully created the new chunk. */
+	WT_TRET(src->close(src));
+	WT_TRET(dest->close(dest));
+	src = dest = NULL;
+
+	if (part->create_bloom) {
+		WT_TRET(__wt_bloom_finalize(bloom));
+
+		/*
+		 * Keep the filter in memory for lookups, which also makes sure
+		 * the Bloom filter's btree handle is open before it becomes
+		 * visible to application threads.  Otherwise application
+		 * threads will stall while it is opened.
+		 */
+		if (ret == 0)
+			WT_TRET(__wt_bloom_load(bloom, &chunk->bloom_bits));
+
+		WT_TRET(__wt_bloom_close(bloom));
+		bloom = NULL;
+	}
+	F_CLR(session, WT_SESSION_NO_CACHE);
+	WT_ERR(ret);
+
+	/*
+	 * Fault in some pages.  We use a random cursor to jump around in the
+	 * tree.  The count here is fairly arbitrary: what we want is to have
+	 * enough internal pages in cache so that application threads don't
+	 * stall and block each other reading them in.
+	 */
+	cfg[1] = "checkpoint=WiredTigerCheckpoint,next_random";
+	WT_ERR(__wt_open_cursor(session, chunk->uri, NULL, cfg, &dest));
+	for (r = 0; ret == 0 && r < 100 + (insert_count >> 16); r++)
+		WT_TRET(dest->next(dest));
+	WT_TRET(dest->close(dest));
+	dest = NULL;
+	WT_ERR_NOTFOUND_OK(ret);
+
+err:	if (src != NULL)
+		WT_TRET(src->close(src));
+	if (dest != NULL)
+		WT_TRET(dest->close(dest));
+	if (bloom != NULL)
+		WT_TRET(__wt_bloom_close(bloom));
+	F_CLR(session, WT_SESSION_NO_CACHE);
+	return (ret);
+}
+
+/*
+ * __lsm_merge_helper --
+ *	A merge helper thread: build one partition of a merge.
+ */
+static void *
+__lsm_merge_helper(void *arg)
+{
+	WT_LSM_MERGE_PART *part;
+
+	part = arg;
+	part->ret = __lsm_merge_build(part->session, part);
+	return (NULL);
+}
+
+/*
+ * __lsm_merge_helper_start --
+ *	Start a helper thread to build a partition of a merge.  Helpers use
+ * session slots reserved for them when the connection is opened: if none are
+ * free, return without a helper, the caller builds the partition itself.
+ */
+static int
+__lsm_merge_helper_start(WT_SESSION_IMPL *session, WT_LSM_MERGE_PART *part)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+	WT_SESSION_IMPL *s;
+	int helper;
+
+	conn = S2C(session);
+
+	__wt_spin_lock(session, &conn->lsm_lock);
+	if ((helper = conn->lsm_helpers < conn->lsm_workers) != 0)
+		++conn->lsm_helpers;
+	__wt_spin_unlock(session, &conn->lsm_lock);
+	if (!helper)
+		return (0);
+
+	WT_ERR(__wt_open_session(conn, 1, NULL, NULL, &s));
+	s->name = "lsm-merge-helper";
+	part->session = s;
+	if ((ret = __wt_thread_create(session,
+	    &part->tid, __lsm_merge_helper, part)) != 0) {
+		part->session = NULL;
+		WT_TRET(s->iface.close(&s->iface, NULL));
+		__wt_free(session, s->hazard);
+		goto err;
+	}
+	return (0);
+
+err:	__wt_spin_lock(session, &conn->lsm_lock);
+	--conn->lsm_helpers;
+	__wt_spin_unlock(session, &conn->lsm_lock);
+	return (ret);
+}
+
+/*
+ * __lsm_merge_helper_stop --
+ *	Wait for a merge helper thread to finish, and close its session.
+ */
+static int
+__lsm_merge_helper_stop(WT_SESSION_IMPL *session, WT_LSM_MERGE_PART *part)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+
+	conn = S2C(session);
+
+	WT_TRET(__wt_thread_join(session, part->tid));
+	WT_TRET(part->ret);
+	WT_TRET(part->session->iface.close(&part->session->iface, NULL));
+	__wt_free(session, part->session->hazard);
+	part->session = NULL;
+
+	__wt_spin_lock(session, &conn->lsm_lock);
+	--conn->lsm_helpers;
+	__wt_spin_unlock(session, &conn->lsm_lock);
+	return (ret);
+}
+
+/*
+ * __wt_lsm_merge --
+ *	Merge a set of chunks of an LSM tree.
+ */
+int
+__wt_lsm_merge(
+    WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree, u_int id, int stalls)
+{
+	WT_DECL_RET;
+	WT_ITEM *splits;
+	WT_LSM_CHUNK **chunks, *chunk, *youngest;
+	WT_LSM_MERGE_PART *part, *parts;
+	uint32_t generation, start_id;
+	uint64_t record_count;
+	u_int end_chunk, i, max_chunks, nchunks, nlevels, nparts, nsplits;
+	u_int start_chunk;
+	int create_bloom, installed;
+
+	splits = NULL;
+	chunks = NULL;
+	parts = NULL;
 	max_chunks = lsm_tree->merge_max;
-	create_bloom = 0;
+	nparts = nsplits = 0;
+	start_id = 0;
+	create_bloom = installed = 0;
 
 	/*
 	 * If there aren't any chunks to merge, or some of the chunks aren't
@@ -93,12 +508,18 @@ __wt_lsm_merge(
 	if (lsm_tree->nchunks <= 1)
 		return (WT_NOTFOUND);
 
+	/*
+	 * The array of chunks holds the chunks being merged, then the chunks
+	 * they are merged into.  Allocate it before locking the tree.
+	 */
+	WT_RET(__wt_calloc_def(session, max_chunks, &chunks));
+
 	/*
 	 * Use the lsm_tree lock to read the chunks (so no switches occur), but
 	 * avoid holding it while the merge is in progress: that may take a
 	 * long time.
 	 */
-	WT_RET(__wt_writelock(session, lsm_tree->rwlock));
+	WT_ERR(__wt_writelock(session, lsm_tree->rwlock));
 
 	/*
 	 * Only include chunks that are stable on disk and not involved in a
@@ -123,8 +544,11 @@ __wt_lsm_merge(
 	 * Respect the configured limit on the number of chunks to merge: start
 	 * with the most recent set of chunks and work backwards until going
 	 * further becomes significantly less efficient.
+	 *
+	 * This is the default merge policy.
 	 */
 	for (start_chunk = end_chunk + 1, record_count = 0;
+	    lsm_tree->merge_policy == WT_LSM_MERGE_DEFAULT &&
 	    start_chunk > 0; ) {
 		chunk = lsm_tree->chunk[start_chunk - 1];
 		youngest = lsm_tree->chunk[end_chunk];
@@ -166,134 +590,136 @@ __wt_lsm_merge(
 		}
 	}
 
+	/*
+	 * The leveled and tiered policies choose the chunks directly, then
+	 * mark them as being merged.
+	 */
+	if (lsm_tree->merge_policy != WT_LSM_MERGE_DEFAULT) {
+		if (lsm_tree->merge_policy == WT_LSM_MERGE_LEVELED)
+			__lsm_merge_leveled(
+			    lsm_tree, max_chunks, &start_chunk, &end_chunk);
+		else
+			__lsm_merge_tiered(
+			    lsm_tree, max_chunks, &start_chunk, &end_chunk);
+		for (record_count = 0, i = start_chunk; i <= end_chunk; i++) {
+			chunk = lsm_tree->chunk[i];
+			F_SET(chunk, WT_LSM_CHUNK_MERGING);
+			record_count += chunk->count;
+		}
+	}
+
+	/*
+	 * The partitions of an earlier merge are merged together: don't start
+	 * or end a merge part way through them.
+	 */
+	for (; start_chunk <= end_chunk && F_ISSET(
+	    lsm_tree->chunk[start_chunk], WT_LSM_CHUNK_PARTITION); ++start_chunk)
+		F_CLR(lsm_tree->chunk[start_chunk], WT_LSM_CHUNK_MERGING);
+	for (; end_chunk > start_chunk && end_chunk + 1 < lsm_tree->nchunks &&
+	    F_ISSET(lsm_tree->chunk[end_chunk + 1], WT_LSM_CHUNK_PARTITION);
+	    --end_chunk)
+		F_CLR(lsm_tree->chunk[end_chunk], WT_LSM_CHUNK_MERGING);
+
 	nchunks = (end_chunk - start_chunk) + 1;
 	WT_ASSERT(session, nchunks <= max_chunks);
+	for (nlevels = 0, i = start_chunk; i <= end_chunk; i++)
+		if (!F_ISSET(lsm_tree->chunk[i], WT_LSM_CHUNK_PARTITION))
+			++nlevels;
 
 	/* Don't do small merges. */
-	if (nchunks <= 1 || (id == 0 && nchunks < max_chunks / 2)) {
+	if (nlevels <= 1 || (id == 0 && nchunks < max_chunks / 2 &&
+	    lsm_tree->merge_policy == WT_LSM_MERGE_DEFAULT)) {
 		for (i = 0; i < nchunks; i++)
 			F_CLR(lsm_tree->chunk[start_chunk + i],
 			    WT_LSM_CHUNK_MERGING);
 		nchunks = 0;
 	}
 
-	/* Find the merge generation. */
-	for (generation = 0, i = 0; i < nchunks; i++)
-		generation = WT_MAX(generation,
-		    lsm_tree->chunk[start_chunk + i]->generation + 1);
+	/*
+	 * Find the merge generation, and remember the chunks being merged:
+	 * they can't be dropped until the merge completes.
+	 */
+	for (generation = 0, i = 0; i < nchunks; i++) {
+		chunk = chunks[i] = lsm_tree->chunk[start_chunk + i];
+		generation = WT_MAX(generation, chunk->generation + 1);
+	}
 
-	start_id = lsm_tree->chunk[start_chunk]->id;
-	WT_RET(__wt_rwunlock(session, lsm_tree->rwlock));
+	if (nchunks > 0)
+		start_id = lsm_tree->chunk[start_chunk]->id;
+	WT_ERR(__wt_rwunlock(session, lsm_tree->rwlock));
 
-	if (nchunks == 0)
+	if (nchunks == 0) {
+		__wt_free(session, chunks);
 		return (WT_NOTFOUND);
+	}
 
-	/* Allocate an ID for the merge. */
-	dest_id = WT_ATOMIC_ADD(lsm_tree->last, 1);
+	/*
+	 * Split large merges into key ranges built in parallel.  Each range
+	 * is written to a separate chunk, so limit the number of ranges to
+	 * make sure the merge at least halves the number of chunks.
+	 */
+	nparts = WT_MIN(lsm_tree->merge_partitions, nchunks / 2);
+	nparts = (u_int)WT_MIN(nparts, record_count / WT_LSM_PARTITION_MIN);
+	if (nparts > 1) {
+		nsplits = nparts - 1;
+		WT_ERR(__wt_calloc_def(session, nsplits, &splits));
+		WT_ERR(__lsm_merge_split(session, lsm_tree,
+		    chunks, nchunks, record_count, splits, &nparts));
+	}
+	if (nparts == 0)
+		nparts = 1;
 
-	WT_VERBOSE_RET(session, lsm,
-	    "Merging chunks %d-%d into %d (%" PRIu64 " records)"
+	WT_VERBOSE_ERR(session, lsm,
+	    "Merging chunks %d-%d into %d partitions (%" PRIu64 " records)"
 	    ", generation %d\n",
-	    start_chunk, end_chunk, dest_id, record_count, generation);
-
-	WT_RET(__wt_calloc_def(session, 1, &chunk));
-	chunk->id = dest_id;
+	    start_chunk, end_chunk, nparts, record_count, generation);
 
 	if (FLD_ISSET(lsm_tree->bloom, WT_LSM_BLOOM_MERGED) &&
 	    (FLD_ISSET(lsm_tree->bloom, WT_LSM_BLOOM_OLDEST) ||
 	    start_chunk > 0) && record_count > 0)
 		create_bloom = 1;
 
+	WT_ERR(__wt_calloc_def(session, nparts, &parts));
+	for (i = 0; i < nparts; i++) {
+		part = &parts[i];
+		part->lsm_tree = lsm_tree;
+		part->start_chunk = start_chunk;
+		part->nchunks = nchunks;
+		part->start_id = start_id;
+		part->record_count = record_count / nparts;
+		part->create_bloom = create_bloom;
+		part->lower = i == 0 ? NULL : &splits[i - 1];
+		part->upper = i == nparts - 1 ? NULL : &splits[i];
+	}
+
 	/*
-	 * Special setup for the merge cursor:
-	 * first, reset to open the dependent cursors;
-	 * then restrict the cursor to a specific number of chunks;
-	 * then set MERGE so the cursor doesn't track updates to the tree.
+	 * Start helper threads for all but the first partition, build the
+	 * first partition and any partition without a helper in this thread,
+	 * then wait for the helpers.
 	 */
-	WT_ERR(__wt_open_cursor(session, lsm_tree->name, NULL, NULL, &src));
-	F_SET(src, WT_CURSTD_RAW);
-	WT_ERR(__wt_clsm_init_merge(src, start_chunk, start_id, nchunks));
-
-	WT_WITH_SCHEMA_LOCK(session, ret = __wt_lsm_tree_setup_chunk(
-	    session, lsm_tree, chunk));
+	for (i = 1; i < nparts && ret == 0; i++)
+		ret = __lsm_merge_helper_start(session, &parts[i]);
+	for (i = 0; i < nparts && ret == 0; i++)
+		if (parts[i].session == NULL)
+			ret = __lsm_merge_build(session, &parts[i]);
+	for (i = 1; i < nparts; i++)
+		if (parts[i].session != NULL)
+			WT_TRET(__lsm_merge_helper_stop(session, &parts[i]));
 	WT_ERR(ret);
-	if (create_bloom) {
-		WT_CLEAR(buf);
-		WT_ERR(__wt_lsm_tree_bloom_name(
-		    session, lsm_tree, chunk->id, &buf));
-		chunk->bloom_uri = __wt_buf_steal(session, &buf, NULL);
-
-		WT_ERR(__wt_bloom_create(session, chunk->bloom_uri,
-		    lsm_tree->bloom_config,
-		    record_count, lsm_tree->bloom_bit_count,
-		    lsm_tree->bloom_hash_count, &bloom));
-	}
+	if (nparts > 1)
+		WT_CSTAT_INCRV(session, lsm_partitions_built, nparts);
 
-	/* Discard pages we read as soon as we're done with them. */
-	F_SET(session, WT_SESSION_NO_CACHE);
-
-	cfg[0] = WT_CONFIG_BASE(session, session_open_cursor);
-	cfg[1] = "bulk,raw";
-	cfg[2] = NULL;
-	WT_ERR(__wt_open_cursor(session, chunk->uri, NULL, cfg, &dest));
-
-	for (insert_count = 0; (ret = src->next(src)) == 0; insert_count++) {
-		if (insert_count % 1000 &&
-		    !F_ISSET(lsm_tree, WT_LSM_TREE_WORKING)) {
-			ret = EINTR;
-			goto err;
-		}
-		WT_ERR(src->get_key(src, &key));
-		dest->set_key(dest, &key);
-		WT_ERR(src->get_value(src, &value));
-		dest->set_value(dest, &value);
-		WT_ERR(dest->insert(dest));
+	/* We've successfully created the new chunks.  Now install them. */
+	for (i = 0; i < nparts; i++) {
+		chunk = chunks[i] = parts[i].chunk;
 		if (create_bloom)
-			WT_ERR(__wt_bloom_insert(bloom, &key));
-	}
-	WT_ERR_NOTFOUND_OK(ret);
-
-	WT_CSTAT_INCRV(session, lsm_rows_merged, insert_count);
-	WT_VERBOSE_ERR(session, lsm,
-	    "Bloom size for %" PRIu64 " has %" PRIu64 " items inserted.",
-	    record_count, insert_count);
-
-	/* We've successfully created the new chunk.  Now install it. */
-	WT_TRET(src->close(src));
-	WT_TRET(dest->close(dest));
-	src = dest = NULL;
-
-	if (create_bloom) {
-		WT_TRET(__wt_bloom_finalize(bloom));
-
-		/*
-		 * Read in a key to make sure the Bloom filters btree handle is
-		 * open before it becomes visible to application threads.
-		 * Otherwise application threads will stall while it is opened
-		 * and internal pages are read into cache.
-		 */
-		WT_CLEAR(key);
-		WT_TRET_NOTFOUND_OK(__wt_bloom_get(bloom, &key));
-
-		WT_TRET(__wt_bloom_close(bloom));
-		bloom = NULL;
+			F_SET(chunk, WT_LSM_CHUNK_BLOOM);
+		chunk->count = parts[i].insert_count;
+		chunk->generation = generation;
+		F_SET(chunk, WT_LSM_CHUNK_ONDISK);
+		if (i > 0)
+			F_SET(chunk, WT_LSM_CHUNK_PARTITION);
 	}
-	F_CLR(session, WT_SESSION_NO_CACHE);
-	WT_ERR(ret);
-
-	/*
-	 * Fault in some pages.  We use a random cursor to jump around in the
-	 * tree.  The count here is fairly arbitrary: what we want is to have
-	 * enough internal pages in cache so that application threads don't
-	 * stall and block each other reading them in.
-	 */
-	cfg[1] = "checkpoint=WiredTigerCheckpoint,next_random";
-	WT_ERR(__wt_open_cursor(session, chunk->uri, NULL, cfg, &dest));
-	for (r = 0; ret == 0 && r < 100 + (insert_count >> 16); r++)
-		WT_TRET(dest->next(dest));
-	WT_TRET(dest->close(dest));
-	dest = NULL;
-	WT_ERR_NOTFOUND_OK(ret);
 
 	WT_ERR(__wt_writelock(session, lsm_tree->rwlock));
 
@@ -309,37 +735,30 @@ __wt_lsm_merge(
 			if (lsm_tree->chunk[start_chunk]->id == start_id)
 				break;
 
-	ret = __wt_lsm_merge_update_tree(
-	    session, lsm_tree, start_chunk, nchunks, chunk);
-
-	if (create_bloom)
-		F_SET(chunk, WT_LSM_CHUNK_BLOOM);
-	chunk->count = insert_count;
-	chunk->generation = generation;
-	F_SET(chunk, WT_LSM_CHUNK_ONDISK);
-
-	ret = __wt_lsm_meta_write(session, lsm_tree);
+	if ((ret = __wt_lsm_merge_update_tree(session,
+	    lsm_tree, start_chunk, nchunks, chunks, nparts)) == 0) {
+		installed = 1;
+		ret = __wt_lsm_meta_write(session, lsm_tree);
+	}
 	WT_TRET(__wt_rwunlock(session, lsm_tree->rwlock));
 
-err:	if (src != NULL)
-		WT_TRET(src->close(src));
-	if (dest != NULL)
-		WT_TRET(dest->close(dest));
-	if (bloom != NULL)
-		WT_TRET(__wt_bloom_close(bloom));
-	__wt_scr_free(&bbuf);
-	if (ret != 0) {
+err:	if (ret != 0) {
 		/*
-		 * Ideally we would drop the new chunk on error, but that
+		 * Ideally we would drop the new chunks on error, but that
 		 * introduces potential deadlock problems. It is relatively
-		 * harmless to leave the file - it does not interfere
+		 * harmless to leave the files - they do not interfere
 		 * with later re-use.
 		WT_WITH_SCHEMA_LOCK(session,
 		    (void)__wt_schema_drop(session, chunk->uri, NULL));
 		 */
-		__wt_free(session, chunk->bloom_uri);
-		__wt_free(session, chunk->uri);
-		__wt_free(session, chunk);
+		for (i = 0; !installed && parts != NULL && i < nparts; i++) {
+			if ((chunk = parts[i].chunk) == NULL)
+				continue;
+			__wt_free(session, chunk->bloom_bits);
+			__wt_free(session, chunk->bloom_uri);
+			__wt_free(session, chunk->uri);
+			__wt_free(session, chunk);
+		}
 
 		if (ret == EINTR)
 			WT_VERBOSE_TRET(session, lsm,
@@ -347,7 +766,11 @@ err:	if (src != NULL)
 		else
 			WT_VERBOSE_TRET(session, lsm,
 			    "Merge failed with %s", wiredtiger_strerror(ret));
-		F_CLR(session, WT_SESSION_NO_CACHE);
 	}
+	for (i = 0; i < nsplits; i++)
+		__wt_buf_free(session, &splits[i]);
+	__wt_free(session, splits);
+	__wt_free(session, parts);
+	__wt_free(session, chunks);
 	return (ret);
 }
@@ -65,6 +65,14 @@ __wt_lsm_meta_read(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree)
 			lsm_tree->chunk_size = (uint32_t)cv.val;
 		else if (WT_STRING_MATCH("lsm_merge_max", ck.str, ck.len))
 			lsm_tree->merge_max = (uint32_t)cv.val;
+		else if (WT_STRING_MATCH(
+		    "lsm_merge_partitions", ck.str, ck.len))
+			lsm_tree->merge_partitions = (u_int)cv.val;
+		else if (WT_STRING_MATCH("lsm_merge_policy", ck.str, ck.len))
+			lsm_tree->merge_policy =
+			    __wt_lsm_merge_policy_config(&cv);
+		else if (WT_STRING_MATCH("lsm_merge_ratio", ck.str, ck.len))
+			lsm_tree->merge_ratio = (uint32_t)cv.val;
 		else if (WT_STRING_MATCH("lsm_merge_threads", ck.str, ck.len))
 			lsm_tree->merge_threads = (uint32_t)cv.val;
 		else if (WT_STRING_MATCH("last", ck.str, ck.len))
@@ -100,6 +108,10 @@ __wt_lsm_meta_read(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree)
 					    __wt_buf_steal(session, &buf, NULL);
 					F_SET(chunk, WT_LSM_CHUNK_BLOOM);
 					continue;
+				} else if (WT_STRING_MATCH(
+				    "partition", lk.str, lk.len)) {
+					F_SET(chunk, WT_LSM_CHUNK_PARTITION);
+					continue;
 				} else if (WT_STRING_MATCH(
 				    "count", lk.str, lk.len)) {
 					chunk->count = (uint64_t)lv.val;
@@ -185,6 +197,14 @@ __wt_lsm_meta_write(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree)
 	    F_ISSET(lsm_tree, WT_LSM_TREE_THROTTLE) ? 1 : 0,
 	    lsm_tree->merge_max, lsm_tree->merge_threads, lsm_tree->bloom,
 	    lsm_tree->bloom_bit_count, lsm_tree->bloom_hash_count));
+	if (lsm_tree->merge_policy != WT_LSM_MERGE_DEFAULT)
+		WT_ERR(__wt_buf_catfmt(session, buf,
+		    ",lsm_merge_policy=%s,lsm_merge_ratio=%" PRIu32,
+		    lsm_tree->merge_policy == WT_LSM_MERGE_LEVELED ?
+		    "leveled" : "tiered", lsm_tree->merge_ratio));
+	if (lsm_tree->merge_partitions > 1)
+		WT_ERR(__wt_buf_catfmt(session, buf,
+		    ",lsm_merge_partitions=%u", lsm_tree->merge_partitions));
 	WT_ERR(__wt_buf_catfmt(session, buf, ",chunks=["));
 	for (i = 0; i < lsm_tree->nchunks; i++) {
 		chunk = lsm_tree->chunk[i];
@@ -193,6 +213,8 @@ __wt_lsm_meta_write(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree)
 		WT_ERR(__wt_buf_catfmt(session, buf, "id=%" PRIu32, chunk->id));
 		if (F_ISSET(chunk, WT_LSM_CHUNK_BLOOM))
 			WT_ERR(__wt_buf_catfmt(session, buf, ",bloom"));
+		if (F_ISSET(chunk, WT_LSM_CHUNK_PARTITION))
+			WT_ERR(__wt_buf_catfmt(session, buf, ",partition"));
 		if (chunk->count != 0)
 			WT_ERR(__wt_buf_catfmt(
 			    session, buf, ",count=%" PRIu64, chunk->count));
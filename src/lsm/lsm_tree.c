@@ -35,12 +35,12 @@ __lsm_tree_discard(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree)
 	__wt_free(session, lsm_tree->file_config);
 
 	WT_TRET(__wt_rwlock_destroy(session, &lsm_tree->rwlock));
-	WT_TRET(__wt_cond_destroy(session, &lsm_tree->ckpt_cond));
 
 	for (i = 0; i < lsm_tree->nchunks; i++) {
 		if ((chunk = lsm_tree->chunk[i]) == NULL)
 			continue;
 
+		__wt_free(session, chunk->bloom_bits);
 		__wt_free(session, chunk->bloom_uri);
 		__wt_free(session, chunk->uri);
 		__wt_free(session, chunk);
@@ -51,6 +51,7 @@ __lsm_tree_discard(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree)
 		if ((chunk = lsm_tree->old_chunks[i]) == NULL)
 			continue;
 
+		__wt_free(session, chunk->bloom_bits);
 		__wt_free(session, chunk->bloom_uri);
 		__wt_free(session, chunk->uri);
 		__wt_free(session, chunk);
@@ -68,77 +69,13 @@ __lsm_tree_discard(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree)
 static int
 __lsm_tree_close(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree)
 {
-	WT_DECL_RET;
-	WT_SESSION *wt_session;
-	WT_SESSION_IMPL *s;
-	uint32_t i;
-
+	/* Stop queueing work, and wait for work in progress to finish. */
 	if (F_ISSET(lsm_tree, WT_LSM_TREE_WORKING)) {
 		F_CLR(lsm_tree, WT_LSM_TREE_WORKING);
-		if (F_ISSET(S2C(session), WT_CONN_LSM_MERGE))
-			for (i = 0; i < lsm_tree->merge_threads; i++)
-				WT_TRET(__wt_thread_join(
-				    session, lsm_tree->worker_tids[i]));
-		WT_TRET(__wt_thread_join(session, lsm_tree->ckpt_tid));
-		if (FLD_ISSET(lsm_tree->bloom, WT_LSM_BLOOM_NEWEST))
-			WT_TRET(__wt_thread_join(session, lsm_tree->bloom_tid));
-	}
-
-	/*
-	 * Close the worker thread sessions and free their hazard arrays
-	 * (necessary because we set WT_SESSION_INTERNAL to simplify shutdown
-	 * ordering).
-	 *
-	 * Do this in the main thread to avoid deadlocks.
-	 */
-	for (i = 0; i < lsm_tree->merge_threads; i++) {
-		if ((s = lsm_tree->worker_sessions[i]) == NULL)
-			continue;
-		lsm_tree->worker_sessions[i] = NULL;
-		F_SET(s, F_ISSET(session, WT_SESSION_SCHEMA_LOCKED));
-		wt_session = &s->iface;
-		WT_TRET(wt_session->close(wt_session, NULL));
-
-		/*
-		 * This is safe after the close because session handles are
-		 * not freed, but are managed by the connection.
-		 */
-		__wt_free(NULL, s->hazard);
-	}
-
-	if (lsm_tree->bloom_session != NULL) {
-		F_SET(lsm_tree->bloom_session,
-		    F_ISSET(session, WT_SESSION_SCHEMA_LOCKED));
-
-		wt_session = &lsm_tree->bloom_session->iface;
-		WT_TRET(wt_session->close(wt_session, NULL));
-
-		/*
-		 * This is safe after the close because session handles are
-		 * not freed, but are managed by the connection.
-		 */
-		__wt_free(NULL, lsm_tree->bloom_session->hazard);
+		WT_FULL_BARRIER();
+		__wt_lsm_work_cancel(session, lsm_tree);
 	}
-
-	if (lsm_tree->ckpt_session != NULL) {
-		F_SET(lsm_tree->ckpt_session,
-		    F_ISSET(session, WT_SESSION_SCHEMA_LOCKED));
-
-		wt_session = &lsm_tree->ckpt_session->iface;
-		WT_TRET(wt_session->close(wt_session, NULL));
-
-		/*
-		 * This is safe after the close because session handles are
-		 * not freed, but are managed by the connection.
-		 */
-		__wt_free(NULL, lsm_tree->ckpt_session->hazard);
-	}
-	if (ret != 0) {
-		__wt_err(session, ret, "shutdown error while cleaning up LSM");
-		(void)__wt_panic(session);
-	}
-
-	return (ret);
+	return (0);
 }
 
 /*
@@ -156,6 +93,9 @@ __wt_lsm_tree_close_all(WT_SESSION_IMPL *session)
 		WT_TRET(__lsm_tree_discard(session, lsm_tree));
 	}
 
+	/* With the trees closed, shut down the LSM worker threads. */
+	WT_TRET(__wt_lsm_worker_destroy(S2C(session)));
+
 	return (ret);
 }
 
@@ -239,53 +179,30 @@ __wt_lsm_tree_setup_chunk(
 }
 
 /*
- * __wt_lsm_start_worker --
- *	Start the worker thread for an LSM tree.
+ * __lsm_tree_start_worker --
+ *	Start background work on an LSM tree.
  */
 static int
 __lsm_tree_start_worker(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree)
 {
-	WT_CONNECTION *wt_conn;
-	WT_LSM_WORKER_ARGS *wargs;
-	WT_SESSION *wt_session;
-	WT_SESSION_IMPL *s;
 	uint32_t i;
 
-	wt_conn = &S2C(session)->iface;
+	/* The LSM worker threads are shared by all trees. */
+	WT_RET(__wt_lsm_worker_start(session));
 
-	WT_RET(wt_conn->open_session(wt_conn, NULL, NULL, &wt_session));
-	lsm_tree->ckpt_session = (WT_SESSION_IMPL *)wt_session;
-	F_SET(lsm_tree->ckpt_session, WT_SESSION_INTERNAL);
+	for (i = 0; i < WT_LSM_WORK_MAX; i++) {
+		lsm_tree->work[i].lsm_tree = lsm_tree;
+		lsm_tree->work[i].type = i;
+	}
+	WT_RET(__wt_epoch(session, &lsm_tree->merge_ts));
 
 	F_SET(lsm_tree, WT_LSM_TREE_WORKING);
-	/* The new thread will rely on the WORKING value being visible. */
+	/* The worker threads rely on the WORKING value being visible. */
 	WT_FULL_BARRIER();
-	if (F_ISSET(S2C(session), WT_CONN_LSM_MERGE))
-		for (i = 0; i < lsm_tree->merge_threads; i++) {
-			WT_RET(wt_conn->open_session(
-			    wt_conn, NULL, NULL, &wt_session));
-			s = (WT_SESSION_IMPL *)wt_session;
-			F_SET(s, WT_SESSION_INTERNAL);
-			lsm_tree->worker_sessions[i] = s;
-
-			WT_RET(__wt_calloc_def(session, 1, &wargs));
-			wargs->lsm_tree = lsm_tree;
-			wargs->id = i;
-			WT_RET(__wt_thread_create(session,
-			    &lsm_tree->worker_tids[i],
-			    __wt_lsm_merge_worker, wargs));
-		}
-	if (FLD_ISSET(lsm_tree->bloom, WT_LSM_BLOOM_NEWEST)) {
-		WT_RET(wt_conn->open_session(wt_conn, NULL, NULL, &wt_session));
-		lsm_tree->bloom_session = (WT_SESSION_IMPL *)wt_session;
-		F_SET(lsm_tree->bloom_session, WT_SESSION_INTERNAL);
-
-		WT_RET(__wt_thread_create(session,
-		    &lsm_tree->bloom_tid, __wt_lsm_bloom_worker, lsm_tree));
-	}
-	WT_RET(__wt_thread_create(session,
-	    &lsm_tree->ckpt_tid, __wt_lsm_checkpoint_worker, lsm_tree));
 
+	/* Look for work left over from the last time the tree was open. */
+	for (i = 0; i < WT_LSM_WORK_MAX; i++)
+		WT_RET(__wt_lsm_work_queue(session, lsm_tree, i));
 	return (0);
 }
 
@@ -379,6 +296,12 @@ __wt_lsm_tree_create(WT_SESSION_IMPL *session,
 	lsm_tree->chunk_size = (uint32_t)cval.val;
 	WT_ERR(__wt_config_gets(session, cfg, "lsm_merge_max", &cval));
 	lsm_tree->merge_max = (uint32_t)cval.val;
+	WT_ERR(__wt_config_gets(session, cfg, "lsm_merge_partitions", &cval));
+	lsm_tree->merge_partitions = (u_int)cval.val;
+	WT_ERR(__wt_config_gets(session, cfg, "lsm_merge_policy", &cval));
+	lsm_tree->merge_policy = __wt_lsm_merge_policy_config(&cval);
+	WT_ERR(__wt_config_gets(session, cfg, "lsm_merge_ratio", &cval));
+	lsm_tree->merge_ratio = (uint32_t)cval.val;
 	WT_ERR(__wt_config_gets(session, cfg, "lsm_merge_threads", &cval));
 	lsm_tree->merge_threads = (uint32_t)cval.val;
 	/* Sanity check that api_data.py is in sync with lsm.h */
@@ -463,7 +386,6 @@ __lsm_tree_open(
 	/* Try to open the tree. */
 	WT_RET(__wt_calloc_def(session, 1, &lsm_tree));
 	WT_ERR(__wt_rwlock_alloc(session, "lsm tree", &lsm_tree->rwlock));
-	WT_ERR(__wt_cond_alloc(session, "lsm ckpt", 0, &lsm_tree->ckpt_cond));
 	WT_ERR(__lsm_tree_set_name(session, lsm_tree, uri));
 	__wt_stat_init_dsrc_stats(&lsm_tree->stats);
 
@@ -594,6 +516,9 @@ __wt_lsm_tree_switch(
 	F_CLR(lsm_tree, WT_LSM_TREE_NEED_SWITCH);
 	WT_ERR(__wt_lsm_meta_write(session, lsm_tree));
 
+	/* Have a worker thread flush the old chunk. */
+	WT_ERR(__wt_lsm_work_queue(session, lsm_tree, WT_LSM_WORK_FLUSH));
+
 err:	/* TODO: mark lsm_tree bad on error(?) */
 	return (ret);
 }
@@ -617,7 +542,7 @@ __wt_lsm_tree_drop(
 	/* Get the LSM tree. */
 	WT_RET(__wt_lsm_tree_get(session, name, 1, &lsm_tree));
 
-	/* Shut down the LSM worker. */
+	/* Stop background work on the tree. */
 	WT_ERR(__lsm_tree_close(session, lsm_tree));
 
 	/* Prevent any new opens. */
@@ -676,7 +601,7 @@ __wt_lsm_tree_rename(WT_SESSION_IMPL *session,
 	/* Get the LSM tree. */
 	WT_RET(__wt_lsm_tree_get(session, olduri, 1, &lsm_tree));
 
-	/* Shut down the LSM worker. */
+	/* Stop background work on the tree. */
 	WT_ERR(__lsm_tree_close(session, lsm_tree));
 
 	/* Prevent any new opens. */
@@ -749,7 +674,7 @@ __wt_lsm_tree_truncate(
 	/* Get the LSM tree. */
 	WT_RET(__wt_lsm_tree_get(session, name, 1, &lsm_tree));
 
-	/* Shut down the LSM worker. */
+	/* Stop background work on the tree. */
 	WT_RET(__lsm_tree_close(session, lsm_tree));
 
 	/* Prevent any new opens. */
@@ -763,7 +688,7 @@ __wt_lsm_tree_truncate(
 
 	/* Mark all chunks old. */
 	WT_ERR(__wt_lsm_merge_update_tree(
-	    session, lsm_tree, 0, lsm_tree->nchunks, chunk));
+	    session, lsm_tree, 0, lsm_tree->nchunks, &chunk, 1));
 
 	WT_ERR(__wt_lsm_meta_write(session, lsm_tree));
 
@@ -7,9 +7,20 @@
 
 #include "wt_internal.h"
 
+static int __lsm_bloom(
+	WT_SESSION_IMPL *, WT_LSM_TREE *, WT_LSM_WORKER_COOKIE *);
 static int __lsm_bloom_create(WT_SESSION_IMPL *, WT_LSM_TREE *, WT_LSM_CHUNK *);
 static int __lsm_discard_handle(WT_SESSION_IMPL *, const char *, const char *);
+static int __lsm_drop(WT_SESSION_IMPL *, WT_LSM_TREE *);
+static int __lsm_flush(
+	WT_SESSION_IMPL *, WT_LSM_TREE *, WT_LSM_WORKER_COOKIE *);
 static int __lsm_free_chunks(WT_SESSION_IMPL *, WT_LSM_TREE *);
+static int __lsm_switch(WT_SESSION_IMPL *, WT_LSM_TREE *);
+
+/* Work type names, for error messages. */
+static const char *__lsm_work_name[WT_LSM_WORK_MAX] = {
+	"switch", "flush", "Bloom filter creation", "drop", "merge"
+};
 
 /*
  * __lsm_copy_chunks --
@@ -56,259 +67,716 @@ err:	WT_TRET(__wt_rwunlock(session, lsm_tree->rwlock));
 }
 
 /*
- * __wt_lsm_merge_worker --
- *	The merge worker thread for an LSM tree, responsible for merging
- *	on-disk trees.
+ * __lsm_ts_before --
+ *	Return if one time is before another.
+ */
+static inline int
+__lsm_ts_before(const struct timespec *a, const struct timespec *b)
+{
+	return (a->tv_sec < b->tv_sec ||
+	    (a->tv_sec == b->tv_sec && a->tv_nsec < b->tv_nsec));
+}
+
+/*
+ * __lsm_work_push --
+ *	Queue work on an LSM tree behind any queued work of the same or higher
+ * priority, runnable now if the ready time is NULL.  Called with the LSM lock
+ * held.
+ */
+static void
+__lsm_work_push(WT_CONNECTION_IMPL *conn, WT_LSM_TREE *lsm_tree,
+    uint32_t type, const struct timespec *readyp)
+{
+	WT_LSM_WORK_UNIT *u, *unit;
+	struct timespec ready;
+
+	/* Ignore work the tree isn't configured to do. */
+	if (!F_ISSET(lsm_tree, WT_LSM_TREE_WORKING) ||
+	    (type == WT_LSM_WORK_BLOOM &&
+	    !FLD_ISSET(lsm_tree->bloom, WT_LSM_BLOOM_NEWEST)) ||
+	    (type == WT_LSM_WORK_MERGE && !F_ISSET(conn, WT_CONN_LSM_MERGE)))
+		return;
+
+	if (readyp == NULL)
+		WT_CLEAR(ready);
+	else
+		ready = *readyp;
+
+	/* Queueing work again can only make it runnable sooner. */
+	unit = &lsm_tree->work[type];
+	if (unit->queued) {
+		if (__lsm_ts_before(&ready, &unit->ready))
+			unit->ready = ready;
+		return;
+	}
+
+	unit->ready = ready;
+	TAILQ_FOREACH(u, &conn->lsmworkqh, q)
+		if (u->type > type)
+			break;
+	if (u == NULL)
+		TAILQ_INSERT_TAIL(&conn->lsmworkqh, unit, q);
+	else
+		TAILQ_INSERT_BEFORE(u, unit, q);
+	unit->queued = 1;
+}
+
+/*
+ * __lsm_work_delay --
+ *	Queue work on an LSM tree to be retried after a delay.  Called with the
+ * LSM lock held.
+ */
+static void
+__lsm_work_delay(WT_CONNECTION_IMPL *conn, WT_LSM_TREE *lsm_tree,
+    uint32_t type, const struct timespec *now, long usecs)
+{
+	struct timespec ready;
+
+	ready = *now;
+	ready.tv_sec += usecs / WT_MILLION;
+	ready.tv_nsec += (usecs % WT_MILLION) * 1000;
+	if (ready.tv_nsec >= WT_BILLION) {
+		++ready.tv_sec;
+		ready.tv_nsec -= WT_BILLION;
+	}
+	__lsm_work_push(conn, lsm_tree, type, &ready);
+}
+
+/*
+ * __lsm_work_backoff --
+ *	Queue failed work on an LSM tree to be retried, doubling the delay each
+ * time it fails.  Called with the LSM lock held.
+ */
+static void
+__lsm_work_backoff(WT_CONNECTION_IMPL *conn, WT_LSM_TREE *lsm_tree,
+    uint32_t type, const struct timespec *now)
+{
+	WT_LSM_WORK_UNIT *unit;
+
+	unit = &lsm_tree->work[type];
+	unit->backoff = unit->backoff == 0 ? WT_LSM_WORK_RETRY_USECS :
+	    WT_MIN(2 * unit->backoff, WT_LSM_ERROR_RETRY_MAX);
+	__lsm_work_delay(conn, lsm_tree, type, now, unit->backoff);
+}
+
+/*
+ * __lsm_work_next --
+ *	Return the highest priority queued work that is runnable.  Called with
+ * the LSM lock held.
+ */
+static WT_LSM_WORK_UNIT *
+__lsm_work_next(WT_CONNECTION_IMPL *conn, const struct timespec *now)
+{
+	WT_LSM_TREE *lsm_tree;
+	WT_LSM_WORK_UNIT *unit;
+
+	TAILQ_FOREACH(unit, &conn->lsmworkqh, q) {
+		if (__lsm_ts_before(now, &unit->ready))
+			continue;
+		lsm_tree = unit->lsm_tree;
+
+		/* Only one worker does each type of work on a tree. */
+		if (unit->type != WT_LSM_WORK_MERGE) {
+			if (!FLD_ISSET(lsm_tree->work_running, 1 << unit->type))
+				break;
+			continue;
+		}
+
+		/*
+		 * A tree runs at most its configured number of merges, and
+		 * merges take a long time: unless there is only one worker,
+		 * keep a worker free for the other work.
+		 */
+		if (lsm_tree->merge_active < lsm_tree->merge_threads &&
+		    (conn->lsm_workers == 1 ||
+		    conn->lsm_merging < conn->lsm_workers - 1))
+			break;
+	}
+	return (unit);
+}
+
+/*
+ * __lsm_work_wait --
+ *	Return how long an idle worker should wait for queued work to become
+ * runnable, in microseconds, or 0 to wait until signalled.  Called with the
+ * LSM lock held.
+ */
+static long
+__lsm_work_wait(WT_CONNECTION_IMPL *conn, const struct timespec *now)
+{
+	WT_LSM_WORK_UNIT *unit;
+	const struct timespec *ready;
+
+	/*
+	 * Work that is runnable but held back by work already running on its
+	 * tree is claimed by the workers running that work when they finish.
+	 */
+	ready = NULL;
+	TAILQ_FOREACH(unit, &conn->lsmworkqh, q)
+		if (__lsm_ts_before(now, &unit->ready) &&
+		    (ready == NULL || __lsm_ts_before(&unit->ready, ready)))
+			ready = &unit->ready;
+	if (ready == NULL)
+		return (0);
+	return ((long)WT_MIN(
+	    WT_TIMEDIFF(*ready, *now) / 1000 + 1, WT_LSM_MERGE_RETRY_USECS));
+}
+
+/*
+ * __lsm_work_done --
+ *	Queue any work following from work on an LSM tree: successful work is
+ * repeated in case there is more to do, busy work is retried after a delay,
+ * failed work is retried after an increasing delay.  Called with the LSM lock
+ * held.
+ */
+static void
+__lsm_work_done(WT_CONNECTION_IMPL *conn, WT_LSM_TREE *lsm_tree,
+    uint32_t type, int result, const struct timespec *now)
+{
+	if (result != 0 && result != WT_NOTFOUND && result != EBUSY) {
+		__lsm_work_backoff(conn, lsm_tree, type, now);
+		return;
+	}
+	lsm_tree->work[type].backoff = 0;
+
+	switch (type) {
+	case WT_LSM_WORK_SWITCH:
+		/* The switch queues a flush of the old chunk. */
+		break;
+	case WT_LSM_WORK_FLUSH:
+		/* New chunks on disk may need Bloom filters and merging. */
+		if (result == 0) {
+			__lsm_work_push(
+			    conn, lsm_tree, WT_LSM_WORK_FLUSH, NULL);
+			__lsm_work_push(
+			    conn, lsm_tree, WT_LSM_WORK_BLOOM, NULL);
+			__lsm_work_push(
+			    conn, lsm_tree, WT_LSM_WORK_MERGE, NULL);
+		} else if (result == EBUSY)
+			__lsm_work_delay(conn, lsm_tree,
+			    WT_LSM_WORK_FLUSH, now, WT_LSM_WORK_RETRY_USECS);
+		break;
+	case WT_LSM_WORK_BLOOM:
+	case WT_LSM_WORK_DROP:
+		if (result == 0)
+			__lsm_work_push(conn, lsm_tree, type, NULL);
+		else if (result == EBUSY)
+			__lsm_work_delay(conn, lsm_tree,
+			    type, now, WT_LSM_WORK_RETRY_USECS);
+		break;
+	case WT_LSM_WORK_MERGE:
+		/*
+		 * After a merge, flush (evict) the new chunk, drop the merged
+		 * chunks, and look for another merge.  Otherwise, look again
+		 * later: merges across generations wait until the tree has
+		 * stalled for a while.
+		 */
+		if (result == 0) {
+			lsm_tree->merge_ts = *now;
+			__lsm_work_push(
+			    conn, lsm_tree, WT_LSM_WORK_FLUSH, NULL);
+			__lsm_work_push(
+			    conn, lsm_tree, WT_LSM_WORK_DROP, NULL);
+			__lsm_work_push(
+			    conn, lsm_tree, WT_LSM_WORK_MERGE, NULL);
+		} else if (lsm_tree->nchunks > 1)
+			__lsm_work_delay(conn, lsm_tree,
+			    WT_LSM_WORK_MERGE, now, WT_LSM_MERGE_RETRY_USECS);
+		break;
+	}
+}
+
+/*
+ * __lsm_work_run --
+ *	Do a unit of work on an LSM tree.  Returns WT_NOTFOUND if there was
+ * nothing to do, and EBUSY if the work should be retried later.
+ */
+static int
+__lsm_work_run(WT_LSM_WORKER *worker,
+    WT_LSM_TREE *lsm_tree, uint32_t type, u_int id, int stalls)
+{
+	WT_SESSION_IMPL *session;
+
+	session = worker->session;
+
+	switch (type) {
+	case WT_LSM_WORK_SWITCH:
+		return (__lsm_switch(session, lsm_tree));
+	case WT_LSM_WORK_FLUSH:
+		return (__lsm_flush(session, lsm_tree, &worker->cookie));
+	case WT_LSM_WORK_BLOOM:
+		return (__lsm_bloom(session, lsm_tree, &worker->cookie));
+	case WT_LSM_WORK_DROP:
+		return (__lsm_drop(session, lsm_tree));
+	case WT_LSM_WORK_MERGE:
+		return (__wt_lsm_merge(session, lsm_tree, id, stalls));
+	}
+	return (WT_NOTFOUND);
+}
+
+/*
+ * __lsm_worker --
+ *	An LSM worker thread: do queued work on any of the connection's LSM
+ * trees, highest priority first, until the workers are shut down.
  */
-void *
-__wt_lsm_merge_worker(void *vargs)
+static void *
+__lsm_worker(void *arg)
 {
-	WT_LSM_WORKER_ARGS *args;
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
 	WT_LSM_TREE *lsm_tree;
+	WT_LSM_WORKER *worker;
+	WT_LSM_WORK_UNIT *unit;
 	WT_SESSION_IMPL *session;
+	struct timespec now;
+	long wait;
+	uint32_t type;
 	u_int id;
-	int progress, stalls;
+	int more, result, run, stalls;
 
-	args = vargs;
-	lsm_tree = args->lsm_tree;
-	id = args->id;
-	session = lsm_tree->worker_sessions[id];
-	__wt_free(session, args);
-	stalls = 0;
+	worker = arg;
+	session = worker->session;
+	conn = S2C(session);
 
-	while (F_ISSET(lsm_tree, WT_LSM_TREE_WORKING)) {
-		progress = 0;
+	for (;;) {
+		WT_ERR(__wt_epoch(session, &now));
+
+		/* Claim the highest priority runnable work. */
+		lsm_tree = NULL;
+		type = 0;
+		id = 0;
+		stalls = 0;
+		__wt_spin_lock(session, &conn->lsm_lock);
+		if ((unit = __lsm_work_next(conn, &now)) != NULL) {
+			TAILQ_REMOVE(&conn->lsmworkqh, unit, q);
+			unit->queued = 0;
+			lsm_tree = unit->lsm_tree;
+			type = unit->type;
+			if (type != WT_LSM_WORK_MERGE)
+				FLD_SET(lsm_tree->work_running, 1 << type);
+			else {
+				/*
+				 * Merges are numbered in the order they start
+				 * on a tree; stalls are reported in seconds
+				 * since the tree's last merge.
+				 */
+				id = lsm_tree->merge_active++;
+				++conn->lsm_merging;
+				if (__lsm_ts_before(&lsm_tree->merge_ts, &now))
+					stalls = (int)(WT_TIMEDIFF(
+					    now, lsm_tree->merge_ts) /
+					    WT_BILLION);
+
+				/* Let another worker start a merge. */
+				if (lsm_tree->merge_active <
+				    lsm_tree->merge_threads)
+					__lsm_work_push(conn,
+					    lsm_tree, WT_LSM_WORK_MERGE, NULL);
+			}
+		}
+		run = conn->lsm_run;
+		wait = 0;
+		more = 0;
+		if (unit == NULL)
+			wait = __lsm_work_wait(conn, &now);
+		else
+			more = __lsm_work_next(conn, &now) != NULL;
+		__wt_spin_unlock(session, &conn->lsm_lock);
 
-		/* Clear any state from previous worker thread iterations. */
-		session->dhandle = NULL;
+		/*
+		 * Idle workers wait to be signalled, or for delayed work to
+		 * become runnable.  Pass the signal on to another worker if
+		 * there is more work than we can do, or we're shutting down.
+		 */
+		if (unit == NULL) {
+			if (!run) {
+				WT_ERR(__wt_cond_signal(
+				    session, conn->lsm_cond));
+				break;
+			}
+			WT_ERR(__wt_cond_wait(session, conn->lsm_cond, wait));
+			continue;
+		}
+		if (more)
+			WT_ERR(__wt_cond_signal(session, conn->lsm_cond));
 
-		/* Report stalls to merge in seconds. */
-		if (__wt_lsm_merge(session, lsm_tree, id, stalls / 100) == 0)
-			progress = 1;
+		ret = __lsm_work_run(worker, lsm_tree, type, id, stalls);
 
-		/* Clear any state from previous worker thread iterations. */
+		/* Clear any state from the work. */
 		WT_CLEAR_BTREE_IN_SESSION(session);
 
 		/*
-		 * Only have one thread freeing old chunks, and only if there
-		 * are chunks to free.
+		 * Bloom filters, drops and merges can be retried without
+		 * affecting the tree's contents: report other errors, the
+		 * work is retried after an increasing delay.
 		 */
-		if (id == 0 &&
-		    lsm_tree->nold_chunks != lsm_tree->old_avail &&
-		    __lsm_free_chunks(session, lsm_tree) == 0)
-			progress = 1;
+		result = ret;
+		if (ret != 0 && ret != WT_NOTFOUND && ret != EBUSY &&
+		    (type == WT_LSM_WORK_BLOOM ||
+		    type == WT_LSM_WORK_DROP || type == WT_LSM_WORK_MERGE)) {
+			__wt_err(session, ret, "LSM %s of %s",
+			    __lsm_work_name[type], lsm_tree->name);
+			ret = 0;
+		}
+		if (ret == 0 || ret == WT_NOTFOUND || ret == EBUSY)
+			ret = __wt_epoch(session, &now);
 
-		if (progress)
-			stalls = 0;
+		__wt_spin_lock(session, &conn->lsm_lock);
+		if (type != WT_LSM_WORK_MERGE)
+			FLD_CLR(lsm_tree->work_running, 1 << type);
 		else {
-			__wt_sleep(0, 10000);
-			++stalls;
+			--lsm_tree->merge_active;
+			--conn->lsm_merging;
 		}
+		if (ret == 0)
+			__lsm_work_done(conn, lsm_tree, type, result, &now);
+		__wt_spin_unlock(session, &conn->lsm_lock);
+
+		/*
+		 * Other errors mean we have run out of memory or there is some
+		 * other system driven failure.  We can't keep going after such
+		 * a failure - ensure WiredTiger shuts down.
+		 */
+		WT_ERR(ret);
 	}
 
+	if (0) {
+err:		WT_PANIC_ERR(session, ret, "Shutting down LSM worker thread");
+	}
 	return (NULL);
 }
 
 /*
- * __wt_lsm_bloom_worker --
- *	A worker thread for an LSM tree, responsible for creating Bloom filters
- *	for the newest on-disk chunks.
+ * __wt_lsm_work_queue --
+ *	Queue work on an LSM tree for the LSM worker threads.
  */
-void *
-__wt_lsm_bloom_worker(void *arg)
+int
+__wt_lsm_work_queue(
+    WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree, uint32_t type)
 {
-	WT_DECL_RET;
-	WT_LSM_CHUNK *chunk;
-	WT_LSM_TREE *lsm_tree;
-	WT_LSM_WORKER_COOKIE cookie;
-	WT_SESSION_IMPL *session;
-	u_int i, j;
-
-	lsm_tree = arg;
-	session = lsm_tree->bloom_session;
+	WT_CONNECTION_IMPL *conn;
 
-	WT_CLEAR(cookie);
+	conn = S2C(session);
+	if (conn->lsm_worker == NULL)
+		return (0);
 
-	for (;;) {
-		WT_ERR(__lsm_copy_chunks(session, lsm_tree, &cookie, 0));
-		if (!F_ISSET(lsm_tree, WT_LSM_TREE_WORKING))
-			goto err;
+	__wt_spin_lock(session, &conn->lsm_lock);
+	__lsm_work_push(conn, lsm_tree, type, NULL);
+	__wt_spin_unlock(session, &conn->lsm_lock);
 
-		/* Create bloom filters in all checkpointed chunks. */
-		for (i = 0, j = 0; i < cookie.nchunks; i++) {
-			if (!F_ISSET(lsm_tree, WT_LSM_TREE_WORKING))
-				goto err;
+	return (__wt_cond_signal(session, conn->lsm_cond));
+}
 
-			chunk = cookie.chunk_array[i];
+/*
+ * __wt_lsm_work_cancel --
+ *	Discard an LSM tree's queued work, and wait for any work in progress
+ * on the tree to finish.  The tree must no longer be marked working, so no
+ * more work will be queued.
+ */
+void
+__wt_lsm_work_cancel(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_LSM_WORK_UNIT *unit;
+	u_int i;
+	int busy;
 
-			/*
-			 * Skip if a thread is still active in the chunk or it
-			 * isn't suitable.
-			 */
-			if (chunk->ncursor != 0 ||
-			    !F_ISSET(chunk, WT_LSM_CHUNK_ONDISK) ||
-			    F_ISSET(chunk, WT_LSM_CHUNK_BLOOM) ||
-			    F_ISSET(chunk, WT_LSM_CHUNK_MERGING) ||
-			    chunk->generation > 0 ||
-			    chunk->count == 0)
-				continue;
+	conn = S2C(session);
 
-			/*
-			 * If a bloom filter create fails, restart at the
-			 * beginning of the chunk array. Don't exit the thread.
-			 */
-			if (__lsm_bloom_create(session, lsm_tree, chunk) != 0)
-				break;
-			++j;
+	WT_ASSERT(session, !F_ISSET(lsm_tree, WT_LSM_TREE_WORKING));
+	for (;;) {
+		__wt_spin_lock(session, &conn->lsm_lock);
+		for (i = 0; i < WT_LSM_WORK_MAX; i++) {
+			unit = &lsm_tree->work[i];
+			if (unit->queued) {
+				TAILQ_REMOVE(&conn->lsmworkqh, unit, q);
+				unit->queued = 0;
+			}
 		}
-		if (j == 0)
-			__wt_sleep(0, 10000);
+		busy = lsm_tree->work_running != 0 ||
+		    lsm_tree->merge_active != 0;
+		__wt_spin_unlock(session, &conn->lsm_lock);
+		if (!busy)
+			break;
+
+		/* Merges can take a while to notice, don't spin. */
+		__wt_sleep(0, 1000);
 	}
+}
+
+/*
+ * __wt_lsm_worker_start --
+ *	Start the LSM worker threads, the first time an LSM tree is opened.
+ */
+int
+__wt_lsm_worker_start(WT_SESSION_IMPL *session)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+	WT_LSM_WORKER *worker;
+	WT_SESSION_IMPL *s;
+	u_int i;
+
+	conn = S2C(session);
+
+	/* The schema lock serializes LSM tree opens. */
+	WT_ASSERT(session, F_ISSET(session, WT_SESSION_SCHEMA_LOCKED));
+	if (conn->lsm_worker != NULL)
+		return (0);
+
+	WT_RET(__wt_calloc_def(session, conn->lsm_workers, &conn->lsm_worker));
+	WT_ERR(__wt_cond_alloc(session, "LSM worker", 0, &conn->lsm_cond));
+	conn->lsm_run = 1;
 
-err:	__wt_free(session, cookie.chunk_array);
 	/*
-	 * The thread will only exit with failure if we run out of memory or
-	 * there is some other system driven failure. We can't keep going
-	 * after such a failure - ensure WiredTiger shuts down.
+	 * Threads with a session are running, clear the session if the thread
+	 * can't be started.
 	 */
-	if (ret != 0)
-		WT_PANIC_ERR(session, ret,
-		    "Shutting down LSM bloom utility thread");
-	return (NULL);
+	for (i = 0; i < conn->lsm_workers; i++) {
+		worker = &conn->lsm_worker[i];
+		WT_ERR(__wt_open_session(conn, 1, NULL, NULL, &s));
+		s->name = "lsm-worker";
+		worker->session = s;
+		if ((ret = __wt_thread_create(session,
+		    &worker->tid, __lsm_worker, worker)) != 0) {
+			worker->session = NULL;
+			WT_TRET(s->iface.close(&s->iface, NULL));
+			__wt_free(session, s->hazard);
+			goto err;
+		}
+	}
+	return (0);
+
+err:	WT_TRET(__wt_lsm_worker_destroy(conn));
+	return (ret);
 }
 
 /*
- * __wt_lsm_checkpoint_worker --
- *	A worker thread for an LSM tree, responsible for flushing new chunks to
- *	disk.
+ * __wt_lsm_worker_destroy --
+ *	Shut down the LSM worker threads, once all LSM trees are closed.
  */
-void *
-__wt_lsm_checkpoint_worker(void *arg)
+int
+__wt_lsm_worker_destroy(WT_CONNECTION_IMPL *conn)
 {
 	WT_DECL_RET;
-	WT_LSM_CHUNK *chunk;
-	WT_LSM_TREE *lsm_tree;
-	WT_LSM_WORKER_COOKIE cookie;
+	WT_LSM_WORKER *worker;
 	WT_SESSION_IMPL *session;
+	u_int i;
+
+	session = conn->default_session;
+
+	if (conn->lsm_worker == NULL)
+		return (0);
+
+	/* Each worker passes the signal on as it exits. */
+	__wt_spin_lock(session, &conn->lsm_lock);
+	conn->lsm_run = 0;
+	__wt_spin_unlock(session, &conn->lsm_lock);
+	if (conn->lsm_cond != NULL)
+		WT_TRET(__wt_cond_signal(session, conn->lsm_cond));
+
+	for (i = 0; i < conn->lsm_workers; i++) {
+		worker = &conn->lsm_worker[i];
+		if (worker->session == NULL)
+			continue;
+		WT_TRET(__wt_thread_join(session, worker->tid));
+
+		/* Close the thread's session and free its hazard array. */
+		WT_TRET(worker->session->iface.close(
+		    &worker->session->iface, NULL));
+		__wt_free(session, worker->session->hazard);
+		__wt_free(session, worker->cookie.chunk_array);
+	}
+	__wt_free(session, conn->lsm_worker);
+	if (conn->lsm_cond != NULL)
+		WT_TRET(__wt_cond_destroy(session, &conn->lsm_cond));
+
+	return (ret);
+}
+
+/*
+ * __lsm_switch --
+ *	Switch to a new in-memory chunk for an application thread that found
+ * the tree locked.
+ */
+static int
+__lsm_switch(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree)
+{
+	WT_DECL_RET;
+
+	if (!F_ISSET(lsm_tree, WT_LSM_TREE_NEED_SWITCH))
+		return (WT_NOTFOUND);
+
+	WT_RET(__wt_writelock(session, lsm_tree->rwlock));
+	if (F_ISSET(lsm_tree, WT_LSM_TREE_NEED_SWITCH))
+		WT_WITH_SCHEMA_LOCK(session,
+		    ret = __wt_lsm_tree_switch(session, lsm_tree));
+	WT_TRET(__wt_rwunlock(session, lsm_tree->rwlock));
+	return (ret);
+}
+
+/*
+ * __lsm_flush --
+ *	Flush new chunks of an LSM tree to disk, and evict chunks that are on
+ * disk from the cache.
+ */
+static int
+__lsm_flush(WT_SESSION_IMPL *session,
+    WT_LSM_TREE *lsm_tree, WT_LSM_WORKER_COOKIE *cookie)
+{
+	WT_DECL_RET;
+	WT_LSM_CHUNK *chunk;
 	u_int i, j;
+	int busy;
 
-	lsm_tree = arg;
-	session = lsm_tree->ckpt_session;
+	WT_RET(__lsm_copy_chunks(session, lsm_tree, cookie, 0));
 
-	WT_CLEAR(cookie);
+	/* Write checkpoints in all completed files. */
+	for (i = 0, j = 0, busy = 0; i + 1 < cookie->nchunks; i++) {
+		if (!F_ISSET(lsm_tree, WT_LSM_TREE_WORKING))
+			break;
 
-	for (;;) {
+		/* Let a switch happen, then carry on. */
 		if (F_ISSET(lsm_tree, WT_LSM_TREE_NEED_SWITCH)) {
-			WT_ERR(__wt_writelock(session, lsm_tree->rwlock));
-			if (F_ISSET(lsm_tree, WT_LSM_TREE_NEED_SWITCH))
-				WT_WITH_SCHEMA_LOCK(session, ret =
-				    __wt_lsm_tree_switch(session, lsm_tree));
-			WT_TRET(__wt_rwunlock(session, lsm_tree->rwlock));
-			WT_ERR(ret);
+			busy = 1;
+			break;
 		}
 
-		WT_ERR(__lsm_copy_chunks(session, lsm_tree, &cookie, 0));
-		if (!F_ISSET(lsm_tree, WT_LSM_TREE_WORKING))
-			goto err;
+		chunk = cookie->chunk_array[i];
+		/* Stop if a thread is still active in the chunk. */
+		if (chunk->ncursor != 0) {
+			busy = 1;
+			break;
+		}
+
+		/*
+		 * If the chunk is already checkpointed, make sure it is also
+		 * evicted.  Either way, there is no point trying to checkpoint
+		 * it again.
+		 */
+		if (F_ISSET(chunk, WT_LSM_CHUNK_ONDISK)) {
+			if (F_ISSET(chunk, WT_LSM_CHUNK_EVICTED))
+				continue;
 
-		/* Write checkpoints in all completed files. */
-		for (i = 0, j = 0; i < cookie.nchunks - 1; i++) {
-			if (!F_ISSET(lsm_tree, WT_LSM_TREE_WORKING))
-				goto err;
+			if ((ret = __lsm_discard_handle(
+			    session, chunk->uri, NULL)) == 0)
+				F_SET(chunk, WT_LSM_CHUNK_EVICTED);
+			else if (ret == EBUSY) {
+				busy = 1;
+				ret = 0;
+			} else
+				WT_RET_MSG(session, ret, "discard handle");
+			continue;
+		}
 
-			if (F_ISSET(lsm_tree, WT_LSM_TREE_NEED_SWITCH))
-				break;
+		WT_VERBOSE_RET(session, lsm, "LSM worker flushing %u", i);
 
-			chunk = cookie.chunk_array[i];
-			/* Stop if a thread is still active in the chunk. */
-			if (chunk->ncursor != 0)
-				break;
+		/*
+		 * Flush the file before checkpointing: this is the expensive
+		 * part in terms of I/O: do it without holding the schema lock.
+		 */
+		WT_RET(__wt_session_get_btree(
+		    session, chunk->uri, NULL, NULL, 0));
+		ret = __wt_sync_file(session, WT_SYNC_WRITE_LEAVES);
 
-			/*
-			 * If the chunk is already checkpointed, make sure it
-			 * is also evicted.  Either way, there is no point
-			 * trying to checkpoint it again.
-			 */
-			if (F_ISSET(chunk, WT_LSM_CHUNK_ONDISK)) {
-				if (F_ISSET(chunk, WT_LSM_CHUNK_EVICTED))
-					continue;
-
-				if ((ret = __lsm_discard_handle(
-				    session, chunk->uri, NULL)) == 0)
-					F_SET(chunk, WT_LSM_CHUNK_EVICTED);
-				else if (ret == EBUSY)
-					ret = 0;
-				else
-					WT_ERR_MSG(session, ret,
-					    "discard handle");
-				continue;
-			}
+		/*
+		 * Clear the "cache resident" flag so the primary can be
+		 * evicted and eventually closed.
+		 */
+		if (ret == 0)
+			__wt_btree_evictable(session, 1);
+		WT_TRET(__wt_session_release_btree(session));
+		WT_RET(ret);
+
+		WT_VERBOSE_RET(session, lsm, "LSM worker checkpointing %u", i);
+
+		F_SET(lsm_tree, WT_LSM_TREE_LOCKED);
+		WT_WITH_SCHEMA_LOCK(session,
+		    ret = __wt_schema_worker(session, chunk->uri,
+		    __wt_checkpoint, NULL, 0));
+		F_CLR(lsm_tree, WT_LSM_TREE_LOCKED);
+
+		if (ret != 0) {
+			__wt_err(session, ret, "LSM checkpoint");
+			busy = 1;
+			break;
+		}
 
-			WT_VERBOSE_ERR(session, lsm,
-			     "LSM worker flushing %u", i);
+		++j;
+		WT_RET(__wt_writelock(session, lsm_tree->rwlock));
+		F_SET(chunk, WT_LSM_CHUNK_ONDISK);
+		++lsm_tree->dsk_gen;
+		ret = __wt_lsm_meta_write(session, lsm_tree);
+		WT_TRET(__wt_rwunlock(session, lsm_tree->rwlock));
+
+		if (ret != 0) {
+			__wt_err(session, ret, "LSM checkpoint metadata write");
+			busy = 1;
+			break;
+		}
 
-			/*
-			 * Flush the file before checkpointing: this is the
-			 * expensive part in terms of I/O: do it without
-			 * holding the schema lock.
-			 */
-			WT_ERR(__wt_session_get_btree(
-			    session, chunk->uri, NULL, NULL, 0));
-			ret = __wt_sync_file(session, WT_SYNC_WRITE_LEAVES);
+		WT_VERBOSE_RET(session, lsm, "LSM worker checkpointed %u", i);
+	}
+	return (j != 0 ? 0 : (busy ? EBUSY : WT_NOTFOUND));
+}
 
-			/*
-			 * Clear the "cache resident" flag so the primary can
-			 * be evicted and eventually closed.
-			 */
-			if (ret == 0)
-				__wt_btree_evictable(session, 1);
-			WT_TRET(__wt_session_release_btree(session));
-			WT_ERR(ret);
-
-			WT_VERBOSE_ERR(session, lsm,
-			     "LSM worker checkpointing %u", i);
-
-			F_SET(lsm_tree, WT_LSM_TREE_LOCKED);
-			WT_WITH_SCHEMA_LOCK(session,
-			    ret = __wt_schema_worker(session, chunk->uri,
-			    __wt_checkpoint, NULL, 0));
-			F_CLR(lsm_tree, WT_LSM_TREE_LOCKED);
-
-			if (ret != 0) {
-				__wt_err(session, ret, "LSM checkpoint");
-				break;
-			}
+/*
+ * __lsm_bloom --
+ *	Create Bloom filters for the newest on-disk chunks of an LSM tree.
+ */
+static int
+__lsm_bloom(WT_SESSION_IMPL *session,
+    WT_LSM_TREE *lsm_tree, WT_LSM_WORKER_COOKIE *cookie)
+{
+	WT_LSM_CHUNK *chunk;
+	u_int i, j;
 
-			++j;
-			WT_ERR(__wt_writelock(session, lsm_tree->rwlock));
-			F_SET(chunk, WT_LSM_CHUNK_ONDISK);
-			++lsm_tree->dsk_gen;
-			ret = __wt_lsm_meta_write(session, lsm_tree);
-			WT_TRET(__wt_rwunlock(session, lsm_tree->rwlock));
+	WT_RET(__lsm_copy_chunks(session, lsm_tree, cookie, 0));
 
-			if (ret != 0) {
-				__wt_err(session, ret,
-				    "LSM checkpoint metadata write");
-				break;
-			}
+	/* Create bloom filters in all checkpointed chunks. */
+	for (i = 0, j = 0; i < cookie->nchunks; i++) {
+		if (!F_ISSET(lsm_tree, WT_LSM_TREE_WORKING))
+			break;
 
-			WT_VERBOSE_ERR(session, lsm,
-			     "LSM worker checkpointed %u", i);
-		}
-		if (j == 0 && !F_ISSET(lsm_tree, WT_LSM_TREE_NEED_SWITCH))
-			WT_ERR(__wt_cond_wait(
-			    session, lsm_tree->ckpt_cond, 10000));
+		chunk = cookie->chunk_array[i];
+
+		/*
+		 * Skip if a thread is still active in the chunk or it isn't
+		 * suitable.
+		 */
+		if (chunk->ncursor != 0 ||
+		    !F_ISSET(chunk, WT_LSM_CHUNK_ONDISK) ||
+		    F_ISSET(chunk, WT_LSM_CHUNK_BLOOM) ||
+		    F_ISSET(chunk, WT_LSM_CHUNK_MERGING) ||
+		    chunk->generation > 0 ||
+		    chunk->count == 0)
+			continue;
+
+		/* If a Bloom filter create fails, try again later. */
+		if (__lsm_bloom_create(session, lsm_tree, chunk) != 0)
+			return (EBUSY);
+		++j;
 	}
-err:	__wt_free(session, cookie.chunk_array);
-	/*
-	 * The thread will only exit with failure if we run out of memory or
-	 * there is some other system driven failure. We can't keep going
-	 * after such a failure - ensure WiredTiger shuts down.
-	 */
-	if (ret != 0 && ret != WT_NOTFOUND)
-		WT_PANIC_ERR(session, ret,
-		    "Shutting down LSM checkpoint utility thread");
-	return (NULL);
+	return (j == 0 ? WT_NOTFOUND : 0);
+}
+
+/*
+ * __lsm_drop --
+ *	Drop chunks of an LSM tree that have been merged.
+ */
+static int
+__lsm_drop(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree)
+{
+	WT_DECL_RET;
+
+	if (lsm_tree->nold_chunks == lsm_tree->old_avail)
+		return (WT_NOTFOUND);
+
+	/* Chunks may still be in use by cursors, try again later. */
+	if ((ret = __lsm_free_chunks(session, lsm_tree)) == WT_NOTFOUND &&
+	    lsm_tree->nold_chunks != lsm_tree->old_avail)
+		ret = EBUSY;
+	return (ret);
 }
 
 /*
@@ -373,6 +841,9 @@ __lsm_bloom_create(
 	WT_TRET(__wt_bloom_finalize(bloom));
 	WT_ERR(ret);
 
+	/* Keep the filter in memory for lookups. */
+	WT_ERR(__wt_bloom_load(bloom, &chunk->bloom_bits));
+
 	WT_VERBOSE_ERR(session, lsm,
 	    "LSM worker created bloom filter %s. "
 	    "Expected %" PRIu64 " items, got %" PRIu64,
@@ -464,7 +935,8 @@ __lsm_free_chunks(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree)
 	 * doing I/O or waiting on the schema lock.
 	 *
 	 * This is safe because only one thread will be in this function at a
-	 * time because there is only one LSM worker thread.  Merges may
+	 * time: the LSM worker threads only run one drop on a tree at a time,
+	 * see __lsm_work_next.  Merges may
 	 * complete concurrently, and the old_chunks array may be extended, but
 	 * the offset we're working on won't change, and we lock the tree for
 	 * that update.
@@ -489,6 +961,7 @@ __lsm_free_chunks(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree)
 				WT_ERR(ret);
 
 			F_CLR(chunk, WT_LSM_CHUNK_BLOOM);
+			__wt_free(session, chunk->bloom_bits);
 		}
 		if (chunk->uri != NULL) {
 			/*
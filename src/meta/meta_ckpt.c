@@ -106,17 +106,21 @@ static int
 __ckpt_set(WT_SESSION_IMPL *session, const char *fname, const char *v)
 {
 	WT_DECL_RET;
-	const char *config, *cfg[3], *newcfg;
+	const char *config, *cfg[4], *newcfg;
 
 	config = newcfg = NULL;
 
 	/* Retrieve the metadata for this file. */
 	WT_ERR(__wt_metadata_read(session, fname, &config));
 
-	/* Replace the checkpoint entry. */
-	cfg[0] = config;
-	cfg[1] = v == NULL ? "checkpoint=()" : v;
-	cfg[2] = NULL;
+	/*
+	 * Replace the checkpoint entry.  Start from the default configuration,
+	 * files created by older releases may not have every entry we set.
+	 */
+	cfg[0] = WT_CONFIG_BASE(session, file_meta);
+	cfg[1] = config;
+	cfg[2] = v == NULL ? "checkpoint=()" : v;
+	cfg[3] = NULL;
 	WT_ERR(__wt_config_collapse(session, cfg, &newcfg));
 	WT_ERR(__wt_metadata_update(session, fname, newcfg));
 
@@ -368,8 +372,8 @@ format:
  *	Set a file's checkpoint value from the WT_CKPT list.
  */
 int
-__wt_meta_ckptlist_set(
-    WT_SESSION_IMPL *session, const char *fname, WT_CKPT *ckptbase)
+__wt_meta_ckptlist_set(WT_SESSION_IMPL *session,
+    const char *fname, WT_CKPT *ckptbase, off_t ckpt_lsn)
 {
 	struct timespec ts;
 	WT_CKPT *ckpt;
@@ -446,6 +450,11 @@ __wt_meta_ckptlist_set(
 		sep = ",";
 	}
 	WT_ERR(__wt_buf_catfmt(session, buf, ")"));
+
+	/* Set the LSN from which the file is recovered, if it changed. */
+	if (ckpt_lsn != WT_LOG_INVALID_LSN)
+		WT_ERR(__wt_buf_catfmt(session, buf,
+		    ",checkpoint_lsn=%" PRIuMAX, (uintmax_t)ckpt_lsn));
 	WT_ERR(__ckpt_set(session, fname, buf->mem));
 
 err:	__wt_scr_free(&buf);
@@ -0,0 +1,38 @@
+/*-
+ * Copyright (c) 2008-2013 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+/*
+ * __wt_fallocate --
+ *	Allocate file space without changing the file's size.  Returns ENOTSUP
+ * if the system or file system doesn't support preallocation.
+ */
+int
+__wt_fallocate(WT_SESSION_IMPL *session, WT_FH *fh, off_t offset, off_t len)
+{
+	WT_DECL_RET;
+
+	WT_VERBOSE_RET(session, fileops,
+	    "%s: fallocate %" PRIdMAX "B @ %" PRIdMAX,
+	    fh->name, (intmax_t)len, (intmax_t)offset);
+
+#if defined(HAVE_FALLOCATE) && defined(FALLOC_FL_KEEP_SIZE)
+	WT_SYSCALL_RETRY(
+	    fallocate(fh->fd, FALLOC_FL_KEEP_SIZE, offset, len), ret);
+	if (ret == 0)
+		return (0);
+	if (ret == EOPNOTSUPP || ret == ENOSYS)
+		return (ENOTSUP);
+	WT_RET_MSG(session, ret, "%s fallocate error", fh->name);
+#else
+	WT_UNUSED(offset);
+	WT_UNUSED(len);
+	WT_UNUSED(ret);
+	return (ENOTSUP);
+#endif
+}
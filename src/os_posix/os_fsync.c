@@ -14,13 +14,16 @@
 int
 __wt_fsync(WT_SESSION_IMPL *session, WT_FH *fh)
 {
+	struct timespec start;
 	WT_DECL_RET;
 
 	WT_VERBOSE_RET(session, fileops, "%s: fsync", fh->name);
 
+	WT_CSTAT_LATENCY_START(session, start);
 	WT_SYSCALL_RETRY(fsync(fh->fd), ret);
 	if (ret != 0)
 		WT_RET_MSG(session, ret, "%s fsync error", fh->name);
+	WT_CSTAT_LATENCY(session, latency_fsync, start);
 
 	return (0);
 }
@@ -15,18 +15,22 @@ int
 __wt_read(WT_SESSION_IMPL *session,
     WT_FH *fh, off_t offset, uint32_t bytes, void *buf)
 {
+	struct timespec start;
+
 	WT_CSTAT_INCR(session, read_io);
 
 	WT_VERBOSE_RET(session, fileops,
 	    "%s: read %" PRIu32 " bytes at offset %" PRIuMAX,
 	    fh->name, bytes, (uintmax_t)offset);
 
+	WT_CSTAT_LATENCY_START(session, start);
 	if (pread(fh->fd, buf, (size_t)bytes, offset) != (ssize_t)bytes)
 		WT_RET_MSG(session, __wt_errno(),
 		    "%s read error: failed to read %" PRIu32
 		    " bytes at offset %" PRIuMAX,
 		    fh->name, bytes, (uintmax_t)offset);
 
+	WT_CSTAT_LATENCY(session, latency_read, start);
 	return (0);
 }
 
@@ -38,17 +42,21 @@ int
 __wt_write(WT_SESSION_IMPL *session,
     WT_FH *fh, off_t offset, uint32_t bytes, const void *buf)
 {
+	struct timespec start;
+
 	WT_CSTAT_INCR(session, write_io);
 
 	WT_VERBOSE_RET(session, fileops,
 	    "%s: write %" PRIu32 " bytes at offset %" PRIuMAX,
 	    fh->name, bytes, (uintmax_t)offset);
 
+	WT_CSTAT_LATENCY_START(session, start);
 	if (pwrite(fh->fd, buf, (size_t)bytes, offset) != (ssize_t)bytes)
 		WT_RET_MSG(session, __wt_errno(),
 		    "%s write error: failed to write %" PRIu32
 		    " bytes at offset %" PRIuMAX,
 		    fh->name, bytes, (uintmax_t)offset);
 
+	WT_CSTAT_LATENCY(session, latency_write, start);
 	return (0);
 }
@@ -95,3 +95,55 @@ __wt_struct_unpack(WT_SESSION_IMPL *session,
 
 	return (ret);
 }
+
+/*
+ * __wt_struct_repack --
+ *	Convert a packed byte string from one format to another, for as many
+ * columns as both formats have: the formats' column types must match, but
+ * can differ in whether items have a size prefix.
+ */
+int
+__wt_struct_repack(WT_SESSION_IMPL *session, const char *infmt,
+    const char *outfmt, const WT_ITEM *inbuf, WT_ITEM *outbuf)
+{
+	WT_DECL_RET;
+	WT_PACK inpack, outpack;
+	WT_PACK_VALUE inpv, outpv;
+	const uint8_t *p, *end;
+	uint8_t *op, *oend;
+	size_t size;
+
+	WT_CLEAR(inpv);		/* -Wuninitialized */
+	WT_CLEAR(outpv);
+
+	/* Size the output. */
+	p = inbuf->data;
+	end = p + inbuf->size;
+	size = 0;
+	WT_RET(__pack_init(session, &inpack, infmt));
+	WT_RET(__pack_init(session, &outpack, outfmt));
+	while ((ret = __pack_next(&inpack, &inpv)) == 0 &&
+	    (ret = __pack_next(&outpack, &outpv)) == 0) {
+		WT_RET(__unpack_read(session, &inpv, &p, (size_t)(end - p)));
+		outpv.u = inpv.u;
+		size += __pack_size(session, &outpv);
+	}
+	WT_RET_NOTFOUND_OK(ret);
+
+	/* Write the output. */
+	WT_RET(__wt_buf_initsize(session, outbuf, size));
+	p = inbuf->data;
+	op = outbuf->mem;
+	oend = op + size;
+	WT_RET(__pack_init(session, &inpack, infmt));
+	WT_RET(__pack_init(session, &outpack, outfmt));
+	while ((ret = __pack_next(&inpack, &inpv)) == 0 &&
+	    (ret = __pack_next(&outpack, &outpv)) == 0) {
+		WT_RET(__unpack_read(session, &inpv, &p, (size_t)(end - p)));
+		outpv.u = inpv.u;
+		WT_RET(__pack_write(session, &outpv, &op, (size_t)(oend - op)));
+	}
+	WT_RET_NOTFOUND_OK(ret);
+
+	return (0);
+}
@@ -13,6 +13,7 @@ __create_file(WT_SESSION_IMPL *session,
 {
 	WT_DECL_ITEM(val);
 	WT_DECL_RET;
+	off_t ckpt_lsn;
 	int is_metadata;
 	const char *filecfg[4], *fileconf, *filename;
 
@@ -38,14 +39,18 @@ __create_file(WT_SESSION_IMPL *session,
 		WT_ERR(__wt_meta_track_fileop(session, NULL, uri));
 
 	/*
-	 * If creating an ordinary file, append the current version numbers to
-	 * the passed-in configuration and insert the resulting configuration
-	 * into the metadata.
+	 * If creating an ordinary file, append the current version numbers and
+	 * the LSN from which the file is recovered to the passed-in
+	 * configuration and insert the resulting configuration into the
+	 * metadata.
 	 */
 	if (!is_metadata) {
 		WT_ERR(__wt_scr_alloc(session, 0, &val));
-		WT_ERR(__wt_buf_fmt(session, val, "version=(major=%d,minor=%d)",
-		    WT_BTREE_MAJOR_VERSION, WT_BTREE_MINOR_VERSION));
+		__wt_log_ckpt_lsn(session, &ckpt_lsn);
+		WT_ERR(__wt_buf_fmt(session, val,
+		    "version=(major=%d,minor=%d),checkpoint_lsn=%" PRIuMAX,
+		    WT_BTREE_MAJOR_VERSION, WT_BTREE_MINOR_VERSION,
+		    (uintmax_t)ckpt_lsn));
 		filecfg[0] = WT_CONFIG_BASE(session, file_meta);
 		filecfg[1] = config;
 		filecfg[2] = val->data;
@@ -242,8 +247,9 @@ __create_index(WT_SESSION_IMPL *session,
     const char *name, int exclusive, const char *config)
 {
 	WT_CONFIG pkcols;
-	WT_CONFIG_ITEM ckey, cval, icols;
+	WT_CONFIG_ITEM ckey, cval, icols, vcols;
 	WT_DECL_RET;
+	WT_EXTRACTOR *extractor;
 	WT_ITEM confbuf, extra_cols, fmt, namebuf;
 	WT_TABLE *table;
 	const char *cfg[4] =
@@ -289,6 +295,33 @@ __create_index(WT_SESSION_IMPL *session,
 		    ",source=\"%s\"", source));
 	}
 
+	/*
+	 * Indices with a custom extractor are keyed by the columns the
+	 * extractor generates, in the configured key format, followed by the
+	 * table's primary key.
+	 */
+	if (__wt_config_getones(session, config, "extractor", &cval) == 0 &&
+	    cval.len != 0) {
+		WT_ERR(__wt_schema_get_extractor(session, &cval, &extractor));
+		if (__wt_config_getones(session,
+		    config, "value_columns", &cval) == 0 && cval.len != 0)
+			WT_ERR_MSG(session, EINVAL,
+			    "Indices with a custom extractor cannot store "
+			    "value columns: %s", name);
+		if (table->is_simple)
+			WT_ERR_MSG(session, EINVAL,
+			    "Indices on '%s' require named table columns",
+			    table->name);
+		if (__wt_config_getones(
+		    session, config, "key_format", &cval) != 0)
+			WT_ERR_MSG(session, EINVAL,
+			    "No 'key_format' configuration for '%s'", name);
+		WT_ERR(__wt_buf_fmt(session, &fmt,
+		    "value_format=,key_format=%.*s%s",
+		    (int)cval.len, cval.str, table->key_format));
+		goto create;
+	}
+
 	/* Calculate the key/value formats. */
 	if (__wt_config_getones(session, config, "columns", &icols) != 0)
 		WT_ERR_MSG(session, EINVAL,
@@ -320,14 +353,22 @@ __create_index(WT_SESSION_IMPL *session,
 
 	/*
 	 * Index values are normally empty: all columns are packed into the
-	 * index key.  The exception is LSM, which (currently) reserves empty
-	 * values as tombstones.  Use a single padding byte in that case.
+	 * index key.  Covering indices store a list of the table's columns in
+	 * the index value, so index cursors can return them without reading
+	 * the table.
+	 *
+	 * The exception is LSM, which (currently) reserves empty values as
+	 * tombstones.  Follow any stored columns with a padding byte: it isn't
+	 * written, but it gives a trailing item column a size, so the stored
+	 * value is never empty.
 	 */
+	WT_ERR(__wt_buf_fmt(session, &fmt, "value_format="));
+	if (__wt_config_getones(session, config, "value_columns", &vcols) == 0)
+		WT_ERR(__wt_struct_reformat(session, table,
+		    vcols.str, vcols.len, NULL, 0, &fmt));
 	if (WT_PREFIX_MATCH(source, "lsm:"))
-		WT_ERR(__wt_buf_fmt(session, &fmt, "value_format=x,"));
-	else
-		WT_ERR(__wt_buf_fmt(session, &fmt, "value_format=,"));
-	WT_ERR(__wt_buf_fmt(session, &fmt, "value_format=,key_format="));
+		WT_ERR(__wt_buf_catfmt(session, &fmt, "x"));
+	WT_ERR(__wt_buf_catfmt(session, &fmt, ",key_format="));
 	WT_ERR(__wt_struct_reformat(session, table,
 	    icols.str, icols.len, (const char *)extra_cols.data, 0, &fmt));
 
@@ -338,7 +379,7 @@ __create_index(WT_SESSION_IMPL *session,
 		    "column-store index may not use the record number as its "
 		    "index key");
 
-	sourcecfg[1] = fmt.data;
+create:	sourcecfg[1] = fmt.data;
 	WT_ERR(__wt_config_concat(session, sourcecfg, &sourceconf));
 
 	WT_ERR(__wt_schema_create(session, source, sourceconf));
@@ -136,6 +136,10 @@ __wt_schema_destroy_index(WT_SESSION_IMPL *session, WT_INDEX *idx)
 	__wt_free(session, idx->key_format);
 	__wt_free(session, idx->key_plan);
 	__wt_free(session, idx->value_plan);
+	__wt_free(session, idx->value_format);
+	__wt_free(session, idx->store_plan);
+	__wt_free(session, idx->cover_columns);
+	__wt_free(session, idx->cover_plan);
 	__wt_free(session, idx->idxkey_format);
 	__wt_free(session, idx);
 }
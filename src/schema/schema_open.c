@@ -108,6 +108,146 @@ err:	__wt_scr_free(&buf);
 	return (ret);
 }
 
+/*
+ * __wt_schema_get_extractor --
+ *	Find a custom extractor by name.
+ */
+int
+__wt_schema_get_extractor(WT_SESSION_IMPL *session,
+    WT_CONFIG_ITEM *cval, WT_EXTRACTOR **extractorp)
+{
+	WT_NAMED_EXTRACTOR *nextractor;
+
+	*extractorp = NULL;
+	TAILQ_FOREACH(nextractor, &S2C(session)->extractorqh, q)
+		if (WT_STRING_MATCH(nextractor->name, cval->str, cval->len)) {
+			*extractorp = nextractor->extractor;
+			return (0);
+		}
+	WT_RET_MSG(session, EINVAL,
+	    "unknown extractor '%.*s'", (int)cval->len, cval->str);
+}
+
+/*
+ * __open_index_extractor --
+ *	Set up the key format of an index with a custom extractor.
+ */
+static int
+__open_index_extractor(WT_SESSION_IMPL *session, WT_TABLE *table, WT_INDEX *idx)
+{
+	WT_DECL_ITEM(buf);
+	WT_DECL_RET;
+	WT_PACK pack;
+	WT_PACK_VALUE pv;
+	u_int ncols, npkcols;
+
+	WT_CLEAR(pv);   /* -Wuninitialized */
+
+	/*
+	 * The file's key is the extracted columns followed by the columns of
+	 * the table's primary key: the index cursor key is the columns that
+	 * come before the primary key.
+	 */
+	WT_RET(__pack_init(session, &pack, idx->key_format));
+	for (ncols = 0; (ret = __pack_next(&pack, &pv)) == 0; ++ncols)
+		;
+	WT_RET_NOTFOUND_OK(ret);
+	WT_RET(__pack_init(session, &pack, table->key_format));
+	for (npkcols = 0; (ret = __pack_next(&pack, &pv)) == 0; ++npkcols)
+		;
+	WT_RET_NOTFOUND_OK(ret);
+	if (ncols <= npkcols)
+		WT_RET_MSG(session, EINVAL,
+		    "index %s has no extracted key columns", idx->name);
+
+	WT_RET(__wt_scr_alloc(session, 0, &buf));
+	WT_ERR(__wt_struct_truncate(
+	    session, idx->key_format, ncols - npkcols, buf));
+	idx->idxkey_format = __wt_buf_steal(session, buf, NULL);
+
+	/*
+	 * If the last extracted column is an item, the index cursor's format
+	 * packs it without a size, but the file's key needs the size to find
+	 * the primary key that follows: keys are repacked between the two.
+	 */
+	idx->extract_repack =
+	    idx->idxkey_format[strlen(idx->idxkey_format) - 1] == 'U';
+
+err:	__wt_scr_free(&buf);
+	return (ret);
+}
+
+/*
+ * __open_index_cover --
+ *	Set up an index that stores value columns: the index key columns are
+ * in the key_columns list.
+ */
+static int
+__open_index_cover(WT_SESSION_IMPL *session,
+    WT_TABLE *table, WT_INDEX *idx, WT_ITEM *key_columns, u_int key_cols)
+{
+	WT_CONFIG conf;
+	WT_CONFIG_ITEM ckey, cval;
+	WT_DECL_ITEM(buf);
+	WT_DECL_ITEM(plan);
+	WT_DECL_RET;
+	u_int i;
+
+	WT_RET(__wt_scr_alloc(session, 0, &buf));
+	WT_ERR(__wt_scr_alloc(session, 0, &plan));
+
+	/*
+	 * The stored value format, and the plan to fill in the stored value
+	 * from the table's column groups.
+	 */
+	WT_ERR(__wt_config_getones(
+	    session, idx->config, "value_format", &cval));
+	WT_ERR(__wt_buf_fmt(session, buf, "%.*s", (int)cval.len, cval.str));
+	idx->value_format = __wt_buf_steal(session, buf, NULL);
+
+	WT_ERR(__wt_struct_plan(session, table,
+	    idx->valcolconf.str, idx->valcolconf.len, 0, plan));
+	idx->store_plan = __wt_buf_steal(session, plan, NULL);
+
+	/*
+	 * LSM indices store the value columns, their format gives the stored
+	 * value a size (see __create_index).
+	 */
+	idx->need_value = 0;
+
+	/* The columns stored in the index: the key, then the value. */
+	WT_ERR(__wt_buf_set(
+	    session, buf, key_columns->data, key_columns->size));
+	WT_ERR(__wt_config_subinit(session, &conf, &idx->valcolconf));
+	while ((ret = __wt_config_next(&conf, &ckey, &cval)) == 0)
+		WT_ERR(__wt_buf_catfmt(
+		    session, buf, "%.*s,", (int)ckey.len, ckey.str));
+	WT_ERR_NOTFOUND_OK(ret);
+	idx->cover_columns = __wt_buf_steal(session, buf, NULL);
+	idx->ncover_key_columns = key_cols;
+
+	/*
+	 * If all of the table's value columns are stored, index cursors don't
+	 * have to read the table by default.
+	 */
+	WT_ERR(__wt_buf_init(session, buf, 0));
+	WT_ERR(__wt_config_subinit(session, &conf, &table->colconf));
+	for (i = 0; (ret = __wt_config_next(&conf, &ckey, &cval)) == 0; i++)
+		if (i >= table->nkey_columns)
+			WT_ERR(__wt_buf_catfmt(
+			    session, buf, "%.*s,", (int)ckey.len, ckey.str));
+	WT_ERR_NOTFOUND_OK(ret);
+	WT_ERR(__wt_buf_init(session, plan, 0));
+	if ((ret = __wt_struct_plan_index(
+	    session, idx, buf->data, buf->size, plan)) == 0)
+		idx->cover_plan = __wt_buf_steal(session, plan, NULL);
+	WT_ERR_NOTFOUND_OK(ret);
+
+err:	__wt_scr_free(&buf);
+	__wt_scr_free(&plan);
+	return (ret);
+}
+
 /*
  * ___open_index --
  *	Open an index.
@@ -120,7 +260,7 @@ __open_index(WT_SESSION_IMPL *session, WT_TABLE *table, WT_INDEX *idx)
 	WT_DECL_ITEM(buf);
 	WT_DECL_ITEM(plan);
 	WT_DECL_RET;
-	u_int cursor_key_cols, i;
+	u_int cursor_key_cols, i, key_cols;
 
 	WT_ERR(__wt_scr_alloc(session, 0, &buf));
 
@@ -136,6 +276,18 @@ __open_index(WT_SESSION_IMPL *session, WT_TABLE *table, WT_INDEX *idx)
 	    session, buf, "%.*s", (int)cval.len, cval.str));
 	idx->key_format = __wt_buf_steal(session, buf, NULL);
 
+	/*
+	 * Indices with a custom extractor have no key plan: the extractor
+	 * supplies the leading key columns, the primary key follows them.
+	 */
+	if (__wt_config_getones(
+	    session, idx->config, "extractor", &cval) == 0 && cval.len != 0) {
+		WT_ERR(__wt_schema_get_extractor(
+		    session, &cval, &idx->extractor));
+		WT_ERR(__open_index_extractor(session, table, idx));
+		goto value;
+	}
+
 	/*
 	 * The key format for an index is somewhat subtle: the application
 	 * specifies a set of columns that it will use for the key, but the
@@ -159,6 +311,7 @@ __open_index(WT_SESSION_IMPL *session, WT_TABLE *table, WT_INDEX *idx)
 	}
 	if (ret != 0 && ret != WT_NOTFOUND)
 		goto err;
+	key_cols = cursor_key_cols;
 
 	/*
 	 * Now add any primary key columns from the table that are not
@@ -177,6 +330,7 @@ __open_index(WT_SESSION_IMPL *session, WT_TABLE *table, WT_INDEX *idx)
 			continue;
 		WT_ERR(__wt_buf_catfmt(
 		    session, buf, "%.*s,", (int)ckey.len, ckey.str));
+		++key_cols;
 	}
 	if (ret != 0 && ret != WT_NOTFOUND)
 		goto err;
@@ -185,6 +339,12 @@ __open_index(WT_SESSION_IMPL *session, WT_TABLE *table, WT_INDEX *idx)
 	WT_ERR(__wt_struct_plan(session, table, buf->data, buf->size, 0, plan));
 	idx->key_plan = __wt_buf_steal(session, plan, NULL);
 
+	/* Set up any value columns stored in the index. */
+	if (__wt_config_getones(session,
+	    idx->config, "value_columns", &idx->valcolconf) == 0 &&
+	    idx->valcolconf.len != 0)
+		WT_ERR(__open_index_cover(session, table, idx, buf, key_cols));
+
 	/* Set up the cursor key format (the visible columns). */
 	WT_ERR(__wt_buf_init(session, buf, 0));
 	WT_ERR(__wt_struct_truncate(session,
@@ -192,7 +352,8 @@ __open_index(WT_SESSION_IMPL *session, WT_TABLE *table, WT_INDEX *idx)
 	idx->idxkey_format = __wt_buf_steal(session, buf, NULL);
 
 	/* By default, index cursor values are the table value columns. */
-	/* TODO Optimize to use index columns in preference to table lookups. */
+value:	if (plan == NULL)
+		WT_ERR(__wt_scr_alloc(session, 0, &plan));
 	WT_ERR(__wt_struct_plan(session,
 	    table, table->colconf.str, table->colconf.len, 1, plan));
 	idx->value_plan = __wt_buf_steal(session, plan, NULL);
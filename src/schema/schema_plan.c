@@ -24,8 +24,6 @@ __find_next_col(WT_SESSION_IMPL *session, WT_TABLE *table,
 
 	getnext = 1;
 	for (colgroup = NULL, cg = 0; cg < WT_COLGROUPS(table); cg++) {
-		colgroup = table->cgroups[cg];
-
 		/*
 		 * If there is only one column group, we just scan through all
 		 * of the columns.  For tables with multiple column groups, we
@@ -36,7 +34,8 @@ __find_next_col(WT_SESSION_IMPL *session, WT_TABLE *table,
 			cval = table->colconf;
 			col = 0;
 		} else {
-cgcols:			cval = colgroup->colconf;
+cgcols:			colgroup = table->cgroups[cg];
+			cval = colgroup->colconf;
 			col = table->nkey_columns;
 		}
 		WT_RET(__wt_config_subinit(session, &conf, &cval));
@@ -249,6 +248,42 @@ __wt_struct_plan(WT_SESSION_IMPL *session, WT_TABLE *table,
 	return (0);
 }
 
+/*
+ * __wt_struct_plan_index --
+ *	Given an index that stores value columns, build the projection plan to
+ *	read a list of columns from the index alone.  Returns WT_NOTFOUND if
+ *	any of the columns is not stored in the index.
+ */
+int
+__wt_struct_plan_index(WT_SESSION_IMPL *session,
+    WT_INDEX *idx, const char *columns, size_t len, WT_ITEM *plan)
+{
+	WT_CONFIG conf;
+	WT_CONFIG_ITEM k, v;
+	WT_DECL_RET;
+	WT_TABLE cover;
+
+	if (idx->cover_columns == NULL)
+		return (WT_NOTFOUND);
+
+	/*
+	 * Describe the index as a table with a single column group: the
+	 * index key columns followed by the stored value columns.
+	 */
+	WT_CLEAR(cover);
+	cover.colconf.str = idx->cover_columns;
+	cover.colconf.len = strlen(idx->cover_columns);
+	cover.nkey_columns = idx->ncover_key_columns;
+
+	/* Columns that aren't found are skipped by the plan, check first. */
+	WT_RET(__wt_config_initn(session, &conf, columns, len));
+	while ((ret = __wt_config_next(&conf, &k, &v)) == 0)
+		WT_RET(__wt_config_subgetraw(session, &cover.colconf, &k, &v));
+	WT_RET_NOTFOUND_OK(ret);
+
+	return (__wt_struct_plan(session, &cover, columns, len, 0, plan));
+}
+
 static int
 __find_column_format(WT_SESSION_IMPL *session,
     WT_TABLE *table, WT_CONFIG_ITEM *colname, int value_only, WT_PACK_VALUE *pv)
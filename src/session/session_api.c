@@ -72,6 +72,9 @@ __session_close(WT_SESSION *wt_session, const char *config)
 
 	WT_ASSERT(session, session->ncursors == 0);
 
+	/* Discard cursors cached by the closes. */
+	__wt_curfile_cache_discard(session);
+
 	/*
 	 * Acquire the schema lock: we may be closing btree handles.
 	 *
@@ -779,7 +782,10 @@ __wt_open_session(WT_CONNECTION_IMPL *conn, int internal,
 	    event_handler == NULL ? session->event_handler : event_handler);
 
 	TAILQ_INIT(&session_ret->cursors);
+	TAILQ_INIT(&session_ret->cursor_cache);
 	TAILQ_INIT(&session_ret->dhandles);
+	for (i = 0; i < WT_HASH_ARRAY_SIZE; i++)
+		TAILQ_INIT(&session_ret->dhhash[i]);
 
 	/* Initialize transaction support. */
 	WT_ERR(__wt_txn_init(session_ret));
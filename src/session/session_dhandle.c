@@ -16,11 +16,14 @@ __wt_session_add_btree(
     WT_SESSION_IMPL *session, WT_DATA_HANDLE_CACHE **dhandle_cachep)
 {
 	WT_DATA_HANDLE_CACHE *dhandle_cache;
+	uint64_t bucket;
 
 	WT_RET(__wt_calloc_def(session, 1, &dhandle_cache));
 	dhandle_cache->dhandle = session->dhandle;
 
+	bucket = WT_DHANDLE_BUCKET(session->dhandle->name_hash);
 	TAILQ_INSERT_HEAD(&session->dhandles, dhandle_cache, q);
+	TAILQ_INSERT_HEAD(&session->dhhash[bucket], dhandle_cache, hashq);
 
 	if (dhandle_cachep != NULL)
 		*dhandle_cachep = dhandle_cache;
@@ -216,14 +219,18 @@ __wt_session_get_btree(WT_SESSION_IMPL *session,
 	WT_DATA_HANDLE *dhandle;
 	WT_DATA_HANDLE_CACHE *dhandle_cache;
 	WT_DECL_RET;
+	uint64_t bucket, hash;
 	int candidate;
 
 	dhandle = NULL;
 	candidate = 0;
 
-	TAILQ_FOREACH(dhandle_cache, &session->dhandles, q) {
+	hash = __wt_hash_city64(uri, (uint32_t)strlen(uri));
+	bucket = WT_DHANDLE_BUCKET(hash);
+	TAILQ_FOREACH(dhandle_cache, &session->dhhash[bucket], hashq) {
 		dhandle = dhandle_cache->dhandle;
-		if (strcmp(uri, dhandle->name) != 0)
+		if (hash != dhandle->name_hash ||
+		    strcmp(uri, dhandle->name) != 0)
 			continue;
 		if (checkpoint == NULL && dhandle->checkpoint == NULL)
 			break;
@@ -312,6 +319,8 @@ __wt_session_discard_btree(
 	WT_DECL_RET;
 
 	TAILQ_REMOVE(&session->dhandles, dhandle_cache, q);
+	TAILQ_REMOVE(&session->dhhash[WT_DHANDLE_BUCKET(
+	    dhandle_cache->dhandle->name_hash)], dhandle_cache, hashq);
 
 	saved_dhandle = session->dhandle;
 	session->dhandle = dhandle_cache->dhandle;
@@ -1080,8 +1080,8 @@ static const uint32_t g_crc_slicing[8][256] = {
 };
 
 /*
- * __wt_cksum --
- *	Return a checksum for a chunk of memory.
+ * __wt_cksum_sw --
+ *	Return a checksum for a chunk of memory, computed in software.
  *
  * Slicing-by-8 algorithm by Michael E. Kounavis and Frank L. Berry from
  * Intel Corp.:
@@ -1094,8 +1094,8 @@ static const uint32_t g_crc_slicing[8][256] = {
  * value of the crc is byte reversed from what it would be at that step for
  * little endian.
  */
-uint32_t
-__wt_cksum(const void *chunk, size_t len)
+static uint32_t
+__wt_cksum_sw(const void *chunk, size_t len)
 {
 	uint32_t crc, next;
 	size_t nqwords;
@@ -1158,3 +1158,78 @@ __wt_cksum(const void *chunk, size_t len)
 #endif
 	return (~crc);
 }
+
+#if (defined(__amd64) || defined(__x86_64)) && defined(__GNUC__)
+/*
+ * __wt_cksum_hw --
+ *	Return a checksum for a chunk of memory, computed with the SSE4.2 CRC32
+ * instruction.
+ *
+ * The tables used by the software version are for the CRC-32C (Castagnoli)
+ * polynomial, the polynomial the instruction implements, so the results are
+ * identical and files can be read and written by either version.
+ */
+static uint32_t
+__wt_cksum_hw(const void *chunk, size_t len)
+{
+	uint64_t crc64;
+	uint32_t crc;
+	size_t nqwords;
+	const uint8_t *p;
+	const uint64_t *p64;
+
+	crc = 0xffffffff;
+
+	/* Checksum one byte at a time to the first 8B boundary. */
+	for (p = chunk;
+	    ((uintptr_t)p & (sizeof(uint64_t) - 1)) != 0 &&
+	    len > 0; ++p, --len)
+		__asm__ __volatile__("crc32b %1, %0" : "+r" (crc) : "rm" (*p));
+
+	/* Checksum in 8B chunks. */
+	crc64 = crc;
+	for (p64 = (const uint64_t *)p,
+	    nqwords = len / sizeof(uint64_t); nqwords; nqwords--, ++p64)
+		__asm__ __volatile__(
+		    "crc32q %1, %0" : "+r" (crc64) : "rm" (*p64));
+	crc = (uint32_t)crc64;
+
+	/* Checksum trailing bytes one byte at a time. */
+	for (p = (const uint8_t *)p64, len &= 0x7; len > 0; ++p, len--)
+		__asm__ __volatile__("crc32b %1, %0" : "+r" (crc) : "rm" (*p));
+
+	return (~crc);
+}
+#endif
+
+/* The checksum function, set once at library initialization. */
+static uint32_t (*__wt_cksum_func)(const void *, size_t) = __wt_cksum_sw;
+
+/*
+ * __wt_cksum --
+ *	Return a checksum for a chunk of memory.
+ */
+uint32_t
+__wt_cksum(const void *chunk, size_t len)
+{
+	return ((*__wt_cksum_func)(chunk, len));
+}
+
+/*
+ * __wt_cksum_init --
+ *	Select the checksum function: use the CRC32 instruction if the CPU
+ * supports it.
+ */
+void
+__wt_cksum_init(void)
+{
+#if (defined(__amd64) || defined(__x86_64)) && defined(__GNUC__)
+#define	WT_CPUID_ECX_SSE42	(1 << 20)
+	uint32_t eax, ebx, ecx, edx;
+
+	__asm__ __volatile__("cpuid"
+	    : "=a" (eax), "=b" (ebx), "=c" (ecx), "=d" (edx) : "a" (1));
+	if (ecx & WT_CPUID_ECX_SSE42)
+		__wt_cksum_func = __wt_cksum_hw;
+#endif
+}
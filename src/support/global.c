@@ -17,6 +17,9 @@ __wt_pthread_once(void)
 
 	TAILQ_INIT(&__wt_process.connqh);
 
+	/* Select the checksum function. */
+	__wt_cksum_init();
+
 #ifdef HAVE_DIAGNOSTIC
 	/* Load debugging code the compiler might optimize out. */
 	(void)__wt_breakpoint();
@@ -76,8 +76,13 @@ __wt_hazard_set(WT_SESSION_IMPL *session, WT_REF *ref, int *busyp
 		hp->file = file;
 		hp->line = line;
 #endif
-		/* Publish the hazard pointer before reading page's state. */
-		WT_FULL_BARRIER();
+		/*
+		 * Pin the page in its reference, the eviction server checks the
+		 * reference's count after locking the page.  The atomic add is
+		 * a full barrier: it publishes the count before we read page's
+		 * state.
+		 */
+		(void)WT_ATOMIC_ADD(ref->pin_count, 1);
 
 		/*
 		 * Check if the page state is still valid, where valid means a
@@ -110,6 +115,7 @@ __wt_hazard_set(WT_SESSION_IMPL *session, WT_REF *ref, int *busyp
 		 * We don't bother publishing this update: the worst case is we
 		 * prevent some random page from being evicted.
 		 */
+		(void)WT_ATOMIC_SUB(ref->pin_count, 1);
 		hp->page = NULL;
 		*busyp = 1;
 		return (0);
@@ -163,6 +169,7 @@ __wt_hazard_clear(WT_SESSION_IMPL *session, WT_PAGE *page)
 			 * generation number was just set, so it's unlikely the
 			 * page will be selected for eviction.
 			 */
+			(void)WT_ATOMIC_SUB(page->ref->pin_count, 1);
 			hp->page = NULL;
 
 			/*
@@ -226,6 +233,8 @@ __wt_hazard_close(WT_SESSION_IMPL *session)
 	for (hp = session->hazard;
 	    hp < session->hazard + session->hazard_size; ++hp)
 		if (hp->page != NULL) {
+			if (hp->page->ref != NULL)
+				(void)WT_ATOMIC_SUB(hp->page->ref->pin_count, 1);
 			hp->page = NULL;
 			--session->nhazard;
 		}
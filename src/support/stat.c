@@ -6,6 +6,8 @@ void
 __wt_stat_init_dsrc_stats(WT_DSRC_STATS *stats)
 {
 	stats->block_alloc.desc = "blocks allocated";
+	stats->block_alloc_segregated.desc =
+	    "blocks allocated from the per-size free lists";
 	stats->block_allocsize.desc =
 	    "block manager file allocation unit size";
 	stats->block_checkpoint_size.desc = "checkpoint size";
@@ -15,6 +17,7 @@ __wt_stat_init_dsrc_stats(WT_DSRC_STATS *stats)
 	stats->block_magic.desc = "file magic number";
 	stats->block_major.desc = "file major version number";
 	stats->block_minor.desc = "minor version number";
+	stats->block_preallocate.desc = "file space preallocations";
 	stats->block_size.desc = "block manager file size in bytes";
 	stats->bloom_count.desc = "bloom filters in the LSM tree";
 	stats->bloom_false_positive.desc = "bloom filter false positives";
@@ -119,6 +122,7 @@ __wt_stat_clear_dsrc_stats(void *stats_arg)
 
 	stats = (WT_DSRC_STATS *)stats_arg;
 	stats->block_alloc.v = 0;
+	stats->block_alloc_segregated.v = 0;
 	stats->block_allocsize.v = 0;
 	stats->block_checkpoint_size.v = 0;
 	stats->block_extension.v = 0;
@@ -126,6 +130,7 @@ __wt_stat_clear_dsrc_stats(void *stats_arg)
 	stats->block_magic.v = 0;
 	stats->block_major.v = 0;
 	stats->block_minor.v = 0;
+	stats->block_preallocate.v = 0;
 	stats->block_size.v = 0;
 	stats->bloom_count.v = 0;
 	stats->bloom_false_positive.v = 0;
@@ -212,8 +217,11 @@ __wt_stat_init_connection_stats(WT_CONNECTION_STATS *stats)
 	stats->block_byte_read.desc = "bytes read by the block manager";
 	stats->block_byte_write.desc = "bytes written by the block manager";
 	stats->block_map_read.desc = "mapped blocks read by the block manager";
+	stats->block_preload.desc = "blocks pre-loaded by the block manager";
 	stats->block_read.desc = "blocks read by the block manager";
 	stats->block_write.desc = "blocks written by the block manager";
+	stats->block_write_background.desc =
+	    "blocks written by the block I/O threads";
 	stats->cache_bytes_dirty.desc =
 	    "cache: tracked dirty bytes in the cache";
 	stats->cache_bytes_inuse.desc = "cache: bytes currently in the cache";
@@ -247,6 +255,9 @@ __wt_stat_init_connection_stats(WT_CONNECTION_STATS *stats)
 	stats->cache_read.desc = "cache: pages read into cache";
 	stats->cache_write.desc = "cache: pages written from cache";
 	stats->cond_wait.desc = "pthread mutex condition wait calls";
+	stats->config_compiled_lookup.desc =
+	    "compiled configuration string lookups";
+	stats->cursor_cache_reuse.desc = "cursors reused from a session cache";
 	stats->cursor_create.desc = "cursor creation";
 	stats->cursor_insert.desc = "Btree cursor insert calls";
 	stats->cursor_next.desc = "Btree cursor next calls";
@@ -257,6 +268,246 @@ __wt_stat_init_connection_stats(WT_CONNECTION_STATS *stats)
 	stats->cursor_search_near.desc = "Btree cursor search near calls";
 	stats->cursor_update.desc = "Btree cursor update calls";
 	stats->file_open.desc = "files currently open";
+	stats->latency_evict_wait_00.desc =
+	    "latency: waiting for cache space 0-1us";
+	stats->latency_evict_wait_01.desc =
+	    "latency: waiting for cache space 1-2us";
+	stats->latency_evict_wait_02.desc =
+	    "latency: waiting for cache space 2-5us";
+	stats->latency_evict_wait_03.desc =
+	    "latency: waiting for cache space 5-10us";
+	stats->latency_evict_wait_04.desc =
+	    "latency: waiting for cache space 10-20us";
+	stats->latency_evict_wait_05.desc =
+	    "latency: waiting for cache space 20-50us";
+	stats->latency_evict_wait_06.desc =
+	    "latency: waiting for cache space 50-100us";
+	stats->latency_evict_wait_07.desc =
+	    "latency: waiting for cache space 100-200us";
+	stats->latency_evict_wait_08.desc =
+	    "latency: waiting for cache space 200-500us";
+	stats->latency_evict_wait_09.desc =
+	    "latency: waiting for cache space 500us-1ms";
+	stats->latency_evict_wait_10.desc =
+	    "latency: waiting for cache space 1-2ms";
+	stats->latency_evict_wait_11.desc =
+	    "latency: waiting for cache space 2-5ms";
+	stats->latency_evict_wait_12.desc =
+	    "latency: waiting for cache space 5-10ms";
+	stats->latency_evict_wait_13.desc =
+	    "latency: waiting for cache space 10-20ms";
+	stats->latency_evict_wait_14.desc =
+	    "latency: waiting for cache space 20-50ms";
+	stats->latency_evict_wait_15.desc =
+	    "latency: waiting for cache space 50-100ms";
+	stats->latency_evict_wait_16.desc =
+	    "latency: waiting for cache space 100-200ms";
+	stats->latency_evict_wait_17.desc =
+	    "latency: waiting for cache space 200-500ms";
+	stats->latency_evict_wait_18.desc =
+	    "latency: waiting for cache space 500ms-1s";
+	stats->latency_evict_wait_19.desc =
+	    "latency: waiting for cache space over 1s";
+	stats->latency_fsync_00.desc = "latency: file syncs 0-1us";
+	stats->latency_fsync_01.desc = "latency: file syncs 1-2us";
+	stats->latency_fsync_02.desc = "latency: file syncs 2-5us";
+	stats->latency_fsync_03.desc = "latency: file syncs 5-10us";
+	stats->latency_fsync_04.desc = "latency: file syncs 10-20us";
+	stats->latency_fsync_05.desc = "latency: file syncs 20-50us";
+	stats->latency_fsync_06.desc = "latency: file syncs 50-100us";
+	stats->latency_fsync_07.desc = "latency: file syncs 100-200us";
+	stats->latency_fsync_08.desc = "latency: file syncs 200-500us";
+	stats->latency_fsync_09.desc = "latency: file syncs 500us-1ms";
+	stats->latency_fsync_10.desc = "latency: file syncs 1-2ms";
+	stats->latency_fsync_11.desc = "latency: file syncs 2-5ms";
+	stats->latency_fsync_12.desc = "latency: file syncs 5-10ms";
+	stats->latency_fsync_13.desc = "latency: file syncs 10-20ms";
+	stats->latency_fsync_14.desc = "latency: file syncs 20-50ms";
+	stats->latency_fsync_15.desc = "latency: file syncs 50-100ms";
+	stats->latency_fsync_16.desc = "latency: file syncs 100-200ms";
+	stats->latency_fsync_17.desc = "latency: file syncs 200-500ms";
+	stats->latency_fsync_18.desc = "latency: file syncs 500ms-1s";
+	stats->latency_fsync_19.desc = "latency: file syncs over 1s";
+	stats->latency_insert_00.desc = "latency: Btree cursor inserts 0-1us";
+	stats->latency_insert_01.desc = "latency: Btree cursor inserts 1-2us";
+	stats->latency_insert_02.desc = "latency: Btree cursor inserts 2-5us";
+	stats->latency_insert_03.desc = "latency: Btree cursor inserts 5-10us";
+	stats->latency_insert_04.desc =
+	    "latency: Btree cursor inserts 10-20us";
+	stats->latency_insert_05.desc =
+	    "latency: Btree cursor inserts 20-50us";
+	stats->latency_insert_06.desc =
+	    "latency: Btree cursor inserts 50-100us";
+	stats->latency_insert_07.desc =
+	    "latency: Btree cursor inserts 100-200us";
+	stats->latency_insert_08.desc =
+	    "latency: Btree cursor inserts 200-500us";
+	stats->latency_insert_09.desc =
+	    "latency: Btree cursor inserts 500us-1ms";
+	stats->latency_insert_10.desc = "latency: Btree cursor inserts 1-2ms";
+	stats->latency_insert_11.desc = "latency: Btree cursor inserts 2-5ms";
+	stats->latency_insert_12.desc = "latency: Btree cursor inserts 5-10ms";
+	stats->latency_insert_13.desc =
+	    "latency: Btree cursor inserts 10-20ms";
+	stats->latency_insert_14.desc =
+	    "latency: Btree cursor inserts 20-50ms";
+	stats->latency_insert_15.desc =
+	    "latency: Btree cursor inserts 50-100ms";
+	stats->latency_insert_16.desc =
+	    "latency: Btree cursor inserts 100-200ms";
+	stats->latency_insert_17.desc =
+	    "latency: Btree cursor inserts 200-500ms";
+	stats->latency_insert_18.desc =
+	    "latency: Btree cursor inserts 500ms-1s";
+	stats->latency_insert_19.desc =
+	    "latency: Btree cursor inserts over 1s";
+	stats->latency_read_00.desc = "latency: file reads 0-1us";
+	stats->latency_read_01.desc = "latency: file reads 1-2us";
+	stats->latency_read_02.desc = "latency: file reads 2-5us";
+	stats->latency_read_03.desc = "latency: file reads 5-10us";
+	stats->latency_read_04.desc = "latency: file reads 10-20us";
+	stats->latency_read_05.desc = "latency: file reads 20-50us";
+	stats->latency_read_06.desc = "latency: file reads 50-100us";
+	stats->latency_read_07.desc = "latency: file reads 100-200us";
+	stats->latency_read_08.desc = "latency: file reads 200-500us";
+	stats->latency_read_09.desc = "latency: file reads 500us-1ms";
+	stats->latency_read_10.desc = "latency: file reads 1-2ms";
+	stats->latency_read_11.desc = "latency: file reads 2-5ms";
+	stats->latency_read_12.desc = "latency: file reads 5-10ms";
+	stats->latency_read_13.desc = "latency: file reads 10-20ms";
+	stats->latency_read_14.desc = "latency: file reads 20-50ms";
+	stats->latency_read_15.desc = "latency: file reads 50-100ms";
+	stats->latency_read_16.desc = "latency: file reads 100-200ms";
+	stats->latency_read_17.desc = "latency: file reads 200-500ms";
+	stats->latency_read_18.desc = "latency: file reads 500ms-1s";
+	stats->latency_read_19.desc = "latency: file reads over 1s";
+	stats->latency_remove_00.desc = "latency: Btree cursor removes 0-1us";
+	stats->latency_remove_01.desc = "latency: Btree cursor removes 1-2us";
+	stats->latency_remove_02.desc = "latency: Btree cursor removes 2-5us";
+	stats->latency_remove_03.desc = "latency: Btree cursor removes 5-10us";
+	stats->latency_remove_04.desc =
+	    "latency: Btree cursor removes 10-20us";
+	stats->latency_remove_05.desc =
+	    "latency: Btree cursor removes 20-50us";
+	stats->latency_remove_06.desc =
+	    "latency: Btree cursor removes 50-100us";
+	stats->latency_remove_07.desc =
+	    "latency: Btree cursor removes 100-200us";
+	stats->latency_remove_08.desc =
+	    "latency: Btree cursor removes 200-500us";
+	stats->latency_remove_09.desc =
+	    "latency: Btree cursor removes 500us-1ms";
+	stats->latency_remove_10.desc = "latency: Btree cursor removes 1-2ms";
+	stats->latency_remove_11.desc = "latency: Btree cursor removes 2-5ms";
+	stats->latency_remove_12.desc = "latency: Btree cursor removes 5-10ms";
+	stats->latency_remove_13.desc =
+	    "latency: Btree cursor removes 10-20ms";
+	stats->latency_remove_14.desc =
+	    "latency: Btree cursor removes 20-50ms";
+	stats->latency_remove_15.desc =
+	    "latency: Btree cursor removes 50-100ms";
+	stats->latency_remove_16.desc =
+	    "latency: Btree cursor removes 100-200ms";
+	stats->latency_remove_17.desc =
+	    "latency: Btree cursor removes 200-500ms";
+	stats->latency_remove_18.desc =
+	    "latency: Btree cursor removes 500ms-1s";
+	stats->latency_remove_19.desc =
+	    "latency: Btree cursor removes over 1s";
+	stats->latency_search_00.desc = "latency: Btree cursor searches 0-1us";
+	stats->latency_search_01.desc = "latency: Btree cursor searches 1-2us";
+	stats->latency_search_02.desc = "latency: Btree cursor searches 2-5us";
+	stats->latency_search_03.desc =
+	    "latency: Btree cursor searches 5-10us";
+	stats->latency_search_04.desc =
+	    "latency: Btree cursor searches 10-20us";
+	stats->latency_search_05.desc =
+	    "latency: Btree cursor searches 20-50us";
+	stats->latency_search_06.desc =
+	    "latency: Btree cursor searches 50-100us";
+	stats->latency_search_07.desc =
+	    "latency: Btree cursor searches 100-200us";
+	stats->latency_search_08.desc =
+	    "latency: Btree cursor searches 200-500us";
+	stats->latency_search_09.desc =
+	    "latency: Btree cursor searches 500us-1ms";
+	stats->latency_search_10.desc = "latency: Btree cursor searches 1-2ms";
+	stats->latency_search_11.desc = "latency: Btree cursor searches 2-5ms";
+	stats->latency_search_12.desc =
+	    "latency: Btree cursor searches 5-10ms";
+	stats->latency_search_13.desc =
+	    "latency: Btree cursor searches 10-20ms";
+	stats->latency_search_14.desc =
+	    "latency: Btree cursor searches 20-50ms";
+	stats->latency_search_15.desc =
+	    "latency: Btree cursor searches 50-100ms";
+	stats->latency_search_16.desc =
+	    "latency: Btree cursor searches 100-200ms";
+	stats->latency_search_17.desc =
+	    "latency: Btree cursor searches 200-500ms";
+	stats->latency_search_18.desc =
+	    "latency: Btree cursor searches 500ms-1s";
+	stats->latency_search_19.desc =
+	    "latency: Btree cursor searches over 1s";
+	stats->latency_update_00.desc = "latency: Btree cursor updates 0-1us";
+	stats->latency_update_01.desc = "latency: Btree cursor updates 1-2us";
+	stats->latency_update_02.desc = "latency: Btree cursor updates 2-5us";
+	stats->latency_update_03.desc = "latency: Btree cursor updates 5-10us";
+	stats->latency_update_04.desc =
+	    "latency: Btree cursor updates 10-20us";
+	stats->latency_update_05.desc =
+	    "latency: Btree cursor updates 20-50us";
+	stats->latency_update_06.desc =
+	    "latency: Btree cursor updates 50-100us";
+	stats->latency_update_07.desc =
+	    "latency: Btree cursor updates 100-200us";
+	stats->latency_update_08.desc =
+	    "latency: Btree cursor updates 200-500us";
+	stats->latency_update_09.desc =
+	    "latency: Btree cursor updates 500us-1ms";
+	stats->latency_update_10.desc = "latency: Btree cursor updates 1-2ms";
+	stats->latency_update_11.desc = "latency: Btree cursor updates 2-5ms";
+	stats->latency_update_12.desc = "latency: Btree cursor updates 5-10ms";
+	stats->latency_update_13.desc =
+	    "latency: Btree cursor updates 10-20ms";
+	stats->latency_update_14.desc =
+	    "latency: Btree cursor updates 20-50ms";
+	stats->latency_update_15.desc =
+	    "latency: Btree cursor updates 50-100ms";
+	stats->latency_update_16.desc =
+	    "latency: Btree cursor updates 100-200ms";
+	stats->latency_update_17.desc =
+	    "latency: Btree cursor updates 200-500ms";
+	stats->latency_update_18.desc =
+	    "latency: Btree cursor updates 500ms-1s";
+	stats->latency_update_19.desc =
+	    "latency: Btree cursor updates over 1s";
+	stats->latency_write_00.desc = "latency: file writes 0-1us";
+	stats->latency_write_01.desc = "latency: file writes 1-2us";
+	stats->latency_write_02.desc = "latency: file writes 2-5us";
+	stats->latency_write_03.desc = "latency: file writes 5-10us";
+	stats->latency_write_04.desc = "latency: file writes 10-20us";
+	stats->latency_write_05.desc = "latency: file writes 20-50us";
+	stats->latency_write_06.desc = "latency: file writes 50-100us";
+	stats->latency_write_07.desc = "latency: file writes 100-200us";
+	stats->latency_write_08.desc = "latency: file writes 200-500us";
+	stats->latency_write_09.desc = "latency: file writes 500us-1ms";
+	stats->latency_write_10.desc = "latency: file writes 1-2ms";
+	stats->latency_write_11.desc = "latency: file writes 2-5ms";
+	stats->latency_write_12.desc = "latency: file writes 5-10ms";
+	stats->latency_write_13.desc = "latency: file writes 10-20ms";
+	stats->latency_write_14.desc = "latency: file writes 20-50ms";
+	stats->latency_write_15.desc = "latency: file writes 50-100ms";
+	stats->latency_write_16.desc = "latency: file writes 100-200ms";
+	stats->latency_write_17.desc = "latency: file writes 200-500ms";
+	stats->latency_write_18.desc = "latency: file writes 500ms-1s";
+	stats->latency_write_19.desc = "latency: file writes over 1s";
+	stats->log_bytes_written.desc = "log: bytes written";
+	stats->log_records.desc = "log: records written";
+	stats->log_syncs.desc = "log: sync operations";
+	stats->log_writes.desc = "log: write operations";
+	stats->lsm_partitions_built.desc =
+	    "key ranges built by split LSM merges";
 	stats->lsm_rows_merged.desc = "rows merged in an LSM tree";
 	stats->memory_allocation.desc = "total heap memory allocations";
 	stats->memory_free.desc = "total heap memory frees";
@@ -290,8 +541,10 @@ __wt_stat_clear_connection_stats(void *stats_arg)
 	stats->block_byte_read.v = 0;
 	stats->block_byte_write.v = 0;
 	stats->block_map_read.v = 0;
+	stats->block_preload.v = 0;
 	stats->block_read.v = 0;
 	stats->block_write.v = 0;
+	stats->block_write_background.v = 0;
 	stats->cache_bytes_dirty.v = 0;
 	stats->cache_bytes_read.v = 0;
 	stats->cache_bytes_write.v = 0;
@@ -311,6 +564,8 @@ __wt_stat_clear_connection_stats(void *stats_arg)
 	stats->cache_read.v = 0;
 	stats->cache_write.v = 0;
 	stats->cond_wait.v = 0;
+	stats->config_compiled_lookup.v = 0;
+	stats->cursor_cache_reuse.v = 0;
 	stats->cursor_create.v = 0;
 	stats->cursor_insert.v = 0;
 	stats->cursor_next.v = 0;
@@ -320,6 +575,171 @@ __wt_stat_clear_connection_stats(void *stats_arg)
 	stats->cursor_search.v = 0;
 	stats->cursor_search_near.v = 0;
 	stats->cursor_update.v = 0;
+	stats->latency_evict_wait_00.v = 0;
+	stats->latency_evict_wait_01.v = 0;
+	stats->latency_evict_wait_02.v = 0;
+	stats->latency_evict_wait_03.v = 0;
+	stats->latency_evict_wait_04.v = 0;
+	stats->latency_evict_wait_05.v = 0;
+	stats->latency_evict_wait_06.v = 0;
+	stats->latency_evict_wait_07.v = 0;
+	stats->latency_evict_wait_08.v = 0;
+	stats->latency_evict_wait_09.v = 0;
+	stats->latency_evict_wait_10.v = 0;
+	stats->latency_evict_wait_11.v = 0;
+	stats->latency_evict_wait_12.v = 0;
+	stats->latency_evict_wait_13.v = 0;
+	stats->latency_evict_wait_14.v = 0;
+	stats->latency_evict_wait_15.v = 0;
+	stats->latency_evict_wait_16.v = 0;
+	stats->latency_evict_wait_17.v = 0;
+	stats->latency_evict_wait_18.v = 0;
+	stats->latency_evict_wait_19.v = 0;
+	stats->latency_fsync_00.v = 0;
+	stats->latency_fsync_01.v = 0;
+	stats->latency_fsync_02.v = 0;
+	stats->latency_fsync_03.v = 0;
+	stats->latency_fsync_04.v = 0;
+	stats->latency_fsync_05.v = 0;
+	stats->latency_fsync_06.v = 0;
+	stats->latency_fsync_07.v = 0;
+	stats->latency_fsync_08.v = 0;
+	stats->latency_fsync_09.v = 0;
+	stats->latency_fsync_10.v = 0;
+	stats->latency_fsync_11.v = 0;
+	stats->latency_fsync_12.v = 0;
+	stats->latency_fsync_13.v = 0;
+	stats->latency_fsync_14.v = 0;
+	stats->latency_fsync_15.v = 0;
+	stats->latency_fsync_16.v = 0;
+	stats->latency_fsync_17.v = 0;
+	stats->latency_fsync_18.v = 0;
+	stats->latency_fsync_19.v = 0;
+	stats->latency_insert_00.v = 0;
+	stats->latency_insert_01.v = 0;
+	stats->latency_insert_02.v = 0;
+	stats->latency_insert_03.v = 0;
+	stats->latency_insert_04.v = 0;
+	stats->latency_insert_05.v = 0;
+	stats->latency_insert_06.v = 0;
+	stats->latency_insert_07.v = 0;
+	stats->latency_insert_08.v = 0;
+	stats->latency_insert_09.v = 0;
+	stats->latency_insert_10.v = 0;
+	stats->latency_insert_11.v = 0;
+	stats->latency_insert_12.v = 0;
+	stats->latency_insert_13.v = 0;
+	stats->latency_insert_14.v = 0;
+	stats->latency_insert_15.v = 0;
+	stats->latency_insert_16.v = 0;
+	stats->latency_insert_17.v = 0;
+	stats->latency_insert_18.v = 0;
+	stats->latency_insert_19.v = 0;
+	stats->latency_read_00.v = 0;
+	stats->latency_read_01.v = 0;
+	stats->latency_read_02.v = 0;
+	stats->latency_read_03.v = 0;
+	stats->latency_read_04.v = 0;
+	stats->latency_read_05.v = 0;
+	stats->latency_read_06.v = 0;
+	stats->latency_read_07.v = 0;
+	stats->latency_read_08.v = 0;
+	stats->latency_read_09.v = 0;
+	stats->latency_read_10.v = 0;
+	stats->latency_read_11.v = 0;
+	stats->latency_read_12.v = 0;
+	stats->latency_read_13.v = 0;
+	stats->latency_read_14.v = 0;
+	stats->latency_read_15.v = 0;
+	stats->latency_read_16.v = 0;
+	stats->latency_read_17.v = 0;
+	stats->latency_read_18.v = 0;
+	stats->latency_read_19.v = 0;
+	stats->latency_remove_00.v = 0;
+	stats->latency_remove_01.v = 0;
+	stats->latency_remove_02.v = 0;
+	stats->latency_remove_03.v = 0;
+	stats->latency_remove_04.v = 0;
+	stats->latency_remove_05.v = 0;
+	stats->latency_remove_06.v = 0;
+	stats->latency_remove_07.v = 0;
+	stats->latency_remove_08.v = 0;
+	stats->latency_remove_09.v = 0;
+	stats->latency_remove_10.v = 0;
+	stats->latency_remove_11.v = 0;
+	stats->latency_remove_12.v = 0;
+	stats->latency_remove_13.v = 0;
+	stats->latency_remove_14.v = 0;
+	stats->latency_remove_15.v = 0;
+	stats->latency_remove_16.v = 0;
+	stats->latency_remove_17.v = 0;
+	stats->latency_remove_18.v = 0;
+	stats->latency_remove_19.v = 0;
+	stats->latency_search_00.v = 0;
+	stats->latency_search_01.v = 0;
+	stats->latency_search_02.v = 0;
+	stats->latency_search_03.v = 0;
+	stats->latency_search_04.v = 0;
+	stats->latency_search_05.v = 0;
+	stats->latency_search_06.v = 0;
+	stats->latency_search_07.v = 0;
+	stats->latency_search_08.v = 0;
+	stats->latency_search_09.v = 0;
+	stats->latency_search_10.v = 0;
+	stats->latency_search_11.v = 0;
+	stats->latency_search_12.v = 0;
+	stats->latency_search_13.v = 0;
+	stats->latency_search_14.v = 0;
+	stats->latency_search_15.v = 0;
+	stats->latency_search_16.v = 0;
+	stats->latency_search_17.v = 0;
+	stats->latency_search_18.v = 0;
+	stats->latency_search_19.v = 0;
+	stats->latency_update_00.v = 0;
+	stats->latency_update_01.v = 0;
+	stats->latency_update_02.v = 0;
+	stats->latency_update_03.v = 0;
+	stats->latency_update_04.v = 0;
+	stats->latency_update_05.v = 0;
+	stats->latency_update_06.v = 0;
+	stats->latency_update_07.v = 0;
+	stats->latency_update_08.v = 0;
+	stats->latency_update_09.v = 0;
+	stats->latency_update_10.v = 0;
+	stats->latency_update_11.v = 0;
+	stats->latency_update_12.v = 0;
+	stats->latency_update_13.v = 0;
+	stats->latency_update_14.v = 0;
+	stats->latency_update_15.v = 0;
+	stats->latency_update_16.v = 0;
+	stats->latency_update_17.v = 0;
+	stats->latency_update_18.v = 0;
+	stats->latency_update_19.v = 0;
+	stats->latency_write_00.v = 0;
+	stats->latency_write_01.v = 0;
+	stats->latency_write_02.v = 0;
+	stats->latency_write_03.v = 0;
+	stats->latency_write_04.v = 0;
+	stats->latency_write_05.v = 0;
+	stats->latency_write_06.v = 0;
+	stats->latency_write_07.v = 0;
+	stats->latency_write_08.v = 0;
+	stats->latency_write_09.v = 0;
+	stats->latency_write_10.v = 0;
+	stats->latency_write_11.v = 0;
+	stats->latency_write_12.v = 0;
+	stats->latency_write_13.v = 0;
+	stats->latency_write_14.v = 0;
+	stats->latency_write_15.v = 0;
+	stats->latency_write_16.v = 0;
+	stats->latency_write_17.v = 0;
+	stats->latency_write_18.v = 0;
+	stats->latency_write_19.v = 0;
+	stats->log_bytes_written.v = 0;
+	stats->log_records.v = 0;
+	stats->log_syncs.v = 0;
+	stats->log_writes.v = 0;
+	stats->lsm_partitions_built.v = 0;
 	stats->lsm_rows_merged.v = 0;
 	stats->memory_allocation.v = 0;
 	stats->memory_free.v = 0;
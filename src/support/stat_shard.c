@@ -0,0 +1,170 @@
+/*-
+ * Copyright (c) 2008-2013 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+/*
+ * __wt_stat_shard_count --
+ *	Return the number of slots for sharded statistics counters: one per
+ * CPU.
+ */
+u_int
+__wt_stat_shard_count(void)
+{
+	long n;
+
+	n = 1;
+#ifdef _SC_NPROCESSORS_ONLN
+	n = sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+	return (n < 1 ? 1 : (u_int)WT_MIN(n, WT_STAT_SHARDS_MAX));
+}
+
+/*
+ * __wt_stat_shard_init --
+ *	Allocate the sharded counters for a statistics structure, if they
+ * haven't already been allocated.
+ */
+int
+__wt_stat_shard_init(WT_SESSION_IMPL *session,
+    uint64_t **shardsp, u_int nshards, size_t stride)
+{
+	uint64_t *shards;
+	uint8_t *p;
+	void *mem;
+
+	if (*shardsp != NULL)
+		return (0);
+
+	/*
+	 * Align the slots to a cache line: allocate enough extra memory to
+	 * align the slots and to store the allocated address just before
+	 * them, for the free.
+	 */
+	WT_RET(__wt_calloc(session, 1,
+	    nshards * stride * sizeof(uint64_t) + sizeof(void *) +
+	    WT_STAT_SHARD_ALIGN, &mem));
+	p = (uint8_t *)(uintptr_t)WT_ALIGN(
+	    (uint8_t *)mem + sizeof(void *), WT_STAT_SHARD_ALIGN);
+	((void **)p)[-1] = mem;
+	shards = (uint64_t *)p;
+
+	/* Threads may be racing to allocate the slots, only one wins. */
+	if (!WT_ATOMIC_CAS(*shardsp, NULL, shards))
+		__wt_free(session, mem);
+	return (0);
+}
+
+/*
+ * __wt_stat_shard_discard --
+ *	Free the sharded counters for a statistics structure.
+ */
+void
+__wt_stat_shard_discard(WT_SESSION_IMPL *session, uint64_t **shardsp)
+{
+	void *mem;
+
+	if (*shardsp == NULL)
+		return;
+	mem = ((void **)*shardsp)[-1];
+	__wt_free(session, mem);
+	*shardsp = NULL;
+}
+
+/*
+ * __wt_stat_shard_sum --
+ *	Add the sharded counters to a copy of a statistics structure.
+ */
+void
+__wt_stat_shard_sum(WT_STATS *stats,
+    const uint64_t *shards, u_int nshards, size_t count, size_t stride)
+{
+	size_t i;
+	u_int slot;
+
+	if (shards == NULL)
+		return;
+	for (slot = 0; slot < nshards; ++slot, shards += stride)
+		for (i = 0; i < count; ++i)
+			stats[i].v += shards[i];
+}
+
+/*
+ * __wt_stat_shard_fold --
+ *	Move the sharded counters into a statistics structure, before it's
+ * cleared.
+ */
+void
+__wt_stat_shard_fold(WT_STATS *stats,
+    uint64_t *shards, u_int nshards, size_t count, size_t stride)
+{
+	size_t i;
+	uint64_t v;
+	u_int slot;
+
+	if (shards == NULL)
+		return;
+
+	/*
+	 * Threads may be incrementing the slots as we go, an increment racing
+	 * with the fold can be miscounted.  That's no worse than clearing the
+	 * statistics has always been, and statistics are never exact.
+	 */
+	for (slot = 0; slot < nshards; ++slot, shards += stride)
+		for (i = 0; i < count; ++i)
+			if ((v = shards[i]) != 0) {
+				shards[i] = 0;
+				stats[i].v += v;
+			}
+}
+
+/*
+ * Latency histogram bucket limits in microseconds: each bucket counts the
+ * operations taking less than its limit and at least the previous bucket's
+ * limit, the last bucket counts everything slower.  The limits step 1, 2, 5
+ * through each power of ten, and must match dist/stat_data.py.
+ */
+static const uint64_t __stat_latency_limits[WT_STAT_LATENCY_BUCKETS - 1] = {
+	1, 2, 5, 10, 20, 50, 100, 200, 500,
+	1000, 2000, 5000, 10000, 20000, 50000, 100000, 200000, 500000,
+	1000000
+};
+
+/*
+ * __wt_stat_latency --
+ *	Add the time since an operation started to a connection latency
+ * histogram.
+ */
+void
+__wt_stat_latency(
+    WT_SESSION_IMPL *session, size_t key, const struct timespec *start)
+{
+	struct timespec now;
+	WT_CONNECTION_IMPL *conn;
+	uint64_t *shards, usecs;
+	u_int bucket;
+
+	if (__wt_epoch(session, &now) != 0)
+		return;
+
+	/* The clock isn't monotonic, treat it going backward as no time. */
+	usecs = now.tv_sec < start->tv_sec ||
+	    (now.tv_sec == start->tv_sec && now.tv_nsec < start->tv_nsec) ?
+	    0 : WT_TIMEDIFF(now, *start) / 1000;
+	for (bucket = 0; bucket < WT_STAT_LATENCY_BUCKETS - 1 &&
+	    usecs >= __stat_latency_limits[bucket]; ++bucket)
+		;
+
+	conn = S2C(session);
+	if ((shards = conn->stats_shards) == NULL)
+		(void)WT_ATOMIC_ADD(
+		    ((WT_STATS *)&conn->stats)[key + bucket].v, 1);
+	else
+		(void)WT_ATOMIC_ADD(shards[(session->id % conn->stat_shards) *
+		    WT_STAT_SHARD_STRIDE(WT_CONNECTION_STATS) + key + bucket],
+		    1);
+}
@@ -55,6 +55,7 @@ __wt_txn_release_snapshot(WT_SESSION_IMPL *session)
 
 	txn_state = &S2C(session)->txn_global.states[session->id];
 	txn_state->snap_min = WT_TXN_NONE;
+	__wt_txn_state_clear(session);
 }
 
 /*
@@ -80,13 +81,10 @@ __wt_txn_get_oldest(WT_SESSION_IMPL *session)
 	    (txn->id != WT_TXN_NONE) ? txn->id : txn_global->current;
 
 	WT_ORDERED_READ(session_cnt, conn->session_cnt);
-	for (i = 0, s = txn_global->states;
-	    i < session_cnt;
-	    i++, s++) {
+	for (i = 0; (s = __wt_txn_state_next(conn, &i, session_cnt)) != NULL;)
 		if ((id = s->snap_min) != WT_TXN_NONE &&
 		    TXNID_LT(id, oldest_snap_min))
 			oldest_snap_min = id;
-	}
 
 	txn->oldest_snap_min = oldest_snap_min;
 }
@@ -114,6 +112,7 @@ __wt_txn_get_snapshot(
 	/* If nothing has changed since last time, we're done. */
 	if (!force && txn->last_id == txn_global->current &&
 	    txn->last_gen == txn_global->gen) {
+		__wt_txn_state_set(session);
 		txn_state->snap_min = txn->snap_min;
 		return;
 	}
@@ -126,11 +125,10 @@ __wt_txn_get_snapshot(
 
 		/* Copy the array of concurrent transactions. */
 		WT_ORDERED_READ(session_cnt, conn->session_cnt);
-		for (i = n = 0, s = txn_global->states;
-		    i < session_cnt;
-		    i++, s++) {
+		for (i = n = 0;
+		    (s = __wt_txn_state_next(conn, &i, session_cnt)) != NULL;) {
 			/* Ignore the session's own transaction. */
-			if (i == session->id)
+			if (s == txn_state)
 				continue;
 			if ((id = s->snap_min) != WT_TXN_NONE)
 				if (TXNID_LT(id, oldest_snap_min))
@@ -151,6 +149,7 @@ __wt_txn_get_snapshot(
 	__txn_sort_snapshot(session, n,
 	    (max_id != WT_TXN_NONE) ? max_id : current_id,
 	    oldest_snap_min);
+	__wt_txn_state_set(session);
 	txn_state->snap_min =
 	    (my_id == WT_TXN_NONE || TXNID_LT(txn->snap_min, my_id)) ?
 	    txn->snap_min : my_id;
@@ -179,6 +178,20 @@ __wt_txn_get_evict_snapshot(WT_SESSION_IMPL *session)
 	 */
 }
 
+/*
+ * __wt_txn_sync_config --
+ *	Return the commit durability for a "sync" configuration value.
+ */
+WT_TXN_SYNC
+__wt_txn_sync_config(WT_CONFIG_ITEM *cval)
+{
+	return (WT_STRING_MATCH("none", cval->str, cval->len) ?
+	    TXN_SYNC_NONE :
+	    WT_STRING_MATCH("write", cval->str, cval->len) ? TXN_SYNC_WRITE :
+	    WT_STRING_MATCH("flush", cval->str, cval->len) ? TXN_SYNC_FLUSH :
+	    TXN_SYNC_FULL);
+}
+
 /*
  * __wt_txn_begin --
  *	Begin a transaction.
@@ -211,6 +224,10 @@ __wt_txn_begin(WT_SESSION_IMPL *session, const char *cfg[])
 		    WT_STRING_MATCH("read-committed", cval.str, cval.len) ?
 		    TXN_ISO_READ_COMMITTED : TXN_ISO_READ_UNCOMMITTED;
 
+	WT_RET(__wt_config_gets_defno(session, cfg, "sync", &cval));
+	txn->sync = cval.len == 0 ?
+	    txn_global->sync : __wt_txn_sync_config(&cval);
+
 	F_SET(txn, TXN_RUNNING);
 
 	do {
@@ -234,6 +251,7 @@ __wt_txn_begin(WT_SESSION_IMPL *session, const char *cfg[])
 		do {
 			txn->id = WT_ATOMIC_ADD(txn_global->current, 1);
 		} while (txn->id == WT_TXN_NONE || txn->id == WT_TXN_ABORTED);
+		__wt_txn_state_set(session);
 		WT_PUBLISH(txn_state->id, txn->id);
 
 		/*
@@ -250,9 +268,8 @@ __wt_txn_begin(WT_SESSION_IMPL *session, const char *cfg[])
 
 			/* Copy the array of concurrent transactions. */
 			WT_ORDERED_READ(session_cnt, conn->session_cnt);
-			for (i = n = 0, s = txn_global->states;
-			    i < session_cnt;
-			    i++, s++) {
+			for (i = n = 0; (s = __wt_txn_state_next(
+			    conn, &i, session_cnt)) != NULL;) {
 				if ((id = s->snap_min) != WT_TXN_NONE)
 					if (TXNID_LT(id, oldest_snap_min))
 						oldest_snap_min = id;
@@ -290,6 +307,7 @@ __wt_txn_release(WT_SESSION_IMPL *session)
 
 	txn = &session->txn;
 	txn->mod_count = txn->modref_count = 0;
+	txn->logrec.size = 0;
 	txn_global = &S2C(session)->txn_global;
 	txn_state = &txn_global->states[session->id];
 
@@ -297,8 +315,13 @@ __wt_txn_release(WT_SESSION_IMPL *session)
 	WT_ASSERT(session, txn_state->id != WT_TXN_NONE &&
 	    txn->id != WT_TXN_NONE);
 	WT_PUBLISH(txn_state->id, WT_TXN_NONE);
+	__wt_txn_state_clear(session);
 	txn->id = WT_TXN_NONE;
 
+	/* The commit is visible, checkpoints no longer need its LSN. */
+	if (txn->commit_lsn != WT_LOG_INVALID_LSN)
+		WT_PUBLISH(txn->commit_lsn, WT_LOG_INVALID_LSN);
+
 	/*
 	 * Reset the transaction state to not running.
 	 *
@@ -321,9 +344,9 @@ __wt_txn_release(WT_SESSION_IMPL *session)
 int
 __wt_txn_commit(WT_SESSION_IMPL *session, const char *cfg[])
 {
+	WT_DECL_RET;
 	WT_TXN *txn;
-
-	WT_UNUSED(cfg);
+	WT_TXN_SYNC sync;
 
 	txn = &session->txn;
 	WT_ASSERT(session, !F_ISSET(txn, TXN_ERROR));
@@ -331,6 +354,22 @@ __wt_txn_commit(WT_SESSION_IMPL *session, const char *cfg[])
 	if (!F_ISSET(txn, TXN_RUNNING))
 		WT_RET_MSG(session, EINVAL, "No transaction is active");
 
+	/*
+	 * Check the commit configuration before doing any work: if it's not
+	 * valid, the transaction is still running, and the application can
+	 * commit it again or roll it back.
+	 */
+	WT_RET(__wt_txn_log_sync(session, cfg, &sync));
+
+	/*
+	 * Write the transaction's updates to the log: if that fails, the
+	 * transaction is rolled back.
+	 */
+	if ((ret = __wt_txn_log_commit(session, sync)) != 0) {
+		WT_TRET(__wt_txn_rollback(session, cfg));
+		return (ret);
+	}
+
 	/*
 	 * Auto-commit transactions need a new transaction snapshot so that the
 	 * committed changes are visible to subsequent reads.  However, cursor
@@ -386,6 +425,7 @@ __wt_txn_init(WT_SESSION_IMPL *session)
 
 	txn = &session->txn;
 	txn->id = WT_TXN_NONE;
+	txn->commit_lsn = WT_LOG_INVALID_LSN;
 
 	WT_RET(__wt_calloc_def(session,
 	    S2C(session)->session_size, &txn->snapshot));
@@ -413,6 +453,7 @@ __wt_txn_destroy(WT_SESSION_IMPL *session)
 	WT_TXN *txn;
 
 	txn = &session->txn;
+	__wt_buf_free(session, &txn->logrec);
 	__wt_free(session, txn->mod);
 	__wt_free(session, txn->modref);
 	__wt_free(session, txn->snapshot);
@@ -425,18 +466,23 @@ __wt_txn_destroy(WT_SESSION_IMPL *session)
 int
 __wt_txn_global_init(WT_CONNECTION_IMPL *conn, const char *cfg[])
 {
+	WT_CONFIG_ITEM cval;
 	WT_SESSION_IMPL *session;
 	WT_TXN_GLOBAL *txn_global;
 	WT_TXN_STATE *s;
 	u_int i;
 
-	WT_UNUSED(cfg);
 	session = conn->default_session;
 	txn_global = &conn->txn_global;
 	txn_global->current = 1;
 
+	WT_RET(__wt_config_gets(session, cfg, "transaction_sync", &cval));
+	txn_global->sync = __wt_txn_sync_config(&cval);
+
 	WT_RET(__wt_calloc_def(
 	    session, conn->session_size, &txn_global->states));
+	WT_RET(__wt_calloc_def(session,
+	    WT_TXN_STATE_WORDS(conn->session_size), &txn_global->state_map));
 	for (i = 0, s = txn_global->states; i < conn->session_size; i++, s++)
 		s->id = s->snap_min = WT_TXN_NONE;
 
@@ -456,6 +502,8 @@ __wt_txn_global_destroy(WT_CONNECTION_IMPL *conn)
 	session = conn->default_session;
 	txn_global = &conn->txn_global;
 
-	if (txn_global != NULL)
+	if (txn_global != NULL) {
 		__wt_free(session, txn_global->states);
+		__wt_free(session, txn_global->state_map);
+	}
 }
@@ -7,6 +7,7 @@
 
 #include "wt_internal.h"
 
+static int __checkpoint_mark_dirty(WT_SESSION_IMPL *, const char *[]);
 static int __checkpoint_sync(WT_SESSION_IMPL *, const char *[]);
 static int __checkpoint_write_leaves(WT_SESSION_IMPL *, const char *[]);
 
@@ -117,7 +118,12 @@ __wt_txn_checkpoint(WT_SESSION_IMPL *session, const char *cfg[])
 	WT_ERR(__wt_meta_track_on(session));
 	tracking = 1;
 
-	/* Start a snapshot transaction for the checkpoint. */
+	/*
+	 * Start a snapshot transaction for the checkpoint.  Recovery of the
+	 * files in the checkpoint starts from the log position before the
+	 * snapshot is taken.
+	 */
+	__wt_log_ckpt_lsn(session, &txn->ckpt_lsn);
 	wt_session = &session->iface;
 	WT_ERR(wt_session->begin_transaction(wt_session, "isolation=snapshot"));
 
@@ -175,6 +181,15 @@ err:	/*
 	if (tracking)
 		WT_TRET(__wt_meta_track_off(session, ret != 0));
 
+	/*
+	 * The files' modified flags were cleared when they were checkpointed:
+	 * if the checkpoint failed (for example, a file's queued writes failed
+	 * when it was synced), set them again so the next checkpoint doesn't
+	 * skip the files.
+	 */
+	if (ret != 0)
+		(void)__checkpoint_apply(session, cfg, __checkpoint_mark_dirty);
+
 	if (F_ISSET(txn, TXN_RUNNING))
 		__wt_txn_release(session);
 	__wt_spin_unlock(session, &conn->metadata_lock);
@@ -313,6 +328,7 @@ __checkpoint_worker(
 	WT_DECL_RET;
 	WT_TXN *txn;
 	WT_TXN_ISOLATION saved_isolation;
+	off_t ckpt_lsn;
 	const char *name;
 	int deleted, force, track_ckpt;
 	char *name_alloc;
@@ -405,6 +421,16 @@ __checkpoint_worker(
 	/* Drop checkpoints with the same name as the one we're taking. */
 	__drop(ckptbase, name, strlen(name));
 
+	/*
+	 * Find the LSN from which recovery must replay the log for this file:
+	 * a snapshot checkpoint uses the LSN found before its snapshot was
+	 * taken, otherwise, everything committed before now is written.
+	 */
+	if (is_checkpoint && F_ISSET(txn, TXN_RUNNING))
+		ckpt_lsn = txn->ckpt_lsn;
+	else
+		__wt_log_ckpt_lsn(session, &ckpt_lsn);
+
 	/*
 	 * Check for clean objects not requiring a checkpoint.
 	 *
@@ -630,7 +656,8 @@ __checkpoint_worker(
 fake:
 	/* Update the object's metadata. */
 	txn->isolation = TXN_ISO_READ_UNCOMMITTED;
-	ret = __wt_meta_ckptlist_set(session, dhandle->name, ckptbase);
+	ret = __wt_meta_ckptlist_set(
+	    session, dhandle->name, ckptbase, ckpt_lsn);
 	WT_ERR(ret);
 
 	/*
@@ -680,6 +707,19 @@ __checkpoint_write_leaves(WT_SESSION_IMPL *session, const char *cfg[])
 	return (0);
 }
 
+/*
+ * __checkpoint_mark_dirty --
+ *	Mark a file modified after a failed checkpoint.
+ */
+static int
+__checkpoint_mark_dirty(WT_SESSION_IMPL *session, const char *cfg[])
+{
+	WT_UNUSED(cfg);
+
+	S2BT(session)->modified = 1;
+	return (0);
+}
+
 /*
  * __checkpoint_sync --
  *	Sync a file that has been checkpointed.
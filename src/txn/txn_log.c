@@ -0,0 +1,111 @@
+/*-
+ * Copyright (c) 2008-2013 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+/*
+ * __wt_txn_log_op --
+ *	Add an update to the running transaction's log record: row-store updates
+ * pass a key, column-store updates pass a record number; removes pass a NULL
+ * value.
+ */
+int
+__wt_txn_log_op(WT_SESSION_IMPL *session,
+    WT_BTREE *btree, WT_ITEM *key, uint64_t recno, WT_ITEM *value)
+{
+	WT_TXN *txn;
+	const char *uri;
+
+	txn = &session->txn;
+
+	/*
+	 * Only transactional updates are logged.  Metadata updates are made
+	 * durable by checkpointing the metadata when schema operations
+	 * complete.
+	 */
+	if (!F_ISSET(S2C(session), WT_CONN_LOGGING) ||
+	    !F_ISSET(txn, TXN_RUNNING) || txn->sync == TXN_SYNC_NONE ||
+	    btree == session->metafile)
+		return (0);
+
+	uri = btree->dhandle->name;
+	if (key == NULL)
+		return (value == NULL ?
+		    __wt_logop_col_remove_pack(session, &txn->logrec,
+		    uri, recno) :
+		    __wt_logop_col_put_pack(session, &txn->logrec,
+		    uri, recno, value));
+	return (value == NULL ?
+	    __wt_logop_row_remove_pack(session, &txn->logrec, uri, key) :
+	    __wt_logop_row_put_pack(session, &txn->logrec, uri, key, value));
+}
+
+/*
+ * __wt_txn_log_sync --
+ *	Return the durability of a committing transaction, checking any
+ * override in the commit configuration.
+ */
+int
+__wt_txn_log_sync(
+    WT_SESSION_IMPL *session, const char *cfg[], WT_TXN_SYNC *syncp)
+{
+	WT_CONFIG_ITEM cval;
+	WT_TXN *txn;
+	WT_TXN_SYNC sync;
+
+	txn = &session->txn;
+	*syncp = txn->sync;
+
+	if (!F_ISSET(S2C(session), WT_CONN_LOGGING))
+		return (0);
+
+	/*
+	 * The commit can override the transaction's durability, but updates
+	 * made by a transaction that began without logging weren't recorded,
+	 * and can't be made durable now.
+	 */
+	WT_RET(__wt_config_gets_defno(session, cfg, "sync", &cval));
+	sync = cval.len == 0 ? txn->sync : __wt_txn_sync_config(&cval);
+	if (txn->sync == TXN_SYNC_NONE &&
+	    sync != TXN_SYNC_NONE && txn->mod_count != 0)
+		WT_RET_MSG(session, EINVAL,
+		    "a transaction begun with sync=none cannot commit with "
+		    "sync=%.*s", (int)cval.len, cval.str);
+
+	*syncp = sync;
+	return (0);
+}
+
+/*
+ * __wt_txn_log_commit --
+ *	Write the log record for a committing transaction.
+ */
+int
+__wt_txn_log_commit(WT_SESSION_IMPL *session, WT_TXN_SYNC sync)
+{
+	WT_TXN *txn;
+	uint32_t flags;
+
+	txn = &session->txn;
+
+	if (!F_ISSET(S2C(session), WT_CONN_LOGGING))
+		return (0);
+
+	/* Read-only transactions don't write log records. */
+	if (sync == TXN_SYNC_NONE || txn->logrec.size == 0)
+		return (0);
+
+	/*
+	 * Wait for the record to be synced to stable storage or written to the
+	 * log file, or leave it buffered for a later commit or the log server
+	 * to write.  Concurrent commits share the write and sync.
+	 */
+	flags = sync == TXN_SYNC_FULL ? WT_LOG_FSYNC :
+	    sync == TXN_SYNC_FLUSH ? WT_LOG_FLUSH : 0;
+	return (__wt_logput_commit(
+	    session, &txn->commit_lsn, flags, txn->id, &txn->logrec));
+}
@@ -0,0 +1,450 @@
+/*-
+ * Copyright (c) 2008-2013 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+/*
+ * Recovery reads the log in a single thread and hands each file's updates to
+ * one of a set of worker threads, so updates to different files are replayed
+ * in parallel and updates to each file are replayed in log order.
+ */
+#define	WT_RECOVER_THREADS	4
+
+/* The log is read in batches: updates are replayed when a batch fills. */
+#define	WT_RECOVER_BATCH	(8 * WT_MEGABYTE)
+
+/* A file named in the log. */
+typedef struct {
+	const char *uri;			/* File URI */
+	uint64_t hash;				/* URI hash */
+	off_t	 ckpt_lsn;			/* Replay from this LSN */
+	int	 dropped;			/* File no longer exists */
+} WT_RECOVER_FILE;
+
+struct __wt_recover;
+typedef struct __wt_recover WT_RECOVER;
+
+/* A recovery worker thread. */
+typedef struct {
+	WT_RECOVER *r;				/* Enclosing recovery */
+	WT_SESSION_IMPL *session;		/* Worker's session */
+
+	WT_ITEM	 ops;				/* Queued updates */
+
+	WT_CURSOR **cursors;			/* Cursors, indexed by file */
+	size_t	 cursors_alloc;
+
+	uint64_t applied;			/* Updates replayed */
+	int	 ret;				/* Worker's return */
+} WT_RECOVER_WORKER;
+
+struct __wt_recover {
+	WT_RECOVER_FILE *files;			/* Files named in the log */
+	size_t	 files_alloc;
+	u_int	 files_next;
+
+	WT_RECOVER_WORKER workers[WT_RECOVER_THREADS];
+
+	size_t	 queued;			/* Bytes queued in the batch */
+	uint64_t records;			/* Commit records read */
+};
+
+/*
+ * __recover_file_add --
+ *	Add a file to the list of files being recovered.
+ */
+static int
+__recover_file_add(WT_SESSION_IMPL *session,
+    WT_RECOVER *r, const char *uri, size_t len, off_t ckpt_lsn, int dropped)
+{
+	WT_RECOVER_FILE *f;
+
+	if ((r->files_next + 1) * sizeof(WT_RECOVER_FILE) > r->files_alloc)
+		WT_RET(__wt_realloc(session, &r->files_alloc,
+		    WT_MAX(10, 2 * r->files_next) * sizeof(WT_RECOVER_FILE),
+		    &r->files));
+	f = &r->files[r->files_next];
+
+	WT_RET(__wt_strndup(session, uri, len, &f->uri));
+	f->hash = __wt_hash_fnv64(uri, (uint32_t)len);
+	f->ckpt_lsn = ckpt_lsn;
+	f->dropped = dropped;
+	++r->files_next;
+	return (0);
+}
+
+/*
+ * __recover_file_load --
+ *	Load the list of files from the metadata, returning the LSN from which
+ * the log must be replayed.
+ */
+static int
+__recover_file_load(WT_SESSION_IMPL *session, WT_RECOVER *r, off_t *startp)
+{
+	WT_CONFIG_ITEM cval;
+	WT_CURSOR *cursor;
+	WT_DECL_RET;
+	off_t ckpt_lsn;
+	int cmp, tret;
+	const char *config, *uri;
+
+	*startp = WT_LOG_INVALID_LSN;
+
+	WT_RET(__wt_metadata_cursor(session, NULL, &cursor));
+	cursor->set_key(cursor, "file:");
+	if ((tret = cursor->search_near(cursor, &cmp)) == 0 && cmp < 0)
+		tret = cursor->next(cursor);
+	for (; tret == 0; tret = cursor->next(cursor)) {
+		WT_ERR(cursor->get_key(cursor, &uri));
+		if (!WT_PREFIX_MATCH(uri, "file:"))
+			break;
+		WT_ERR(cursor->get_value(cursor, &config));
+
+		/* Files created by older releases are recovered in full. */
+		ckpt_lsn = 0;
+		if ((ret = __wt_config_getones(
+		    session, config, "checkpoint_lsn", &cval)) == 0)
+			ckpt_lsn = (off_t)cval.val;
+		WT_ERR_NOTFOUND_OK(ret);
+
+		WT_ERR(__recover_file_add(
+		    session, r, uri, strlen(uri), ckpt_lsn, 0));
+		if (*startp == WT_LOG_INVALID_LSN || ckpt_lsn < *startp)
+			*startp = ckpt_lsn;
+	}
+
+	if (tret != WT_NOTFOUND)
+		WT_TRET(tret);
+err:	WT_TRET(cursor->close(cursor));
+	return (ret);
+}
+
+/*
+ * __recover_file_find --
+ *	Find a file named in the log.
+ */
+static int
+__recover_file_find(WT_SESSION_IMPL *session,
+    WT_RECOVER *r, const char *uri, size_t len, u_int *idp)
+{
+	WT_RECOVER_FILE *f;
+	uint64_t hash;
+	u_int i;
+
+	hash = __wt_hash_fnv64(uri, (uint32_t)len);
+	for (i = 0, f = r->files; i < r->files_next; ++i, ++f)
+		if (f->hash == hash && WT_STRING_MATCH(f->uri, uri, len)) {
+			*idp = i;
+			return (0);
+		}
+
+	/*
+	 * The file was dropped after the record was written: remember it so we
+	 * don't look for it again.
+	 */
+	WT_RET(__recover_file_add(session, r, uri, len, 0, 1));
+	*idp = i;
+	return (0);
+}
+
+/*
+ * __recover_cursor --
+ *	Return a worker's cursor for a file, opening it if necessary.
+ */
+static int
+__recover_cursor(WT_RECOVER_WORKER *w, u_int id, WT_CURSOR **cursorp)
+{
+	WT_SESSION_IMPL *session;
+	const char *cfg[3];
+
+	session = w->session;
+
+	if ((id + 1) * sizeof(WT_CURSOR *) > w->cursors_alloc)
+		WT_RET(__wt_realloc(session, &w->cursors_alloc,
+		    (id + 10) * sizeof(WT_CURSOR *), &w->cursors));
+
+	if (w->cursors[id] == NULL) {
+		cfg[0] = WT_CONFIG_BASE(session, session_open_cursor);
+		cfg[1] = "overwrite";
+		cfg[2] = NULL;
+		WT_RET(__wt_curfile_open(session,
+		    w->r->files[id].uri, NULL, cfg, &w->cursors[id]));
+	}
+	*cursorp = w->cursors[id];
+	return (0);
+}
+
+/*
+ * __recover_apply --
+ *	Replay a worker's queued updates.
+ */
+static int
+__recover_apply(WT_RECOVER_WORKER *w)
+{
+	WT_CURSOR *cursor;
+	WT_DECL_RET;
+	WT_ITEM key, value;
+	WT_SESSION_IMPL *session;
+	uint64_t recno;
+	uint32_t id, optype, opsize;
+	const uint8_t *end, *p;
+	const char *uri;
+
+	session = w->session;
+
+	/* Each update is a file ID followed by a log operation. */
+	p = w->ops.data;
+	end = p + w->ops.size;
+	while (p < end) {
+		memcpy(&id, p, sizeof(id));
+		p += sizeof(id);
+		WT_ERR(__recover_cursor(w, id, &cursor));
+
+		WT_ERR(__wt_logop_read(session, &p, end, &optype, &opsize));
+		switch (optype) {
+		case WT_LOGOP_COL_PUT:
+			WT_ERR(__wt_logop_col_put_unpack(
+			    session, &p, end, &uri, &recno, &value));
+			break;
+		case WT_LOGOP_COL_REMOVE:
+			WT_ERR(__wt_logop_col_remove_unpack(
+			    session, &p, end, &uri, &recno));
+			break;
+		case WT_LOGOP_ROW_PUT:
+			WT_ERR(__wt_logop_row_put_unpack(
+			    session, &p, end, &uri, &key, &value));
+			break;
+		case WT_LOGOP_ROW_REMOVE:
+			WT_ERR(__wt_logop_row_remove_unpack(
+			    session, &p, end, &uri, &key));
+			break;
+		WT_ILLEGAL_VALUE_ERR(session);
+		}
+
+		if (optype == WT_LOGOP_COL_PUT ||
+		    optype == WT_LOGOP_COL_REMOVE) {
+			cursor->recno = recno;
+			cursor->key.data = &cursor->recno;
+			cursor->key.size = sizeof(cursor->recno);
+		} else {
+			cursor->key.data = key.data;
+			cursor->key.size = key.size;
+		}
+		F_SET(cursor, WT_CURSTD_KEY_APP);
+
+		if (optype == WT_LOGOP_COL_PUT ||
+		    optype == WT_LOGOP_ROW_PUT) {
+			cursor->value.data = value.data;
+			cursor->value.size = value.size;
+			F_SET(cursor, WT_CURSTD_VALUE_APP);
+			WT_ERR(cursor->insert(cursor));
+		} else
+			WT_ERR_NOTFOUND_OK(cursor->remove(cursor));
+		++w->applied;
+	}
+
+err:	w->ops.size = 0;
+	return (ret);
+}
+
+/*
+ * __recover_worker --
+ *	Recovery worker thread.
+ */
+static void *
+__recover_worker(void *arg)
+{
+	WT_RECOVER_WORKER *w;
+
+	w = arg;
+	if ((w->ret = __recover_apply(w)) != 0)
+		__wt_err(w->session, w->ret, "log recovery worker failed");
+	return (NULL);
+}
+
+/*
+ * __recover_batch --
+ *	Replay the updates queued for the worker threads.
+ */
+static int
+__recover_batch(WT_SESSION_IMPL *session, WT_RECOVER *r)
+{
+	WT_DECL_RET;
+	WT_RECOVER_WORKER *w;
+	pthread_t tids[WT_RECOVER_THREADS];
+	uint64_t applied;
+	u_int i;
+	int running[WT_RECOVER_THREADS];
+
+	memset(running, 0, sizeof(running));
+	for (i = 0, w = r->workers; i < WT_RECOVER_THREADS; ++i, ++w) {
+		if (w->ops.size == 0)
+			continue;
+		WT_ERR(__wt_thread_create(
+		    session, &tids[i], __recover_worker, w));
+		running[i] = 1;
+	}
+
+err:	applied = 0;
+	for (i = 0, w = r->workers; i < WT_RECOVER_THREADS; ++i, ++w) {
+		if (running[i]) {
+			WT_TRET(__wt_thread_join(session, tids[i]));
+			WT_TRET(w->ret);
+		}
+		applied += w->applied;
+	}
+	r->queued = 0;
+
+	WT_RET(ret);
+	WT_VERBOSE_RET(session, recovery,
+	    "%" PRIu64 " commits read, %" PRIu64 " updates replayed",
+	    r->records, applied);
+	return (__wt_progress(session, "recovery", r->records));
+}
+
+/*
+ * __recover_record --
+ *	Queue the updates in a log record for replay.
+ */
+static int
+__recover_record(
+    WT_SESSION_IMPL *session, WT_ITEM *record, off_t lsn, void *cookie)
+{
+	WT_ITEM ops;
+	WT_RECOVER *r;
+	WT_RECOVER_FILE *f;
+	WT_RECOVER_WORKER *w;
+	uint32_t id, optype, opsize, recsize, txnid;
+	const uint8_t *end, *p;
+	const char *uri;
+	u_int fileid;
+
+	r = cookie;
+
+	/* Only commit records contain updates. */
+	if (((WT_LOG_RECORD *)record->data)->rectype != WT_LOGREC_COMMIT)
+		return (0);
+
+	WT_RET(__wt_logrec_commit_unpack(session, record, &txnid, &ops));
+	++r->records;
+
+	for (p = ops.data, end = p + ops.size; p < end; p += opsize) {
+		/* Every operation starts with the file's URI. */
+		WT_RET(__wt_logop_read(session, &p, end, &optype, &opsize));
+		if (opsize == 0 || opsize > (uint32_t)(end - p))
+			WT_RET_MSG(session, WT_ERROR,
+			    "corrupted log record at LSN %" PRIuMAX,
+			    (uintmax_t)lsn);
+		WT_RET(__wt_struct_unpack(
+		    session, p, opsize, "IIS", &optype, &recsize, &uri));
+		WT_RET(__recover_file_find(
+		    session, r, uri, strlen(uri), &fileid));
+
+		/* Skip updates included in the file's last checkpoint. */
+		f = &r->files[fileid];
+		if (f->dropped || lsn < f->ckpt_lsn)
+			continue;
+
+		w = &r->workers[fileid % WT_RECOVER_THREADS];
+		WT_RET(__wt_buf_grow(
+		    session, &w->ops, w->ops.size + sizeof(id) + opsize));
+		id = fileid;
+		memcpy((uint8_t *)w->ops.mem + w->ops.size, &id, sizeof(id));
+		memcpy((uint8_t *)w->ops.mem +
+		    w->ops.size + sizeof(id), p, opsize);
+		w->ops.size += WT_STORE_SIZE(sizeof(id) + opsize);
+		r->queued += sizeof(id) + opsize;
+	}
+
+	return (r->queued < WT_RECOVER_BATCH ? 0 : __recover_batch(session, r));
+}
+
+/*
+ * __wt_txn_recover --
+ *	Replay the log records written after each file's last checkpoint.
+ */
+int
+__wt_txn_recover(WT_SESSION_IMPL *session)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+	WT_RECOVER *r;
+	WT_RECOVER_WORKER *w;
+	WT_SESSION *wt_session;
+	off_t end, start;
+	uint64_t applied;
+	u_int i;
+	int logging;
+
+	conn = S2C(session);
+	r = NULL;
+	applied = 0;
+
+	if (conn->log == NULL)
+		return (0);
+
+	/* Replayed updates aren't logged again. */
+	logging = F_ISSET(conn, WT_CONN_LOGGING) ? 1 : 0;
+	F_CLR(conn, WT_CONN_LOGGING);
+
+	WT_ERR(__wt_calloc_def(session, 1, &r));
+	WT_ERR(__recover_file_load(session, r, &start));
+	WT_ERR(__wt_filesize(session, conn->log->fh, &end));
+	if (start == WT_LOG_INVALID_LSN || start >= end)
+		goto done;
+
+	WT_VERBOSE_ERR(session, recovery,
+	    "replaying %" PRIuMAX " bytes of log from LSN %" PRIuMAX,
+	    (uintmax_t)(end - start), (uintmax_t)start);
+
+	for (i = 0, w = r->workers; i < WT_RECOVER_THREADS; ++i, ++w) {
+		w->r = r;
+		WT_ERR(__wt_open_session(conn, 1, NULL, NULL, &w->session));
+		w->session->name = "log-recovery";
+	}
+
+	WT_ERR(__wt_log_scan(session, start, __recover_record, r));
+	WT_ERR(__recover_batch(session, r));
+
+	for (i = 0, w = r->workers; i < WT_RECOVER_THREADS; ++i, ++w)
+		applied += w->applied;
+
+	/*
+	 * Checkpoint the recovered files, so the records we replayed aren't
+	 * replayed again by the next recovery.  Use a worker's session: the
+	 * handles it caches are released when it's closed.
+	 */
+	if (applied != 0) {
+		wt_session = &r->workers[0].session->iface;
+		WT_ERR(wt_session->checkpoint(wt_session, NULL));
+	}
+
+done:	WT_VERBOSE_ERR(session, recovery,
+	    "complete: %" PRIu64 " commits read, "
+	    "%" PRIu64 " updates replayed", r->records, applied);
+
+err:	if (r != NULL) {
+		for (i = 0, w = r->workers; i < WT_RECOVER_THREADS; ++i, ++w) {
+			/* Close the worker's session, free its hazard array. */
+			if (w->session != NULL) {
+				wt_session = &w->session->iface;
+				WT_TRET(wt_session->close(wt_session, NULL));
+				__wt_free(session, w->session->hazard);
+			}
+			__wt_free(session, w->cursors);
+			__wt_buf_free(session, &w->ops);
+		}
+		for (i = 0; i < r->files_next; ++i)
+			__wt_free(session, r->files[i].uri);
+		__wt_free(session, r->files);
+		__wt_free(session, r);
+	}
+
+	if (logging)
+		F_SET(conn, WT_CONN_LOGGING);
+	return (ret);
+}
@@ -0,0 +1,255 @@
+/*-
+ * Public Domain 2008-2013 WiredTiger, Inc.
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "wt_internal.h"
+
+#include <assert.h>
+
+#define	URI	"file:__batch"
+#define	NKEYS	20000				/* Keys 0, 2, 4 ... */
+#define	MAXKEY	(2 * NKEYS + 1)			/* Keys that may exist */
+#define	NBATCH	(3 * NKEYS)			/* Items in a batch */
+
+void batch_check(void);
+void batch_insert(int, int, int);
+void key_set(WT_ITEM *, int);
+void open_conn(int);
+void shuffle(size_t);
+void value_set(WT_ITEM *, int, int);
+
+WT_CONNECTION *conn;
+WT_SESSION *session;
+
+char keybuf[NBATCH][16], valbuf[NBATCH][64];
+char *expected[MAXKEY];				/* Expected values */
+WT_ITEM keys[NBATCH], values[NBATCH];
+int knum[NBATCH], results[NBATCH];		/* Key numbers, results */
+
+int
+main(void)
+{
+	WT_CURSOR *cursor;
+	int i, k;
+
+	printf("batch test run started\n");
+	srand(3233456);
+
+	assert(system("rm -f WiredTiger* __batch*") == 0);
+	open_conn(1);
+
+	/*
+	 * Small pages so batches cross many leaf pages.  Insert the even keys
+	 * into an empty tree, then check them from the disk image.
+	 */
+	assert(session->create(session, URI,
+	    "key_format=u,value_format=u,"
+	    "internal_page_max=512,leaf_page_max=512") == 0);
+	batch_insert(NKEYS, 2, 0);
+	batch_check();
+	open_conn(0);
+	batch_check();
+
+	/*
+	 * Update some of the keys and insert some of the odd keys, the disk
+	 * pages have insert lists.
+	 */
+	batch_insert(NKEYS / 2, 1, 1);
+	batch_check();
+
+	/* Remove some of the keys. */
+	assert(session->open_cursor(session, URI, NULL, "raw", &cursor) == 0);
+	for (i = 0; i < NKEYS / 10; ++i) {
+		k = rand() % MAXKEY;
+		key_set(&keys[0], k);
+		cursor->set_key(cursor, &keys[0]);
+		if (cursor->remove(cursor) == 0) {
+			assert(expected[k] != NULL);
+			free(expected[k]);
+			expected[k] = NULL;
+		}
+	}
+	assert(cursor->close(cursor) == 0);
+	batch_check();
+	open_conn(0);
+	batch_check();
+
+	/* Without overwrite, a batch with an existing key fails. */
+	for (i = 0; expected[i] == NULL; ++i)
+		;
+	key_set(&keys[0], i);
+	value_set(&values[0], i, 0);
+	assert(session->open_cursor(session, URI, NULL, NULL, &cursor) == 0);
+	assert(cursor->insert_batch(cursor, keys, values, 1) ==
+	    WT_DUPLICATE_KEY);
+	assert(cursor->close(cursor) == 0);
+
+	assert(conn->close(conn, NULL) == 0);
+	for (i = 0; i < MAXKEY; ++i)
+		free(expected[i]);
+
+	printf("batch test run completed\n");
+	return (EXIT_SUCCESS);
+}
+
+/*
+ * open_conn --
+ *	Open the connection, closing it first unless it's being created.  A
+ * batch is a single transaction, the cache must hold all of its updates.
+ */
+void
+open_conn(int create)
+{
+	if (!create)
+		assert(conn->close(conn, NULL) == 0);
+	assert(wiredtiger_open(NULL, NULL,
+	    create ? "create,cache_size=20MB" : "cache_size=20MB", &conn) == 0);
+	assert(conn->open_session(conn, NULL, NULL, &session) == 0);
+}
+
+/*
+ * key_set --
+ *	Set a key item.
+ */
+void
+key_set(WT_ITEM *item, int k)
+{
+	static int next;
+	char *p;
+
+	p = keybuf[next++ % NBATCH];
+	(void)snprintf(p, sizeof(keybuf[0]), "%010d", k);
+	item->data = p;
+	item->size = strlen(p) + 1;
+}
+
+/*
+ * value_set --
+ *	Set a value item for a key.
+ */
+void
+value_set(WT_ITEM *item, int k, int gen)
+{
+	static int next;
+	static const char *padding = "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxx";
+	char *p;
+
+	p = valbuf[next++ % NBATCH];
+	(void)snprintf(p, sizeof(valbuf[0]),
+	    "value %d generation %d %.*s", k, gen, k % 30, padding);
+	item->data = p;
+	item->size = strlen(p) + 1;
+}
+
+/*
+ * shuffle --
+ *	Shuffle the first n key numbers.
+ */
+void
+shuffle(size_t n)
+{
+	size_t i, j;
+	int k;
+
+	for (i = n; i > 1; --i) {
+		j = (size_t)rand() % i;
+		k = knum[i - 1];
+		knum[i - 1] = knum[j];
+		knum[j] = k;
+	}
+}
+
+/*
+ * batch_insert --
+ *	Insert a batch of records, in random order: keys are chosen from the
+ * keys 0, step, 2 * step ... and some keys appear more than once.  The last
+ * value inserted for a key must win.
+ */
+void
+batch_insert(int nkeys, int step, int gen)
+{
+	WT_CURSOR *cursor;
+	size_t n;
+	int i, k;
+
+	for (n = 0, i = 0; i < nkeys; ++i)
+		knum[n++] = i * step;
+	for (i = 0; i < nkeys / 10; ++i)
+		knum[n++] = (rand() % nkeys) * step;
+	shuffle(n);
+	for (i = 0; i < (int)n; ++i) {
+		k = knum[i];
+		key_set(&keys[i], k);
+		value_set(&values[i], k, gen * NBATCH + i);
+		free(expected[k]);
+		assert((expected[k] = strdup(values[i].data)) != NULL);
+	}
+
+	assert(session->open_cursor(
+	    session, URI, NULL, "overwrite", &cursor) == 0);
+	assert(cursor->insert_batch(cursor, keys, values, n) == 0);
+	assert(cursor->close(cursor) == 0);
+}
+
+/*
+ * batch_check --
+ *	Search for every possible key, in random order, each more than once,
+ * and keys before and after all of the keys in the tree.
+ */
+void
+batch_check(void)
+{
+	WT_CURSOR *cursor;
+	size_t n;
+	int i, k;
+
+	for (n = 0, i = 0; i < MAXKEY; ++i)
+		knum[n++] = i;
+	for (i = 0; i < NBATCH - MAXKEY - 1; ++i)
+		knum[n++] = rand() % MAXKEY;
+	knum[n++] = MAXKEY + 100;
+	shuffle(n);
+	for (i = 0; i < (int)n; ++i)
+		key_set(&keys[i], knum[i]);
+
+	/* A key that sorts before all of the keys in the tree. */
+	keys[0].data = "";
+	keys[0].size = 1;
+
+	assert(session->open_cursor(session, URI, NULL, NULL, &cursor) == 0);
+	assert(cursor->search_batch(cursor, keys, values, results, n) == 0);
+	for (i = 0; i < (int)n; ++i) {
+		k = knum[i];
+		if (i == 0 || k >= MAXKEY || expected[k] == NULL) {
+			assert(results[i] == WT_NOTFOUND);
+			continue;
+		}
+		assert(results[i] == 0);
+		assert(values[i].size == strlen(expected[k]) + 1);
+		assert(strcmp(values[i].data, expected[k]) == 0);
+	}
+	assert(cursor->close(cursor) == 0);
+}
@@ -164,6 +164,7 @@ int run(void)
 	const char *uri = "file:my_bloom.bf";
 	int ret;
 	uint32_t fp, i;
+	uint8_t *bits;
 
 	/* Use the internal session handle to access private APIs. */
 	sess = (WT_SESSION_IMPL *)g.wt_session;
@@ -203,6 +204,16 @@ int run(void)
 			die(ret, "__wt_bloom_get");
 	}
 
+	/* Load the filter into memory and check it again. */
+	bits = NULL;
+	if ((ret = __wt_bloom_load(bloomp, &bits)) != 0)
+		die(ret, "__wt_bloom_load");
+	for (i = 0; i < g.c_ops; i++) {
+		item.data = g.entries[i];
+		if ((ret = __wt_bloom_get(bloomp, &item)) != 0)
+			die(ret, "__wt_bloom_get (in memory)");
+	}
+
 	/*
 	 * Try out some values we didn't insert - choose a different size to
 	 * ensure the value doesn't overlap with existing values.
@@ -221,6 +232,7 @@ int run(void)
 	    g.c_ops, fp, 100.0 * fp/g.c_ops);
 	if ((ret = __wt_bloom_drop(bloomp, NULL)) != 0)
 		die(ret, "__wt_bloom_drop");
+	__wt_free(sess, bits);
 
 	return (0);
 }
@@ -0,0 +1,190 @@
+/*-
+ * Public Domain 2008-2013 WiredTiger, Inc.
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "wt_internal.h"
+
+#include <assert.h>
+
+#define	NCOMPILE	1000			/* Strings to compile */
+#define	URI		"file:__config"
+
+void compiled(void);
+void errors(void);
+void grow(void);
+uint64_t lookups(void);
+
+WT_CONNECTION *conn;
+WT_SESSION *session;
+
+int
+main(void)
+{
+	printf("compiled configuration test run started\n");
+
+	assert(system("rm -f WiredTiger* __config*") == 0);
+	assert(wiredtiger_open(
+	    NULL, NULL, "create,statistics=true", &conn) == 0);
+	assert(conn->open_session(conn, NULL, NULL, &session) == 0);
+	assert(session->create(
+	    session, URI, "key_format=S,value_format=S") == 0);
+
+	compiled();
+	grow();
+	errors();
+
+	assert(conn->close(conn, NULL) == 0);
+
+	printf("compiled configuration test run completed\n");
+	return (EXIT_SUCCESS);
+}
+
+/*
+ * lookups --
+ *	Return the number of times a compiled string has been looked up.
+ */
+uint64_t
+lookups(void)
+{
+	WT_CURSOR *cursor;
+	const char *desc, *pvalue;
+	uint64_t value;
+
+	assert(session->open_cursor(
+	    session, "statistics:", NULL, NULL, &cursor) == 0);
+	cursor->set_key(cursor, WT_STAT_CONN_CONFIG_COMPILED_LOOKUP);
+	assert(cursor->search(cursor) == 0);
+	assert(cursor->get_value(cursor, &desc, &pvalue, &value) == 0);
+	assert(cursor->close(cursor) == 0);
+	return (value);
+}
+
+/*
+ * compiled --
+ *	Methods passed a compiled string use it, other strings are parsed.
+ */
+void
+compiled(void)
+{
+	WT_CURSOR *cursor;
+	uint64_t before;
+	const char *config, *copy;
+	char buf[64];
+
+	assert(conn->compile_configuration(conn, "session.begin_transaction",
+	    "isolation=snapshot,name=compiled", &config) == 0);
+	assert(strcmp(config, "isolation=snapshot,name=compiled") == 0);
+
+	/* Compiling the same string again returns the same copy. */
+	assert(conn->compile_configuration(conn, "session.begin_transaction",
+	    "isolation=snapshot,name=compiled", &copy) == 0);
+	assert(copy == config);
+
+	before = lookups();
+	assert(session->begin_transaction(session, config) == 0);
+	assert(session->commit_transaction(session, NULL) == 0);
+	assert(lookups() > before);
+
+	/* An uncompiled copy of the string is parsed. */
+	(void)strcpy(buf, config);
+	before = lookups();
+	assert(session->begin_transaction(session, buf) == 0);
+	assert(session->commit_transaction(session, NULL) == 0);
+	assert(lookups() == before);
+
+	/* A compiled string's values are used. */
+	assert(conn->compile_configuration(
+	    conn, "session.open_cursor", "overwrite=false", &config) == 0);
+	assert(session->open_cursor(session, URI, NULL, NULL, &cursor) == 0);
+	cursor->set_key(cursor, "key");
+	cursor->set_value(cursor, "value");
+	assert(cursor->insert(cursor) == 0);
+	assert(cursor->close(cursor) == 0);
+	before = lookups();
+	assert(session->open_cursor(session, URI, NULL, config, &cursor) == 0);
+	assert(lookups() > before);
+	cursor->set_key(cursor, "key");
+	cursor->set_value(cursor, "value");
+	assert(cursor->insert(cursor) == WT_DUPLICATE_KEY);
+	assert(cursor->close(cursor) == 0);
+}
+
+/*
+ * grow --
+ *	Compile more and longer strings than fit in the first arena.
+ */
+void
+grow(void)
+{
+	WT_CONFIG_ITEM cval;
+	WT_SESSION_IMPL *session_impl;
+	size_t len;
+	int i;
+	char *buf;
+	const char *config[NCOMPILE];
+
+	session_impl = (WT_SESSION_IMPL *)session;
+	len = 2 * WT_CONFIG_ARENA_SIZE;
+	assert((buf = malloc(len)) != NULL);
+	for (i = 0; i < NCOMPILE; ++i) {
+		/* Make every tenth name longer than the first arena. */
+		(void)snprintf(buf, len, "name=t%d", i);
+		if (i % 10 == 0) {
+			memset(buf + strlen(buf), 'x', len - 100);
+			buf[len - 100] = '\0';
+		}
+		assert(conn->compile_configuration(
+		    conn, "session.begin_transaction", buf, &config[i]) == 0);
+		assert(strcmp(config[i], buf) == 0);
+	}
+	for (i = 0; i < NCOMPILE; ++i) {
+		assert(__wt_config_compiled(session_impl, config[i]) != NULL);
+		assert(__wt_config_getones(
+		    session_impl, config[i], "name", &cval) == 0);
+		(void)snprintf(buf, len, "t%d", i);
+		assert(strncmp(cval.str, buf, strlen(buf)) == 0);
+		assert(session->begin_transaction(session, config[i]) == 0);
+		assert(session->commit_transaction(session, NULL) == 0);
+	}
+	free(buf);
+}
+
+/*
+ * errors --
+ *	Strings are checked when they are compiled.
+ */
+void
+errors(void)
+{
+	const char *config;
+
+	assert(conn->compile_configuration(conn,
+	    "session.begin_transaction", "isolation=bad", &config) == EINVAL);
+	assert(conn->compile_configuration(conn,
+	    "session.begin_transaction", "nosuchkey=1", &config) == EINVAL);
+	assert(conn->compile_configuration(conn,
+	    "session.nosuchmethod", "isolation=snapshot", &config) != 0);
+}
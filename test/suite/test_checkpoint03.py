@@ -0,0 +1,97 @@
+#!/usr/bin/env python
+#
+# Public Domain 2008-2013 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+# test_checkpoint03.py
+#   Checkpoints with sync threads writing dirty leaf pages
+#
+
+import wiredtiger, wttest
+
+# Dirty many leaf pages in several files, checkpoint with the sync threads
+# sharing the leaf writes, then verify the data before and after reopening
+# the connection.
+class test_checkpoint03(wttest.WiredTigerTestCase):
+
+    scenarios = [
+        ('one-thread', dict(threads=1)),
+        ('four-threads', dict(threads=4)),
+    ]
+
+    nfiles = 3
+    nrecords = 10000
+    bigvalue = "abcdefghij" * 50
+
+    # Override WiredTigerTestCase: start the sync threads.
+    def setUpConnectionOpen(self, dir):
+        conn = wiredtiger.wiredtiger_open(dir, 'create,' +
+            ('error_prefix="%s: ",' % self.shortid()) +
+            'cache_size=100MB,checkpoint_threads=%d' % self.threads)
+        self.pr(`conn`)
+        return conn
+
+    def uri(self, i):
+        return 'file:test_checkpoint03.' + str(i)
+
+    def update(self, value):
+        for i in xrange(self.nfiles):
+            cursor = self.session.open_cursor(self.uri(i), None)
+            for idx in xrange(1, self.nrecords):
+                cursor.set_key(`idx`)
+                cursor.set_value(`idx` + value)
+                cursor.insert()
+            cursor.close()
+
+    def check(self, value):
+        for i in xrange(self.nfiles):
+            cursor = self.session.open_cursor(self.uri(i), None)
+            for idx in xrange(1, self.nrecords):
+                cursor.set_key(`idx`)
+                self.assertEqual(cursor.search(), 0)
+                self.assertEqual(cursor.get_value(), `idx` + value)
+            cursor.close()
+
+    def test_checkpoint_threads(self):
+        for i in xrange(self.nfiles):
+            self.session.create(self.uri(i),
+                'key_format=S,value_format=S,leaf_page_max=4096')
+
+        # Checkpoint, then dirty every page again and checkpoint again.
+        self.update(self.bigvalue)
+        self.session.checkpoint(None)
+        self.check(self.bigvalue)
+        self.update(self.bigvalue.upper())
+        self.session.checkpoint(None)
+        self.check(self.bigvalue.upper())
+        for i in xrange(self.nfiles):
+            self.session.verify(self.uri(i), None)
+
+        self.reopen_conn()
+        self.check(self.bigvalue.upper())
+
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,76 @@
+#!/usr/bin/env python
+#
+# Public Domain 2008-2013 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+# test_config_compile.py
+#   Compiled configuration strings
+#
+
+import wiredtiger, wttest
+
+# Compile configuration strings and use them.  Python returns a copy of the
+# compiled string, which methods parse as usual: test/config checks compiled
+# strings are used from C.
+class test_config_compile(wttest.WiredTigerTestCase):
+    uri = 'table:test_config_compile'
+
+    def test_config_compile(self):
+        config = self.conn.compile_configuration(
+            'session.begin_transaction', 'isolation=snapshot,name=compiled')
+        self.assertEqual(config, 'isolation=snapshot,name=compiled')
+
+        self.session.create(self.uri, 'key_format=S,value_format=S')
+        self.session.begin_transaction(config)
+        cursor = self.session.open_cursor(self.uri, None)
+        cursor.set_key('key')
+        cursor.set_value('value')
+        cursor.insert()
+        cursor.close()
+        self.session.commit_transaction()
+
+        config = self.conn.compile_configuration(
+            'session.open_cursor', 'overwrite=false')
+        cursor = self.session.open_cursor(self.uri, None, config)
+        cursor.set_key('key')
+        cursor.set_value('value')
+        self.assertRaises(wiredtiger.WiredTigerError,
+            lambda: cursor.insert())
+        cursor.close()
+
+    # Strings are checked when they are compiled.
+    def test_config_compile_check(self):
+        self.assertRaises(wiredtiger.WiredTigerError,
+            lambda: self.conn.compile_configuration(
+            'session.begin_transaction', 'isolation=bad'))
+        self.assertRaises(wiredtiger.WiredTigerError,
+            lambda: self.conn.compile_configuration(
+            'session.begin_transaction', 'nosuchkey=1'))
+        self.assertRaises(wiredtiger.WiredTigerError,
+            lambda: self.conn.compile_configuration(
+            'session.nosuchmethod', 'isolation=snapshot'))
+
+if __name__ == '__main__':
+    wttest.run()
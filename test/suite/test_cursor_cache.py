@@ -0,0 +1,93 @@
+#!/usr/bin/env python
+#
+# Public Domain 2008-2013 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+# test_cursor_cache.py
+#   Session cursor caching
+#
+
+import wiredtiger, wttest
+
+# Open and close file cursors with the cursor cache configured, check cached
+# cursors are reset and don't keep the object from being dropped.
+class test_cursor_cache(wttest.WiredTigerTestCase):
+    uri = 'file:test_cursor_cache'
+
+    # Override WiredTigerTestCase: configure a cursor cache.
+    def setUpConnectionOpen(self, dir):
+        conn = wiredtiger.wiredtiger_open(dir, 'create,' +
+            ('error_prefix="%s: ",' % self.shortid()) + 'cursor_cache=5')
+        self.pr(`conn`)
+        return conn
+
+    def test_cursor_cache(self):
+        self.session.create(self.uri, 'key_format=S,value_format=S')
+        for idx in xrange(1, 100):
+            cursor = self.session.open_cursor(self.uri, None)
+            cursor.set_key(`idx`)
+            cursor.set_value(`idx`)
+            cursor.insert()
+            cursor.close()
+
+        # A reused cursor is unpositioned.
+        cursor = self.session.open_cursor(self.uri, None)
+        self.assertRaises(wiredtiger.WiredTigerError,
+            lambda: cursor.get_key())
+        self.assertEqual(cursor.next(), 0)
+        self.assertEqual(cursor.get_key(), '1')
+        cursor.close()
+
+        # Cursors with different configurations aren't shared.
+        cursor = self.session.open_cursor(self.uri, None, 'overwrite=false')
+        cursor.set_key('1')
+        cursor.set_value('1')
+        self.assertRaises(wiredtiger.WiredTigerError,
+            lambda: cursor.insert())
+        cursor.close()
+        cursor = self.session.open_cursor(self.uri, None)
+        cursor.set_key('1')
+        cursor.set_value('2')
+        cursor.insert()
+        cursor.close()
+
+        # Cached cursors don't hold the object open.
+        self.session.drop(self.uri, None)
+        self.session.create(self.uri, 'key_format=r,value_format=S')
+        cursor = self.session.open_cursor(self.uri, None)
+        cursor.set_key(7)
+        cursor.set_value('seven')
+        cursor.insert()
+        cursor.close()
+        cursor = self.session.open_cursor(self.uri, None)
+        cursor.set_key(7)
+        self.assertEqual(cursor.search(), 0)
+        self.assertEqual(cursor.get_value(), 'seven')
+        cursor.close()
+        self.session.verify(self.uri, None)
+
+
+if __name__ == '__main__':
+    wttest.run()
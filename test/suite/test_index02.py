@@ -0,0 +1,140 @@
+#!/usr/bin/env python
+#
+# Public Domain 2008-2013 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+# test_index02.py
+#   Indices with a custom extractor
+#
+
+import os, run
+import wiredtiger, wttest
+from wtscenario import multiply_scenarios, number_scenarios
+
+# Test indices maintained by the "words" extractor, which generates an index
+# key for each word in a string value.
+class test_index02(wttest.WiredTigerTestCase):
+    tablename = 'table:test_index02'
+    indexname = 'index:test_index02:words'
+
+    types = [
+        ('file', dict(type='file')),
+        ('lsm', dict(type='lsm')),
+    ]
+    # Item keys are the last extracted column, packed without a size in the
+    # index cursor's key but followed by the primary key in the index.
+    keyfmt = [
+        ('string', dict(keyfmt='S')),
+        ('item', dict(keyfmt='u')),
+    ]
+    scenarios = number_scenarios(multiply_scenarios('.', types, keyfmt))
+
+    # Override WiredTigerTestCase, we have extensions.
+    def setUpConnectionOpen(self, dir):
+        conn = wiredtiger.wiredtiger_open(dir, 'create,' +
+            ('error_prefix="%s: ",' % self.shortid()) +
+            self.extensionArg('words'))
+        self.pr(`conn`)
+        return conn
+
+    # Return the wiredtiger_open extension argument for a shared library.
+    def extensionArg(self, name):
+        extdir = os.path.join(run.wt_builddir, 'ext/extractors')
+        extfile = os.path.join(
+            extdir, name, '.libs', 'libwiredtiger_' + name + '_extractor.so')
+        if not os.path.exists(extfile):
+            self.skipTest('extractor extension "' + extfile + '" not built')
+        return ',extensions=["' + extfile + '"]'
+
+    def create(self):
+        self.session.create(self.tablename,
+            'key_format=S,value_format=S,columns=(name,tags),type=' +
+            self.type)
+        self.session.create(self.indexname,
+            'extractor=words,key_format=' + self.keyfmt +
+            ',type=' + self.type)
+
+    def set(self, name, tags, op='insert'):
+        cursor = self.session.open_cursor(self.tablename, None, 'overwrite')
+        cursor.set_key(name)
+        if op == 'remove':
+            self.assertEqual(cursor.remove(), 0)
+        else:
+            cursor.set_value(tags)
+            self.assertEqual(getattr(cursor, op)(), 0)
+        cursor.close()
+
+    def index(self):
+        cursor = self.session.open_cursor(self.indexname + '(name)', None)
+        result = [tuple(cols) for cols in cursor]
+        cursor.close()
+        # Item keys are stored with a size prefix, so shorter words sort
+        # first: compare them in string order.
+        if self.keyfmt == 'u':
+            result.sort()
+        return result
+
+    def test_insert(self):
+        '''Records generate an index key for each word, or none'''
+        self.create()
+        self.set('a', 'red green')
+        self.set('b', 'green blue green')
+        self.set('c', '   ')
+        self.assertEqual(self.index(), [('blue', 'b'),
+            ('green', 'a'), ('green', 'b'), ('red', 'a')])
+
+    def test_update(self):
+        '''Updates and removes replace the old index keys'''
+        self.create()
+        self.set('a', 'red green')
+        self.set('b', 'green blue')
+        self.set('a', 'yellow', 'update')
+        self.set('b', None, 'remove')
+        self.set('c', 'yellow red')
+        self.assertEqual(self.index(), [('red', 'c'),
+            ('yellow', 'a'), ('yellow', 'c')])
+
+    def test_search(self):
+        '''Index cursors find the records for an extracted key'''
+        self.create()
+        self.set('a', 'red green')
+        self.set('b', 'green blue')
+        cursor = self.session.open_cursor(self.indexname, None)
+        cursor.set_key('blue')
+        self.assertEqual(cursor.search(), 0)
+        self.assertEqual(cursor.get_value(), 'green blue')
+        cursor.set_key('purple')
+        self.assertEqual(cursor.search(), wiredtiger.WT_NOTFOUND)
+        cursor.close()
+
+    def test_unknown(self):
+        '''Creating an index with an unknown extractor fails'''
+        self.create()
+        self.assertRaises(wiredtiger.WiredTigerError,
+            lambda: self.session.create('index:test_index02:bad',
+            'extractor=nonexistent,key_format=S'))
+
+if __name__ == '__main__':
+    wttest.run()
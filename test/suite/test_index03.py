@@ -0,0 +1,153 @@
+#!/usr/bin/env python
+#
+# Public Domain 2008-2013 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+#
+# test_index03.py
+#   Indices that store value columns
+#
+
+import wiredtiger, wttest
+from wiredtiger import stat
+
+# Test indices configured with value_columns: index cursors whose columns
+# are all stored in the index don't read the table's column groups.
+class test_index03(wttest.WiredTigerTestCase):
+    tablename = 'table:test_index03'
+    cgnames = ['colgroup:test_index03:c1', 'colgroup:test_index03:c2']
+    indexname = 'index:test_index03:city'
+    agename = 'index:test_index03:age'
+
+    scenarios = [
+        ('file', dict(type='file')),
+        ('lsm', dict(type='lsm')),
+    ]
+
+    def create(self):
+        self.conn.reconfigure('statistics=true')
+        self.session.create(self.tablename,
+            'key_format=i,value_format=SSi,columns=(id,name,city,age),' +
+            'colgroups=(c1,c2),type=' + self.type)
+        self.session.create(self.cgnames[0], 'columns=(name)')
+        self.session.create(self.cgnames[1], 'columns=(city,age)')
+        self.session.create(self.indexname,
+            'columns=(city),value_columns=(name,age),type=' + self.type)
+        self.session.create(self.agename,
+            'columns=(age),type=' + self.type)
+
+    def populate(self):
+        cursor = self.session.open_cursor(self.tablename, None, 'overwrite')
+        for id, name, city, age in [(1, 'alice', 'paris', 30),
+            (2, 'bob', 'oslo', 40), (3, 'carol', 'lima', 50),
+            (4, 'dave', 'oslo', 60)]:
+            cursor.set_key(id)
+            cursor.set_value(name, city, age)
+            self.assertEqual(cursor.insert(), 0)
+        cursor.close()
+
+    # Return the number of searches of the table's column groups.
+    def searches(self):
+        total = 0
+        for cgname in self.cgnames:
+            cursor = self.session.open_cursor('statistics:' + cgname, None)
+            total += cursor[stat.dsrc.cursor_search][2]
+            cursor.close()
+        return total
+
+    def index(self, uri):
+        cursor = self.session.open_cursor(uri, None)
+        result = [tuple(cols) for cols in cursor]
+        cursor.close()
+        return result
+
+    def test_covered(self):
+        '''Stored columns are read from the index alone'''
+        self.create()
+        self.populate()
+        before = self.searches()
+        self.assertEqual(self.index(self.indexname), [
+            ('lima', 'carol', 'lima', 50), ('oslo', 'bob', 'oslo', 40),
+            ('oslo', 'dave', 'oslo', 60), ('paris', 'alice', 'paris', 30)])
+        self.assertEqual(self.index(self.indexname + '(age,id)'), [
+            ('lima', 50, 3), ('oslo', 40, 2),
+            ('oslo', 60, 4), ('paris', 30, 1)])
+        self.assertEqual(self.searches(), before)
+
+    def test_not_covered(self):
+        '''Other columns are read from the table'''
+        self.create()
+        self.populate()
+        before = self.searches()
+        self.assertEqual(self.index(self.agename + '(name)'), [
+            (30, 'alice'), (40, 'bob'), (50, 'carol'), (60, 'dave')])
+        self.assertTrue(self.searches() > before)
+
+    def test_update(self):
+        '''Updates and removes replace the stored columns'''
+        self.create()
+        self.populate()
+        cursor = self.session.open_cursor(self.tablename, None, 'overwrite')
+        cursor.set_key(2)
+        cursor.set_value('bobby', 'oslo', 41)
+        self.assertEqual(cursor.update(), 0)
+        cursor.set_key(3)
+        self.assertEqual(cursor.remove(), 0)
+        cursor.set_key(4)
+        cursor.set_value('dave', 'rome', 61)
+        self.assertEqual(cursor.insert(), 0)
+        cursor.close()
+        self.reopen_conn()
+        self.assertEqual(self.index(self.indexname + '(name,age)'), [
+            ('oslo', 'bobby', 41), ('paris', 'alice', 30),
+            ('rome', 'dave', 61)])
+
+    def test_empty_item(self):
+        '''Stored columns may be empty items'''
+        self.session.create('table:test_index03b',
+            'key_format=i,value_format=Su,columns=(id,name,blob),type=' +
+            self.type)
+        self.session.create('index:test_index03b:name',
+            'columns=(name),value_columns=(blob),type=' + self.type)
+        cursor = self.session.open_cursor('table:test_index03b', None, None)
+        cursor.set_key(1)
+        cursor.set_value('x', '')
+        self.assertEqual(cursor.insert(), 0)
+        cursor.set_key(2)
+        cursor.set_value('y', 'ab')
+        self.assertEqual(cursor.insert(), 0)
+        cursor.close()
+        self.assertEqual(self.index('index:test_index03b:name(blob,id)'),
+            [('x', '', 1), ('y', 'ab', 2)])
+
+    def test_unknown(self):
+        '''Creating an index storing an unknown column fails'''
+        self.create()
+        self.assertRaises(wiredtiger.WiredTigerError,
+            lambda: self.session.create('index:test_index03:bad',
+            'columns=(city),value_columns=(nonexistent)'))
+
+if __name__ == '__main__':
+    wttest.run()
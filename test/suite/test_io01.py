@@ -0,0 +1,82 @@
+#!/usr/bin/env python
+#
+# Public Domain 2008-2013 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+# test_io01.py
+#   Background block writes
+#
+
+import wiredtiger, wttest
+
+# Write through the block I/O threads with a small cache, then verify the
+# data before and after reopening the connection.
+class test_io01(wttest.WiredTigerTestCase):
+
+    scenarios = [
+        ('file', dict(uri='file:test_io01')),
+        ('table', dict(uri='table:test_io01')),
+    ]
+
+    nrecords = 20000
+    bigvalue = "abcdefghij" * 100
+
+    # Override WiredTigerTestCase: start I/O threads, use a small cache.
+    def setUpConnectionOpen(self, dir):
+        conn = wiredtiger.wiredtiger_open(dir, 'create,' +
+            ('error_prefix="%s: ",' % self.shortid()) +
+            'cache_size=1MB,io_threads=2')
+        self.pr(`conn`)
+        return conn
+
+    def check(self):
+        cursor = self.session.open_cursor(self.uri, None)
+        for idx in xrange(1, self.nrecords):
+            cursor.set_key(`idx`)
+            self.assertEqual(cursor.search(), 0)
+            self.assertEqual(cursor.get_value(), `idx` + self.bigvalue)
+        cursor.close()
+
+    def test_io_threads(self):
+        self.session.create(self.uri,
+            'key_format=S,value_format=S,leaf_page_max=4096')
+        cursor = self.session.open_cursor(self.uri, None)
+        for idx in xrange(1, self.nrecords):
+            cursor.set_key(`idx`)
+            cursor.set_value(`idx` + self.bigvalue)
+            cursor.insert()
+        cursor.close()
+
+        # Read pages back while their writes may still be queued.
+        self.check()
+        self.session.checkpoint(None)
+        self.session.verify(self.uri, None)
+
+        self.reopen_conn()
+        self.check()
+
+
+if __name__ == '__main__':
+    wttest.run()
@@ -40,6 +40,12 @@ class test_lsm01(wttest.WiredTigerTestCase):
         [1*M,20*M,None], [0.6,0.6,0.6])
     merge_max_scenarios = wtscenario.quick_scenarios('s_lsm_merge_max',
         [2,10,20,None], None)
+    merge_partitions_scenarios = wtscenario.quick_scenarios(
+        's_lsm_merge_partitions', [1,4,None], None)
+    merge_policy_scenarios = wtscenario.quick_scenarios('s_lsm_merge_policy',
+        ['default','leveled','tiered',None], None)
+    merge_ratio_scenarios = wtscenario.quick_scenarios('s_lsm_merge_ratio',
+        [2,10,None], None)
     bloom_scenarios = wtscenario.quick_scenarios('s_lsm_bloom',
         [True,False,None], None)
     bloom_bit_scenarios = wtscenario.quick_scenarios('s_lsm_bloom_bit_count',
@@ -50,11 +56,15 @@ class test_lsm01(wttest.WiredTigerTestCase):
     record_count_scenarios = wtscenario.quick_scenarios(
         'nrecs', [10, 10000], [0.9, 0.1])
 
-    config_vars = [ 'lsm_chunk_size', 'lsm_merge_max', 'lsm_bloom',
-                    'lsm_bloom_bit_count', 'lsm_bloom_hash_count' ]
+    config_vars = [ 'lsm_chunk_size', 'lsm_merge_max',
+                    'lsm_merge_partitions', 'lsm_merge_policy',
+                    'lsm_merge_ratio', 'lsm_bloom', 'lsm_bloom_bit_count',
+                    'lsm_bloom_hash_count' ]
 
     all_scenarios = wtscenario.multiply_scenarios('_',
-        chunk_size_scenarios, merge_max_scenarios, bloom_scenarios,
+        chunk_size_scenarios, merge_max_scenarios,
+        merge_partitions_scenarios, merge_policy_scenarios,
+        merge_ratio_scenarios, bloom_scenarios,
         bloom_bit_scenarios, bloom_hash_scenarios, record_count_scenarios)
 
     scenarios = wtscenario.prune_scenarios(all_scenarios, 500)
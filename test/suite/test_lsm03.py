@@ -0,0 +1,67 @@
+#!/usr/bin/env python
+#
+# Public Domain 2008-2013 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED 'AS IS', WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+
+import wiredtiger, wtscenario, wttest
+from helper import simple_populate, simple_populate_check
+
+# test_lsm03.py
+#    Test LSM trees sharing the connection's LSM worker threads.
+class test_lsm03(wttest.WiredTigerTestCase):
+    ntrees = 10
+    nrecs = 10000
+
+    scenarios = [
+        ('one-worker', dict(lsm_workers=1)),
+        ('two-workers', dict(lsm_workers=2)),
+    ]
+
+    # Overrides WiredTigerTestCase
+    def setUpConnectionOpen(self, dir):
+        conn = wiredtiger.wiredtiger_open(dir, 'create,' +
+                ('error_prefix="%s: ",' % self.shortid()) +
+                'lsm_workers=%d,' % self.lsm_workers)
+        self.pr(`conn`)
+        return conn
+
+    # Populate more trees than there are worker threads, with chunks small
+    # enough that they are flushed and merged, then drop some of the trees
+    # while the workers are busy.
+    def test_lsm_workers(self):
+        config = 'key_format=S,lsm_chunk_size=512K,lsm_merge_threads=2'
+        uris = ['lsm:test_lsm03_%d' % i for i in range(self.ntrees)]
+        for uri in uris:
+            simple_populate(self, uri, config, self.nrecs)
+        for uri in uris:
+            simple_populate_check(self, uri, self.nrecs)
+        for uri in uris[::2]:
+            self.session.drop(uri, None)
+        for uri in uris[1::2]:
+            simple_populate_check(self, uri, self.nrecs)
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,73 @@
+#!/usr/bin/env python
+#
+# Public Domain 2008-2013 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import time
+import wiredtiger, wttest
+from helper import simple_populate, simple_populate_check
+from wiredtiger import stat
+
+# test_lsm04.py
+#    Test LSM merges split into key ranges.
+class test_lsm04(wttest.WiredTigerTestCase):
+    uri = 'lsm:test_lsm04'
+    # Enough records for merges of at least two ranges of 10000 records.
+    nrecs = 200000
+
+    scenarios = [
+        ('default', dict(merge_policy='default')),
+        ('leveled', dict(merge_policy='leveled')),
+        ('tiered', dict(merge_policy='tiered')),
+    ]
+
+    # Overrides WiredTigerTestCase
+    def setUpConnectionOpen(self, dir):
+        conn = wiredtiger.wiredtiger_open(dir, 'create,statistics=true,' +
+                ('error_prefix="%s: ",' % self.shortid()))
+        self.pr(`conn`)
+        return conn
+
+    def partitions_built(self):
+        cursor = self.session.open_cursor('statistics:', None, None)
+        built = cursor[stat.conn.lsm_partitions_built][2]
+        cursor.close()
+        return built
+
+    def test_lsm_partitions(self):
+        simple_populate(self, self.uri, 'key_format=S,lsm_chunk_size=512K,' +
+            'lsm_merge_partitions=4,lsm_merge_policy=' + self.merge_policy,
+            self.nrecs)
+        for i in range(60):
+            if self.partitions_built() > 0:
+                break
+            time.sleep(1)
+        self.assertTrue(self.partitions_built() > 0)
+        simple_populate_check(self, self.uri, self.nrecs)
+        self.reopen_conn()
+        simple_populate_check(self, self.uri, self.nrecs)
+
+if __name__ == '__main__':
+    wttest.run()
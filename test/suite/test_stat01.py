@@ -130,5 +130,24 @@ class test_stat01(wttest.WiredTigerTestCase):
             cursor.close()
             self.session.truncate(self.uri, None, None)
 
+    def test_latency_stats(self):
+        self.conn.reconfigure('statistics=true')
+        helper.simple_populate(self, self.uri, self.config, self.nentries)
+
+        # Every insert lands in exactly one latency histogram bucket.
+        cursor = self.session.open_cursor('statistics:', None, None)
+        inserts = cursor[stat.conn.cursor_insert][2]
+        total = 0
+        for i in range(0, 20):
+            total += cursor[getattr(stat.conn, 'latency_insert_%02d' % i)][2]
+        self.assertEqual(total, inserts)
+        self.assertEqual(
+            cursor[stat.conn.latency_insert_00][0],
+            'latency: Btree cursor inserts 0-1us')
+        self.assertEqual(
+            cursor[stat.conn.latency_insert_19][0],
+            'latency: Btree cursor inserts over 1s')
+        cursor.close()
+
 if __name__ == '__main__':
     wttest.run()
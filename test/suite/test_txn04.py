@@ -0,0 +1,154 @@
+#!/usr/bin/env python
+#
+# Public Domain 2008-2013 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+# test_txn04.py
+#   Transactions: commits are written to the log
+#
+
+import os
+import wiredtiger, wttest
+from wiredtiger import stat
+
+class test_txn04(wttest.WiredTigerTestCase):
+    uri = 'table:test_txn04'
+
+    scenarios = [
+        ('row', dict(create_params='key_format=S,value_format=S',
+            key=lambda i: 'key%06d' % i)),
+        ('col', dict(create_params='key_format=r,value_format=S',
+            key=lambda i: i + 1)),
+    ]
+
+    # Overrides WiredTigerTestCase
+    def setUpConnectionOpen(self, dir):
+        conn = wiredtiger.wiredtiger_open(dir, 'create,' +
+                ('error_prefix="%s: ",' % self.shortid()) +
+                'logging,statistics=true,transactional,')
+        self.pr(`conn`)
+        return conn
+
+    def log_stat(self, which):
+        c = self.session.open_cursor('statistics:', None, None)
+        value = c[which][2]
+        c.close()
+        return value
+
+    def test_log_commit(self):
+        self.session.create(self.uri, self.create_params)
+        c = self.session.open_cursor(self.uri, None)
+        records = self.log_stat(stat.conn.log_records)
+
+        # Each committed transaction writes a single log record.
+        for i in xrange(10):
+            self.session.begin_transaction()
+            c.set_key(self.key(i))
+            c.set_value('value%d' % i)
+            c.insert()
+            c.set_key(self.key(i))
+            c.remove()
+            c.set_key(self.key(i))
+            c.set_value('value%d' % i)
+            c.insert()
+            self.session.commit_transaction()
+        self.assertEqual(self.log_stat(stat.conn.log_records), records + 10)
+
+        # Rolled-back and read-only transactions aren't logged.
+        self.session.begin_transaction()
+        c.set_key(self.key(20))
+        c.set_value('value')
+        c.insert()
+        self.session.rollback_transaction()
+        self.session.begin_transaction()
+        c.set_key(self.key(1))
+        c.search()
+        self.session.commit_transaction()
+        self.assertEqual(self.log_stat(stat.conn.log_records), records + 10)
+
+        # Committed records have been written to the log file.
+        c.close()
+        self.assertTrue(self.log_stat(stat.conn.log_bytes_written) > 0)
+        self.assertTrue(os.path.getsize('WiredTiger.log') > 0)
+
+    def commit(self, c, i, begin_config=None, commit_config=None):
+        self.session.begin_transaction(begin_config)
+        c.set_key(self.key(i))
+        c.set_value('value%d' % i)
+        c.insert()
+        self.session.commit_transaction(commit_config)
+
+    def test_log_sync(self):
+        self.session.create(self.uri, self.create_params)
+        c = self.session.open_cursor(self.uri, None)
+
+        # The default, "sync=full", syncs the log.
+        syncs = self.log_stat(stat.conn.log_syncs)
+        self.commit(c, 1)
+        self.assertEqual(self.log_stat(stat.conn.log_syncs), syncs + 1)
+
+        # Flushed and buffered commits don't sync the log, buffered commits
+        # don't wait for the write.
+        writes = self.log_stat(stat.conn.log_writes)
+        self.commit(c, 2, 'sync=flush')
+        self.commit(c, 3, None, 'sync=flush')
+        self.assertEqual(self.log_stat(stat.conn.log_writes), writes + 2)
+        records = self.log_stat(stat.conn.log_records)
+        self.commit(c, 4, 'sync=write')
+        self.assertEqual(self.log_stat(stat.conn.log_records), records + 1)
+        self.assertEqual(self.log_stat(stat.conn.log_syncs), syncs + 1)
+
+        # A commit can ask for more durability than the transaction.
+        self.commit(c, 5, 'sync=write', 'sync=full')
+        self.assertEqual(self.log_stat(stat.conn.log_syncs), syncs + 2)
+
+        # Unlogged transactions don't write log records.
+        records = self.log_stat(stat.conn.log_records)
+        self.commit(c, 6, 'sync=none')
+        self.commit(c, 7, None, 'sync=none')
+        self.assertEqual(self.log_stat(stat.conn.log_records), records)
+
+        # An unlogged transaction can't commit with more durability: its
+        # updates weren't recorded.  The commit fails, the transaction keeps
+        # running and can still be committed.
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: self.commit(c, 8, 'sync=none', 'sync=full'),
+            '/cannot commit with sync=full/')
+        c.set_key(self.key(8))
+        self.assertEqual(c.search(), 0)
+        self.session.commit_transaction()
+        self.assertEqual(self.log_stat(stat.conn.log_records), records)
+        c.set_key(self.key(8))
+        self.assertEqual(c.search(), 0)
+
+        # Unless it is read-only.
+        self.session.begin_transaction('sync=none')
+        c.set_key(self.key(7))
+        self.assertEqual(c.search(), 0)
+        self.session.commit_transaction('sync=full')
+        c.close()
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,102 @@
+#!/usr/bin/env python
+#
+# Public Domain 2008-2013 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+# test_txn05.py
+#   Transactions: recovery from the log
+#
+
+import os, shutil
+import wiredtiger, wttest
+
+class test_txn05(wttest.WiredTigerTestCase):
+    uri = 'table:test_txn05'
+    nentries = 1000
+
+    scenarios = [
+        ('row', dict(create_params='key_format=S,value_format=S',
+            key=lambda i: 'key%06d' % i)),
+        ('col', dict(create_params='key_format=r,value_format=S',
+            key=lambda i: i + 1)),
+    ]
+
+    # Overrides WiredTigerTestCase
+    def setUpConnectionOpen(self, dir):
+        conn = wiredtiger.wiredtiger_open(dir, 'create,' +
+                ('error_prefix="%s: ",' % self.shortid()) +
+                'logging,transactional,')
+        self.pr(`conn`)
+        return conn
+
+    # Copy the database while it's open: the copy looks like a database
+    # after a crash.
+    def crash_copy(self, dir):
+        shutil.rmtree(dir, ignore_errors=True)
+        os.mkdir(dir)
+        for f in os.listdir('.'):
+            if os.path.isfile(f) and f != 'WiredTiger.lock':
+                shutil.copy(f, dir)
+
+    def check(self, dir, expected):
+        conn = wiredtiger.wiredtiger_open(dir, 'logging,transactional')
+        session = conn.open_session()
+        c = session.open_cursor(self.uri, None)
+        actual = dict((k, v) for k, v in c if v != '')
+        self.assertEqual(actual, expected)
+        conn.close()
+
+    def test_recover(self):
+        self.session.create(self.uri, self.create_params)
+        c = self.session.open_cursor(self.uri, None)
+        expected = {}
+
+        # Updates before and after a checkpoint, some rolled back.
+        for i in xrange(self.nentries):
+            if i == self.nentries / 2:
+                self.session.checkpoint()
+            self.session.begin_transaction()
+            c.set_key(self.key(i))
+            c.set_value('value%d' % i)
+            c.insert()
+            if i % 3 == 0:
+                c.set_key(self.key(i))
+                c.remove()
+            if i % 7 == 0:
+                self.session.rollback_transaction()
+                continue
+            self.session.commit_transaction()
+            if i % 3 != 0:
+                expected[self.key(i)] = 'value%d' % i
+
+        # Committed updates are recovered, and recovering again changes
+        # nothing.
+        self.crash_copy('RESTART')
+        self.check('RESTART', expected)
+        self.check('RESTART', expected)
+        c.close()
+
+if __name__ == '__main__':
+    wttest.run()